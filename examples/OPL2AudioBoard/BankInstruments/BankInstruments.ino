@@ -0,0 +1,92 @@
+/**
+ * This is an example sketch from the OPL2 library for Arduino. It opens an instrument bank from SD card and plays a
+ * short melody with each instrument of the bank in turn. Instruments are read from the SD card only when they are
+ * needed, so even large banks can be used on an Arduino Uno.
+ *
+ * OPL2 board is connected as follows:
+ *   Pin  8 - Reset
+ *   Pin  9 - A0
+ *   Pin 10 - Latch
+ *   Pin 11 - Data
+ *   Pin 13 - Shift
+ *
+ * Connect the SD card with Arduino SPI pins as usual and use pin 7 as CS.
+ *
+ * Refer to the wiki at https://github.com/DhrBaksteen/ArduinoOPL2/wiki/Connecting to learn how to connect your platform
+ * of choice!
+ *
+ * By default this example will look for bank.ibk in the root of the SD card. SBI, IBK, BNK, GENMIDI.OP2 and WOPL banks
+ * are recognized automatically. Apogee TMB banks have no signature and must be opened with BANK_FORMAT_TMB. 4-OP
+ * instruments of WOPL banks are skipped since the OPL2 can only play 2-OP instruments.
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <SPI.h>
+#include <SD.h>
+#include <OPL2.h>
+#include <InstrumentBank.h>
+
+
+OPL2 opl2;
+InstrumentBank bank;
+File bankFile;
+
+const byte melody[] = { NOTE_C, NOTE_E, NOTE_G, NOTE_E };
+unsigned int instrumentIndex = 0;
+
+
+/**
+ * Read a block of the instrument bank from SD card.
+ */
+int readBank(unsigned long offset, byte *buffer, unsigned int length) {
+	if (bankFile.position() != offset) {
+		bankFile.seek(offset);
+	}
+	return bankFile.read(buffer, length);
+}
+
+
+void setup() {
+	Serial.begin(9600);
+	opl2.begin();
+
+	if (!SD.begin(7)) {
+		Serial.println(F("SD card not found"));
+		while (true);
+	}
+
+	bankFile = SD.open("bank.ibk", FILE_READ);
+	if (!bankFile || !bank.open(readBank)) {
+		Serial.println(F("Unable to open bank.ibk"));
+		while (true);
+	}
+
+	Serial.print(bank.getNumInstruments());
+	Serial.println(F(" instruments in bank"));
+}
+
+
+void loop() {
+	const byte *data = bank.getInstrument(instrumentIndex);
+
+	if (data != NULL && !bank.isInstrument4OP(instrumentIndex)) {
+		Serial.print(F("Instrument "));
+		Serial.println(instrumentIndex);
+
+		Instrument instrument = opl2.loadInstrument(data, INSTRUMENT_DATA_SRAM);
+		opl2.setInstrument(0, instrument);
+
+		for (byte i = 0; i < sizeof(melody); i ++) {
+			opl2.playNote(0, 4, melody[i]);
+			delay(250);
+			opl2.setKeyOn(0, false);
+			delay(50);
+		}
+		delay(300);
+	}
+
+	instrumentIndex = (instrumentIndex + 1) % bank.getNumInstruments();
+}
@@ -0,0 +1,70 @@
+/**
+ * This is an example sketch from the OPL2 library for Arduino. It plays a Creative Music File (CMF) from SD card using
+ * the YM3812 audio chip. CMF files were made by Sound Blaster software and contain their own instruments. Songs that
+ * use rhythm mode play their drums with the percussion mode of the OPL2.
+ *
+ * OPL2 board is connected as follows:
+ *   Pin  8 - Reset
+ *   Pin  9 - A0
+ *   Pin 10 - Latch
+ *   Pin 11 - Data
+ *   Pin 13 - Shift
+ *
+ * Connect the SD card with Arduino SPI pins as usual and use pin 7 as CS.
+ *
+ * Refer to the wiki at https://github.com/DhrBaksteen/ArduinoOPL2/wiki/Connecting to learn how to connect your platform
+ * of choice!
+ *
+ * By default this example will look for the song.cmf file in the root of the SD card. For more information about the
+ * CMF file format please visit http://www.shikadi.net/moddingwiki/CMF_Format
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <SPI.h>
+#include <SD.h>
+#include <OPL2.h>
+#include <CMFPlayer.h>
+
+
+OPL2 opl2;
+CMFPlayer player(&opl2);
+File cmfFile;
+
+
+/**
+ * Read a block of song data from SD card. The player reads whole blocks, so the file only needs to be repositioned
+ * when the song loops.
+ */
+int readSong(unsigned long offset, byte *buffer, unsigned int length) {
+	if (cmfFile.position() != offset) {
+		cmfFile.seek(offset);
+	}
+	return cmfFile.read(buffer, length);
+}
+
+
+void setup() {
+	Serial.begin(9600);
+	opl2.begin();
+
+	if (!SD.begin(7)) {
+		Serial.println(F("SD card not found"));
+		return;
+	}
+
+	cmfFile = SD.open("song.cmf", FILE_READ);
+	if (!cmfFile || !player.load(readSong)) {
+		Serial.println(F("Unable to load song.cmf"));
+		return;
+	}
+
+	player.setLoop(true);
+}
+
+
+void loop() {
+	player.update();
+}
@@ -0,0 +1,87 @@
+/**
+ * This is an example sketch from the OPL2 library for Arduino. It plays music from Doom and other games using the Doom
+ * engine from SD card using the YM3812 audio chip. These games store their music in MUS format and their instruments in
+ * the GENMIDI.OP2 instrument bank. Both can be extracted from the WAD file of the game with a WAD editor.
+ *
+ * OPL2 board is connected as follows:
+ *   Pin  8 - Reset
+ *   Pin  9 - A0
+ *   Pin 10 - Latch
+ *   Pin 11 - Data
+ *   Pin 13 - Shift
+ *
+ * Connect the SD card with Arduino SPI pins as usual and use pin 7 as CS.
+ *
+ * Refer to the wiki at https://github.com/DhrBaksteen/ArduinoOPL2/wiki/Connecting to learn how to connect your platform
+ * of choice!
+ *
+ * By default this example will look for the song.mus and genmidi.op2 files in the root of the SD card. When an OPL3
+ * Duo is used instead pass an OPL3Duo instance to the player and double voice instruments will be played as 4-OP
+ * instruments where possible. For more information about the MUS and GENMIDI formats please visit the ModdingWiki at
+ * http://www.shikadi.net/moddingwiki
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <SPI.h>
+#include <SD.h>
+#include <OPL2.h>
+#include <MUSPlayer.h>
+
+
+OPL2 opl2;
+MUSPlayer player(&opl2);
+File musFile;
+File bankFile;
+
+
+/**
+ * Read a block of the song from SD card.
+ */
+int readSong(unsigned long offset, byte *buffer, unsigned int length) {
+	if (musFile.position() != offset) {
+		musFile.seek(offset);
+	}
+	return musFile.read(buffer, length);
+}
+
+
+/**
+ * Read from the GENMIDI bank on SD card. The bank is only read while the song is being loaded.
+ */
+int readBank(unsigned long offset, byte *buffer, unsigned int length) {
+	if (bankFile.position() != offset) {
+		bankFile.seek(offset);
+	}
+	return bankFile.read(buffer, length);
+}
+
+
+void setup() {
+	Serial.begin(9600);
+	opl2.begin();
+
+	if (!SD.begin(7)) {
+		Serial.println(F("SD card not found"));
+		return;
+	}
+
+	musFile = SD.open("song.mus", FILE_READ);
+	bankFile = SD.open("genmidi.op2", FILE_READ);
+	if (!musFile || !bankFile || !player.load(readSong, readBank)) {
+		Serial.println(F("Unable to load song.mus or genmidi.op2"));
+		return;
+	}
+	bankFile.close();
+
+	Serial.print(player.getNumInstruments());
+	Serial.println(F(" instruments loaded"));
+	player.setLoop(true);
+}
+
+
+void loop() {
+	player.update();
+}
@@ -0,0 +1,63 @@
+/**
+ * This is an example sketch from the OPL2 library for Arduino. It plays a Reality Adlib Tracker (RAD) song from program
+ * memory using the YM3812 audio chip and the RADPlayer of the library. RAD v1 and v2.1 songs are supported.
+ *
+ * OPL2 board is connected as follows:
+ *   Pin  8 - Reset
+ *   Pin  9 - A0
+ *   Pin 10 - Latch
+ *   Pin 11 - Data
+ *   Pin 13 - Shift
+ *
+ * Refer to the wiki at https://github.com/DhrBaksteen/ArduinoOPL2/wiki/Connecting to learn how to connect your platform
+ * of choice!
+ *
+ * The song adlibsp.rad is included in adlibsp.h as an array in program memory, so no SD card is needed. To play
+ * another song convert its RAD file to a C array, for example with 'xxd -i song.rad', and declare the array as PROGMEM.
+ * To play RAD files from SD card see the PlayRAD example, where the files adlibsp.rad, shoot.rad and action.rad are
+ * found as well. For more information about the RAD file format download the Reality Adlib Tracker from
+ * http://www.pouet.net/prod.php?which=48994
+ *
+ * While the song plays the longest time spent on a single tick is reported over serial, so you can see how much of the
+ * CPU is left for your sketch.
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl) 2018-04-30
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <OPL2.h>
+#include <RADPlayer.h>
+#include "adlibsp.h"
+
+
+OPL2 opl2;
+RADPlayer player(&opl2);
+unsigned long reportTime = 0;
+
+
+void setup() {
+	Serial.begin(9600);
+	opl2.begin();
+
+	if (!player.load(adlibsp, true)) {
+		Serial.println(F("Not a RAD song"));
+		return;
+	}
+
+	player.setLoop(true);
+}
+
+
+void loop() {
+	player.update();
+
+	if (millis() - reportTime >= 5000) {
+		reportTime = millis();
+		Serial.print(F("Max tick time: "));
+		Serial.print(player.getMaxTickCpuTime());
+		Serial.print(F("us of "));
+		Serial.print(player.getTickDuration());
+		Serial.println(F("us"));
+	}
+}
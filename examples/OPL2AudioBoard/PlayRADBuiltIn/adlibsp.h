@@ -0,0 +1,187 @@
+/**
+ * Contents of adlibsp.rad to be played from program memory.
+ */
+
+const unsigned char adlibsp[2892] PROGMEM = {
+	0x52, 0x41, 0x44, 0x20, 0x62, 0x79, 0x20, 0x52, 0x45, 0x41, 0x4C, 0x69, 0x54, 0x59, 0x21, 0x21,
+	0x10, 0x86, 0x53, 0x74, 0x61, 0x72, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x42, 0x42, 0x53, 0x20, 0x49,
+	0x6E, 0x74, 0x72, 0x6F, 0x74, 0x75, 0x6E, 0x65, 0x01, 0x01, 0x42, 0x79, 0x20, 0x50, 0x75, 0x72,
+	0x70, 0x6C, 0x65, 0x20, 0x4D, 0x6F, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x46, 0x43, 0x20, 0x2D, 0x20,
+	0x31, 0x39, 0x39, 0x32, 0x01, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x70, 0x75, 0x72,
+	0x65, 0x20, 0x41, 0x64, 0x6C, 0x69, 0x62, 0x20, 0x73, 0x6F, 0x01, 0x64, 0x6F, 0x6E, 0x27, 0x74,
+	0x20, 0x67, 0x65, 0x74, 0x20, 0x65, 0x78, 0x63, 0x69, 0x74, 0x65, 0x64, 0x2E, 0x2E, 0x01, 0x01,
+	0x01, 0x43, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+	0x2E, 0x53, 0x33, 0x4D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6C,
+	0x65, 0x61, 0x73, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x22, 0x52, 0x41, 0x44, 0x22, 0x20, 0x62, 0x79,
+	0x20, 0x52, 0x45, 0x41, 0x4C, 0x49, 0x54, 0x59, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xD2, 0xF8,
+	0x1F, 0xF0, 0x0A, 0x00, 0x00, 0x02, 0xD0, 0x54, 0x02, 0x00, 0xF5, 0xF3, 0x7F, 0xFF, 0x0E, 0x00,
+	0x00, 0x03, 0x00, 0x0F, 0x40, 0x00, 0xE7, 0xF7, 0xF0, 0xF0, 0x08, 0x03, 0x00, 0x06, 0x00, 0x00,
+	0x01, 0x01, 0xF2, 0xF2, 0xF0, 0xF0, 0x00, 0x01, 0x02, 0x07, 0x63, 0x01, 0x00, 0x4C, 0xF3, 0xF2,
+	0xF0, 0x50, 0x0A, 0x01, 0x02, 0x08, 0x00, 0x00, 0x00, 0x08, 0xF4, 0xF8, 0x47, 0x26, 0x04, 0x00,
+	0x02, 0x09, 0x01, 0x00, 0x00, 0x06, 0xE5, 0xFF, 0xF0, 0x23, 0x00, 0x00, 0x01, 0x0A, 0x40, 0x50,
+	0x00, 0x00, 0xF6, 0xF2, 0x16, 0x52, 0x0E, 0x00, 0x03, 0x0B, 0x00, 0x0F, 0x07, 0x00, 0xE5, 0xF3,
+	0xF0, 0xF0, 0x0A, 0x03, 0x00, 0x0C, 0x45, 0x40, 0x01, 0x80, 0xF4, 0x82, 0x1A, 0xF0, 0x04, 0x01,
+	0x03, 0x0D, 0xC1, 0x41, 0x00, 0x09, 0xF3, 0xFF, 0xF0, 0x10, 0x08, 0x01, 0x02, 0x0E, 0xC1, 0x41,
+	0x03, 0x09, 0xF3, 0xFF, 0xF0, 0x60, 0x08, 0x00, 0x02, 0x0F, 0xC2, 0x41, 0x00, 0x06, 0xF2, 0x23,
+	0xF0, 0xF0, 0x04, 0x00, 0x01, 0x10, 0x00, 0x0F, 0x48, 0x00, 0xE7, 0xF7, 0xF0, 0xF0, 0x08, 0x03,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x02, 0x03, 0x98, 0x01, 0xEB, 0x03, 0x5C, 0x06, 0xD1, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x1C, 0x40, 0x01, 0x34, 0x3C,
+	0x40, 0x02, 0x34, 0x7C, 0x40, 0x03, 0x3B, 0x7C, 0x40, 0x04, 0x34, 0x1C, 0x40, 0x05, 0x24, 0x60,
+	0x06, 0x54, 0x8C, 0x40, 0x87, 0x34, 0xCC, 0x2D, 0x01, 0x87, 0x44, 0xCC, 0x2D, 0x02, 0x00, 0x34,
+	0x10, 0x01, 0xB4, 0x00, 0x04, 0x34, 0x10, 0x06, 0x54, 0x8C, 0x2D, 0x87, 0x3B, 0xCC, 0x27, 0x03,
+	0x06, 0x54, 0x8C, 0x37, 0x87, 0x42, 0xCC, 0x2D, 0x04, 0x00, 0x34, 0x10, 0x81, 0xB4, 0x00, 0x05,
+	0x06, 0x54, 0x8C, 0x2D, 0x87, 0x42, 0xCC, 0x27, 0x06, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04,
+	0x24, 0x82, 0x40, 0x06, 0x54, 0x8C, 0x32, 0x87, 0x44, 0xCC, 0x2D, 0x08, 0x00, 0x34, 0x10, 0x01,
+	0x34, 0x30, 0x04, 0x24, 0x82, 0x40, 0x87, 0x44, 0xCC, 0x27, 0x09, 0x87, 0x3B, 0xCC, 0x2D, 0x0A,
+	0x00, 0x34, 0x10, 0x81, 0xB4, 0x00, 0x0B, 0x87, 0x3B, 0xCC, 0x27, 0x0C, 0x00, 0x34, 0x10, 0x01,
+	0xB4, 0x00, 0x06, 0x22, 0xCC, 0x40, 0x87, 0x39, 0xCC, 0x2D, 0x0E, 0x00, 0x34, 0x10, 0x01, 0x44,
+	0xB0, 0x06, 0x22, 0xCC, 0x40, 0x87, 0x39, 0xCC, 0x27, 0x0F, 0x01, 0xB4, 0x00, 0x06, 0x24, 0xCC,
+	0x40, 0x87, 0x37, 0xCC, 0x2D, 0x10, 0x00, 0x32, 0x10, 0x01, 0x34, 0x30, 0x04, 0x34, 0x10, 0x86,
+	0x22, 0xCC, 0x37, 0x11, 0x87, 0x37, 0xCC, 0x27, 0x12, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04,
+	0x34, 0x10, 0x86, 0x22, 0xCC, 0x37, 0x13, 0x86, 0x24, 0xCC, 0x37, 0x14, 0x00, 0x34, 0x10, 0x81,
+	0xB4, 0x00, 0x16, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x84, 0x24, 0x82, 0x40, 0x17, 0x05, 0x54,
+	0x9C, 0x32, 0x06, 0x57, 0x9C, 0x32, 0x87, 0x5B, 0x9C, 0x32, 0x18, 0x00, 0x34, 0x10, 0x01, 0x34,
+	0x30, 0x04, 0x24, 0x82, 0x40, 0x05, 0x54, 0x9C, 0x40, 0x06, 0x57, 0x9C, 0x40, 0x87, 0x5B, 0x9C,
+	0x40, 0x1A, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x84, 0x34, 0x10, 0x1B, 0x05, 0x54, 0x9C, 0x40,
+	0x06, 0x49, 0x9C, 0x40, 0x87, 0x47, 0x9C, 0x40, 0x1D, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x84,
+	0x34, 0x10, 0x1E, 0x05, 0x54, 0x9C, 0x32, 0x06, 0x4B, 0x9C, 0x32, 0x87, 0x44, 0x9C, 0x32, 0x1F,
+	0x00, 0x34, 0x10, 0x81, 0xB4, 0x00, 0x20, 0x00, 0x34, 0x10, 0x01, 0x34, 0x30, 0x04, 0x34, 0x10,
+	0x87, 0x54, 0xAC, 0x2D, 0x21, 0x05, 0x54, 0x9C, 0x28, 0x06, 0x4B, 0x9C, 0x28, 0x87, 0x54, 0xAC,
+	0x28, 0x22, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x34, 0x10, 0x87, 0x54, 0xAC, 0x1E, 0x23,
+	0x87, 0x54, 0xAC, 0x2D, 0x24, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x87, 0x54, 0xAC, 0x28, 0x25,
+	0x87, 0x54, 0xAC, 0x1E, 0x26, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x24, 0x82, 0x40, 0x87,
+	0x54, 0xAC, 0x2D, 0x27, 0x87, 0x54, 0xAC, 0x28, 0x28, 0x00, 0x34, 0x10, 0x01, 0x34, 0x30, 0x02,
+	0x29, 0x7C, 0x40, 0x04, 0x24, 0x82, 0x40, 0x87, 0x54, 0xAC, 0x2D, 0x29, 0x87, 0x54, 0xAC, 0x28,
+	0x2A, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x87, 0x54, 0xAC, 0x1E, 0x2B, 0x03, 0x32, 0x7C, 0x40,
+	0x87, 0x54, 0xAC, 0x2D, 0x2C, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x87, 0x54, 0xAC, 0x28, 0x2D,
+	0x87, 0x54, 0xAC, 0x1E, 0x2E, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x02, 0x37, 0x7C, 0x40, 0x87,
+	0x54, 0xAC, 0x2D, 0x2F, 0x01, 0xB4, 0x00, 0x87, 0x54, 0xAC, 0x28, 0x30, 0x00, 0x32, 0x10, 0x01,
+	0x34, 0x30, 0x04, 0x34, 0x10, 0x87, 0x54, 0xAC, 0x00, 0x31, 0x83, 0x2C, 0x7C, 0x40, 0x32, 0x00,
+	0x34, 0x10, 0x01, 0xB4, 0x00, 0x84, 0x34, 0x10, 0x34, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x82,
+	0x35, 0x7C, 0x40, 0x36, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x84, 0x24, 0x82, 0x40, 0x37, 0x83,
+	0x3A, 0x7C, 0x40, 0x38, 0x00, 0x34, 0x10, 0x01, 0x34, 0x30, 0x84, 0x24, 0x82, 0x40, 0x3A, 0x00,
+	0x34, 0x10, 0x81, 0xB4, 0x00, 0x3C, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x04, 0x3C, 0x20, 0x87,
+	0x54, 0x8C, 0x40, 0x3D, 0x87, 0x4C, 0x8C, 0x32, 0x3E, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x87,
+	0x52, 0x8C, 0x40, 0xBF, 0x01, 0xB4, 0x00, 0x87, 0x54, 0x8C, 0x32, 0x00, 0x00, 0x34, 0x1C, 0x40,
+	0x01, 0x34, 0x3C, 0x40, 0x02, 0x34, 0x7C, 0x40, 0x03, 0x3B, 0x7C, 0x40, 0x04, 0x34, 0x1C, 0x40,
+	0x05, 0x24, 0x6C, 0x40, 0x07, 0x44, 0xEC, 0x40, 0x88, 0x54, 0x8C, 0x40, 0x01, 0x88, 0x56, 0x8C,
+	0x40, 0x02, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x34, 0x10, 0x07, 0x44, 0xF0, 0x88, 0x57,
+	0x8C, 0x40, 0x03, 0x88, 0x59, 0x8C, 0x40, 0x04, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x88, 0x56,
+	0x8C, 0x32, 0x05, 0x88, 0x59, 0x8C, 0x40, 0x06, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x24,
+	0x82, 0x40, 0x88, 0x5B, 0x8C, 0x40, 0x08, 0x00, 0x34, 0x10, 0x01, 0x34, 0x30, 0x04, 0x24, 0x82,
+	0x40, 0x88, 0x59, 0x8C, 0x37, 0x09, 0x88, 0x5B, 0x8C, 0x37, 0x0A, 0x00, 0x34, 0x10, 0x81, 0xB4,
+	0x00, 0x0B, 0x88, 0x59, 0x8C, 0x32, 0x0C, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x06, 0x22, 0xCC,
+	0x40, 0x88, 0x5B, 0x8C, 0x32, 0x0E, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x86, 0x22, 0xCC, 0x40,
+	0x0F, 0x01, 0xB4, 0x00, 0x06, 0x24, 0xCC, 0x40, 0x88, 0x64, 0x8C, 0x32, 0x10, 0x00, 0x32, 0x10,
+	0x01, 0x34, 0x30, 0x04, 0x34, 0x10, 0x06, 0x22, 0xCC, 0x37, 0x88, 0x64, 0x8C, 0x40, 0x12, 0x00,
+	0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x34, 0x10, 0x06, 0x22, 0xCC, 0x37, 0x88, 0x64, 0x8C, 0x2D,
+	0x13, 0x06, 0x24, 0xCC, 0x37, 0x88, 0x59, 0x8C, 0x40, 0x14, 0x00, 0x34, 0x10, 0x81, 0xB4, 0x00,
+	0x15, 0x88, 0x59, 0x8C, 0x2D, 0x16, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x24, 0x82, 0x40,
+	0x88, 0x5B, 0x8C, 0x40, 0x17, 0x05, 0x54, 0x9C, 0x32, 0x06, 0x57, 0x9C, 0x32, 0x07, 0x5B, 0x9C,
+	0x32, 0x88, 0x56, 0x8C, 0x32, 0x18, 0x00, 0x34, 0x10, 0x01, 0x34, 0x30, 0x04, 0x24, 0x82, 0x40,
+	0x05, 0x54, 0x9C, 0x40, 0x06, 0x57, 0x9C, 0x40, 0x07, 0x5B, 0x9C, 0x40, 0x88, 0x52, 0x8C, 0x40,
+	0x1A, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x04, 0x34, 0x10, 0x88, 0x52, 0x8C, 0x2D, 0x1B, 0x05,
+	0x54, 0x9C, 0x40, 0x06, 0x49, 0x9C, 0x40, 0x07, 0x47, 0x9C, 0x40, 0x88, 0x52, 0x8C, 0x37, 0x1D,
+	0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x04, 0x34, 0x10, 0x88, 0x52, 0x8C, 0x2D, 0x1E, 0x05, 0x54,
+	0x9C, 0x32, 0x06, 0x4B, 0x9C, 0x32, 0x07, 0x44, 0x9C, 0x32, 0x88, 0x54, 0x8C, 0x32, 0x1F, 0x00,
+	0x34, 0x10, 0x81, 0xB4, 0x00, 0x20, 0x00, 0x34, 0x10, 0x01, 0x34, 0x30, 0x04, 0x34, 0x10, 0x88,
+	0x4B, 0x8C, 0x40, 0x21, 0x05, 0x54, 0x9C, 0x28, 0x06, 0x4B, 0x9C, 0x28, 0x87, 0x44, 0x9C, 0x28,
+	0x22, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x34, 0x10, 0x88, 0x4B, 0x8C, 0x2D, 0x23, 0x88,
+	0x4B, 0x8C, 0x37, 0x24, 0x00, 0x34, 0x10, 0x81, 0xB4, 0x00, 0x25, 0x88, 0x4B, 0x8C, 0x2D, 0x26,
+	0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x24, 0x82, 0x40, 0x88, 0x4B, 0x8C, 0x32, 0x28, 0x00,
+	0x34, 0x10, 0x01, 0x34, 0x30, 0x02, 0x29, 0x70, 0x04, 0x24, 0x82, 0x40, 0x88, 0x4B, 0x8C, 0x2D,
+	0x2A, 0x00, 0x34, 0x10, 0x81, 0xB4, 0x00, 0x2B, 0x83, 0x32, 0x70, 0x2C, 0x00, 0x34, 0x10, 0x81,
+	0xB4, 0x00, 0x2E, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0, 0x82, 0x37, 0x70, 0x2F, 0x81, 0xB4, 0x00,
+	0x30, 0x00, 0x32, 0x10, 0x01, 0x34, 0x30, 0x03, 0x34, 0x70, 0x04, 0x34, 0x10, 0x05, 0x5B, 0x9C,
+	0x40, 0x06, 0x57, 0x9C, 0x40, 0x87, 0x54, 0x9C, 0x40, 0x32, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00,
+	0x84, 0x34, 0x10, 0x33, 0x05, 0x5B, 0x9C, 0x32, 0x06, 0x57, 0x9C, 0x32, 0x87, 0x54, 0x9C, 0x32,
+	0x34, 0x00, 0x34, 0x10, 0x81, 0xB4, 0x00, 0x36, 0x00, 0x34, 0x10, 0x01, 0xB4, 0x00, 0x04, 0x24,
+	0x82, 0x40, 0x05, 0x59, 0x9C, 0x40, 0x06, 0x55, 0x9C, 0x40, 0x87, 0x4C, 0x9C, 0x40, 0x38, 0x00,
+	0x34, 0x10, 0x01, 0x34, 0x30, 0x84, 0x24, 0x82, 0x40, 0x39, 0x05, 0x59, 0x9C, 0x32, 0x06, 0x55,
+	0x9C, 0x32, 0x87, 0x4C, 0x9C, 0x32, 0x3A, 0x00, 0x34, 0x10, 0x81, 0xB4, 0x00, 0x3C, 0x00, 0x34,
+	0x10, 0x01, 0x44, 0xB0, 0x05, 0x59, 0x9C, 0x2D, 0x06, 0x55, 0x9C, 0x2D, 0x07, 0x4C, 0x9C, 0x36,
+	0x88, 0x59, 0x8C, 0x32, 0x3D, 0x88, 0x5B, 0x8C, 0x37, 0x3E, 0x00, 0x34, 0x10, 0x01, 0x44, 0xB0,
+	0x88, 0x5C, 0x8C, 0x3C, 0xBF, 0x01, 0xB4, 0x00, 0x88, 0x64, 0x8C, 0x40, 0x00, 0x00, 0x36, 0x1C,
+	0x40, 0x01, 0x36, 0x3C, 0x40, 0x02, 0x36, 0x7C, 0x40, 0x03, 0x41, 0x7C, 0x40, 0x04, 0x36, 0x1C,
+	0x40, 0x05, 0x26, 0x60, 0x06, 0x31, 0xEC, 0x37, 0x07, 0x36, 0xEC, 0x37, 0x88, 0x61, 0x8C, 0x37,
+	0x01, 0x88, 0x64, 0x8C, 0x32, 0x02, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x04, 0x36, 0x10, 0x06,
+	0x31, 0xFC, 0x37, 0x07, 0x36, 0xFC, 0x37, 0x88, 0x66, 0x8C, 0x40, 0x04, 0x00, 0x36, 0x10, 0x01,
+	0xB6, 0x00, 0x88, 0x64, 0x8C, 0x40, 0x05, 0x88, 0x66, 0x8C, 0x40, 0x06, 0x00, 0x36, 0x10, 0x01,
+	0xB6, 0x00, 0x04, 0x26, 0x82, 0x40, 0x88, 0x64, 0x8C, 0x37, 0x07, 0x88, 0x66, 0x8C, 0x32, 0x08,
+	0x00, 0x36, 0x10, 0x01, 0x36, 0x30, 0x04, 0x26, 0x82, 0x40, 0x88, 0x61, 0x8C, 0x40, 0x0A, 0x00,
+	0x36, 0x10, 0x01, 0xB6, 0x00, 0x88, 0x61, 0x8C, 0x32, 0x0B, 0x88, 0x64, 0x8C, 0x40, 0x0C, 0x00,
+	0x36, 0x10, 0x01, 0xB6, 0x00, 0x86, 0x24, 0xCC, 0x40, 0x0D, 0x88, 0x64, 0x8C, 0x32, 0x0E, 0x00,
+	0x36, 0x10, 0x01, 0x46, 0xB0, 0x06, 0x24, 0xCC, 0x40, 0x88, 0x59, 0x8C, 0x40, 0x0F, 0x01, 0xB6,
+	0x00, 0x86, 0x26, 0xCC, 0x40, 0x10, 0x00, 0x34, 0x10, 0x01, 0x36, 0x30, 0x04, 0x36, 0x10, 0x06,
+	0x24, 0xCC, 0x37, 0x88, 0x59, 0x8C, 0x32, 0x12, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x02, 0x41,
+	0x70, 0x04, 0x36, 0x10, 0x86, 0x24, 0xCC, 0x37, 0x13, 0x86, 0x26, 0xCC, 0x37, 0x14, 0x00, 0x36,
+	0x10, 0x01, 0xB6, 0x00, 0x03, 0x36, 0x70, 0x88, 0x54, 0xFC, 0x37, 0x16, 0x00, 0x36, 0x10, 0x01,
+	0xB6, 0x00, 0x84, 0x26, 0x82, 0x40, 0x17, 0x05, 0x56, 0x9C, 0x32, 0x06, 0x59, 0x9C, 0x32, 0x87,
+	0x61, 0x9C, 0x32, 0x18, 0x00, 0x36, 0x10, 0x01, 0x36, 0x30, 0x04, 0x26, 0x82, 0x40, 0x05, 0x56,
+	0x9C, 0x40, 0x06, 0x59, 0x9C, 0x40, 0x87, 0x61, 0x9C, 0x40, 0x1A, 0x00, 0x36, 0x10, 0x01, 0x46,
+	0xB0, 0x04, 0x36, 0x10, 0x88, 0x53, 0xFC, 0x37, 0x1B, 0x05, 0x56, 0x9C, 0x40, 0x06, 0x4B, 0x9C,
+	0x40, 0x87, 0x49, 0x9C, 0x40, 0x1D, 0x00, 0x36, 0x10, 0x01, 0x46, 0xB0, 0x84, 0x36, 0x10, 0x1E,
+	0x05, 0x56, 0x9C, 0x32, 0x06, 0x51, 0x9C, 0x32, 0x87, 0x46, 0x9C, 0x32, 0x1F, 0x00, 0x36, 0x10,
+	0x81, 0xB6, 0x00, 0x20, 0x00, 0x36, 0x10, 0x01, 0x36, 0x30, 0x04, 0x36, 0x10, 0x88, 0x49, 0xFC,
+	0x37, 0x21, 0x05, 0x56, 0x9C, 0x28, 0x06, 0x51, 0x9C, 0x28, 0x87, 0x36, 0xCC, 0x32, 0x22, 0x00,
+	0x36, 0x10, 0x01, 0xB6, 0x00, 0x04, 0x36, 0x10, 0x87, 0x36, 0xCC, 0x40, 0x23, 0x87, 0x46, 0xCC,
+	0x40, 0x24, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x87, 0x56, 0xCC, 0x28, 0x25, 0x87, 0x36, 0xCC,
+	0x37, 0x26, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x04, 0x26, 0x82, 0x40, 0x07, 0x46, 0xCC, 0x37,
+	0x88, 0x49, 0xFC, 0x32, 0x27, 0x87, 0x56, 0xCC, 0x28, 0x28, 0x00, 0x36, 0x10, 0x01, 0x36, 0x30,
+	0x02, 0x2B, 0x70, 0x04, 0x26, 0x82, 0x40, 0x87, 0x36, 0xCC, 0x32, 0x29, 0x87, 0x46, 0xCC, 0x32,
+	0x2A, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x87, 0x56, 0xCC, 0x1E, 0x2B, 0x83, 0x34, 0x70, 0x2C,
+	0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x88, 0x49, 0xFC, 0x2D, 0x2E, 0x00, 0x36, 0x10, 0x01, 0x46,
+	0xB0, 0x82, 0x39, 0x70, 0x2F, 0x81, 0xB6, 0x00, 0x30, 0x00, 0x34, 0x10, 0x01, 0x36, 0x30, 0x03,
+	0x36, 0x70, 0x04, 0x36, 0x10, 0x05, 0x61, 0x9C, 0x40, 0x06, 0x59, 0x9C, 0x40, 0x07, 0x56, 0x9C,
+	0x40, 0x88, 0x36, 0xDC, 0x3C, 0x32, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x84, 0x36, 0x10, 0x33,
+	0x05, 0x61, 0x9C, 0x32, 0x06, 0x59, 0x9C, 0x32, 0x87, 0x56, 0x9C, 0x32, 0x34, 0x00, 0x36, 0x10,
+	0x81, 0xB6, 0x00, 0x36, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x04, 0x26, 0x82, 0x40, 0x05, 0x5B,
+	0x9C, 0x40, 0x06, 0x57, 0x9C, 0x40, 0x07, 0x52, 0x9C, 0x40, 0x88, 0x34, 0xDC, 0x3C, 0x38, 0x00,
+	0x36, 0x10, 0x01, 0x36, 0x30, 0x03, 0x44, 0x70, 0x84, 0x26, 0x82, 0x40, 0x39, 0x05, 0x5B, 0x9C,
+	0x32, 0x06, 0x57, 0x9C, 0x32, 0x87, 0x52, 0x9C, 0x32, 0x3A, 0x00, 0x36, 0x10, 0x81, 0xB6, 0x00,
+	0x3C, 0x00, 0x36, 0x10, 0x01, 0x46, 0xB0, 0x02, 0x39, 0x70, 0x05, 0x5B, 0x9C, 0x2D, 0x06, 0x57,
+	0x9C, 0x2D, 0x87, 0x52, 0x9C, 0x2D, 0x3E, 0x00, 0x36, 0x10, 0x81, 0x46, 0xB0, 0xBF, 0x81, 0xB6,
+	0x00, 0x00, 0x00, 0x36, 0x10, 0x01, 0x36, 0x3C, 0x40, 0x02, 0x36, 0x70, 0x04, 0x36, 0x10, 0x05,
+	0x26, 0x60, 0x06, 0x56, 0x9C, 0x40, 0x07, 0x5B, 0x9C, 0x40, 0x88, 0x48, 0xF0, 0x01, 0x88, 0x49,
+	0xF0, 0x02, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x03, 0x41, 0x70, 0x04, 0x36, 0x10, 0x06, 0x59,
+	0x9C, 0x40, 0x07, 0x61, 0x9C, 0x40, 0x88, 0x48, 0xF0, 0x04, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00,
+	0x82, 0x39, 0x70, 0x06, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x03, 0x3B, 0x70, 0x04, 0x26, 0x82,
+	0x40, 0x06, 0x56, 0x9C, 0x37, 0x87, 0x5B, 0x9C, 0x37, 0x08, 0x00, 0x36, 0x10, 0x01, 0x36, 0x30,
+	0x02, 0x46, 0x70, 0x04, 0x26, 0x82, 0x40, 0x06, 0x59, 0x9C, 0x32, 0x87, 0x61, 0x9C, 0x32, 0x0A,
+	0x00, 0x36, 0x10, 0x81, 0xB6, 0x00, 0x0B, 0x83, 0x46, 0x7C, 0x32, 0x0C, 0x00, 0x36, 0x10, 0x01,
+	0xB6, 0x00, 0x06, 0x24, 0xCC, 0x40, 0x88, 0x44, 0xF0, 0x0E, 0x00, 0x36, 0x10, 0x01, 0x46, 0xB0,
+	0x06, 0x24, 0xCC, 0x40, 0x88, 0x46, 0xF0, 0x0F, 0x01, 0xB6, 0x00, 0x86, 0x26, 0xCC, 0x40, 0x10,
+	0x00, 0x34, 0x10, 0x01, 0x36, 0x30, 0x04, 0x36, 0x10, 0x86, 0x24, 0xCC, 0x37, 0x12, 0x00, 0x36,
+	0x10, 0x01, 0xB6, 0x00, 0x02, 0x41, 0x70, 0x04, 0x36, 0x10, 0x86, 0x24, 0xCC, 0x37, 0x13, 0x05,
+	0x56, 0x9C, 0x32, 0x06, 0x26, 0xCC, 0x37, 0x87, 0x61, 0x9C, 0x32, 0x14, 0x00, 0x36, 0x10, 0x01,
+	0xB6, 0x00, 0x03, 0x36, 0x70, 0x05, 0x56, 0x9C, 0x40, 0x06, 0x59, 0x9C, 0x40, 0x07, 0x61, 0x9C,
+	0x40, 0x88, 0x41, 0xF0, 0x16, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x84, 0x26, 0x82, 0x40, 0x17,
+	0x05, 0x56, 0x9C, 0x32, 0x06, 0x59, 0x9C, 0x32, 0x87, 0x61, 0x9C, 0x32, 0x18, 0x00, 0x36, 0x10,
+	0x01, 0x36, 0x30, 0x04, 0x26, 0x82, 0x40, 0x05, 0x56, 0x9C, 0x40, 0x06, 0x59, 0x9C, 0x40, 0x87,
+	0x61, 0x9C, 0x40, 0x1A, 0x00, 0x36, 0x10, 0x01, 0x46, 0xB0, 0x84, 0x36, 0x10, 0x1B, 0x05, 0x56,
+	0x9C, 0x40, 0x06, 0x4B, 0x9C, 0x40, 0x87, 0x49, 0x9C, 0x40, 0x1C, 0x88, 0x3B, 0xF0, 0x1D, 0x00,
+	0x36, 0x10, 0x01, 0x46, 0xB0, 0x84, 0x36, 0x10, 0x1E, 0x05, 0x56, 0x9C, 0x32, 0x06, 0x51, 0x9C,
+	0x32, 0x07, 0x46, 0x9C, 0x32, 0x88, 0x39, 0xF0, 0x1F, 0x00, 0x36, 0x10, 0x81, 0xB6, 0x00, 0x20,
+	0x00, 0x36, 0x10, 0x01, 0x36, 0x30, 0x04, 0x36, 0x10, 0x88, 0x3B, 0xF0, 0x21, 0x05, 0x56, 0x9C,
+	0x28, 0x06, 0x51, 0x9C, 0x28, 0x87, 0x46, 0x9C, 0x28, 0x22, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00,
+	0x84, 0x36, 0x10, 0x24, 0x00, 0x36, 0x10, 0x81, 0xB6, 0x00, 0x26, 0x00, 0x36, 0x10, 0x01, 0xB6,
+	0x00, 0x04, 0x26, 0x82, 0x40, 0x88, 0x34, 0xF0, 0x28, 0x00, 0x36, 0x10, 0x01, 0x36, 0x30, 0x02,
+	0x2B, 0x70, 0x04, 0x26, 0x82, 0x40, 0x86, 0x59, 0x9C, 0x40, 0x2A, 0x00, 0x36, 0x10, 0x01, 0xB6,
+	0x00, 0x87, 0x58, 0x9C, 0x40, 0x2B, 0x03, 0x34, 0x70, 0x86, 0x59, 0x9C, 0x32, 0x2C, 0x00, 0x36,
+	0x10, 0x01, 0xB6, 0x00, 0x86, 0x54, 0x9C, 0x40, 0x2D, 0x87, 0x58, 0x9C, 0x32, 0x2E, 0x00, 0x36,
+	0x10, 0x01, 0x46, 0xB0, 0x02, 0x39, 0x70, 0x87, 0x56, 0x9C, 0x40, 0x2F, 0x01, 0xB6, 0x00, 0x86,
+	0x54, 0x9C, 0x32, 0x30, 0x00, 0x34, 0x10, 0x01, 0x36, 0x30, 0x03, 0x36, 0x70, 0x04, 0x36, 0x10,
+	0x05, 0x61, 0x9C, 0x40, 0x06, 0x59, 0x9C, 0x40, 0x87, 0x56, 0x9C, 0x40, 0x31, 0x87, 0x56, 0x9C,
+	0x32, 0x32, 0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x84, 0x36, 0x10, 0x33, 0x05, 0x61, 0x9C, 0x32,
+	0x06, 0x59, 0x9C, 0x32, 0x87, 0x56, 0x9C, 0x32, 0x34, 0x00, 0x36, 0x10, 0x81, 0xB6, 0x00, 0x36,
+	0x00, 0x36, 0x10, 0x01, 0xB6, 0x00, 0x04, 0x26, 0x82, 0x40, 0x05, 0x5B, 0x9C, 0x40, 0x06, 0x57,
+	0x9C, 0x40, 0x87, 0x52, 0x9C, 0x40, 0x38, 0x00, 0x36, 0x10, 0x01, 0x36, 0x30, 0x03, 0x44, 0x70,
+	0x84, 0x26, 0x82, 0x40, 0x39, 0x05, 0x5B, 0x9C, 0x32, 0x06, 0x57, 0x9C, 0x32, 0x87, 0x52, 0x9C,
+	0x32, 0x3A, 0x00, 0x36, 0x10, 0x81, 0xB6, 0x00, 0x3B, 0x88, 0x52, 0x8C, 0x32, 0x3C, 0x00, 0x36,
+	0x10, 0x01, 0x46, 0xB0, 0x02, 0x39, 0x70, 0x05, 0x5B, 0x9C, 0x2D, 0x06, 0x57, 0x9C, 0x2D, 0x07,
+	0x52, 0x9C, 0x2D, 0x88, 0x52, 0x8C, 0x40, 0x3D, 0x88, 0x54, 0x80, 0x3E, 0x00, 0x36, 0x10, 0x01,
+	0x46, 0xB0, 0x88, 0x5B, 0x80, 0xBF, 0x01, 0xB6, 0x00, 0x88, 0x52, 0x80
+};
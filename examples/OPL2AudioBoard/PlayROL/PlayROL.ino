@@ -0,0 +1,85 @@
+/**
+ * This is an example sketch from the OPL2 library for Arduino. It plays an AdLib Visual Composer song (ROL) from SD card
+ * using the YM3812 audio chip. ROL songs do not contain their own instruments, but refer to instruments by name in an
+ * AdLib instrument bank (BNK). The instruments of the song are taken from the bank once when the song is loaded.
+ *
+ * OPL2 board is connected as follows:
+ *   Pin  8 - Reset
+ *   Pin  9 - A0
+ *   Pin 10 - Latch
+ *   Pin 11 - Data
+ *   Pin 13 - Shift
+ *
+ * Connect the SD card with Arduino SPI pins as usual and use pin 7 as CS.
+ *
+ * Refer to the wiki at https://github.com/DhrBaksteen/ArduinoOPL2/wiki/Connecting to learn how to connect your platform
+ * of choice!
+ *
+ * By default this example will look for the song.rol and standard.bnk files in the root of the SD card. For more
+ * information about the ROL and BNK file formats please visit the ModdingWiki at http://www.shikadi.net/moddingwiki
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <SPI.h>
+#include <SD.h>
+#include <OPL2.h>
+#include <ROLPlayer.h>
+
+
+OPL2 opl2;
+ROLPlayer player(&opl2);
+File rolFile;
+File bnkFile;
+
+
+/**
+ * Read a block of the song from SD card.
+ */
+int readSong(unsigned long offset, byte *buffer, unsigned int length) {
+	if (rolFile.position() != offset) {
+		rolFile.seek(offset);
+	}
+	return rolFile.read(buffer, length);
+}
+
+
+/**
+ * Read a block of the instrument bank from SD card. The bank is only read while the song is being loaded.
+ */
+int readBank(unsigned long offset, byte *buffer, unsigned int length) {
+	if (bnkFile.position() != offset) {
+		bnkFile.seek(offset);
+	}
+	return bnkFile.read(buffer, length);
+}
+
+
+void setup() {
+	Serial.begin(9600);
+	opl2.begin();
+
+	if (!SD.begin(7)) {
+		Serial.println(F("SD card not found"));
+		return;
+	}
+
+	rolFile = SD.open("song.rol", FILE_READ);
+	bnkFile = SD.open("standard.bnk", FILE_READ);
+	if (!rolFile || !bnkFile || !player.load(readSong, readBank)) {
+		Serial.println(F("Unable to load song.rol or standard.bnk"));
+		return;
+	}
+	bnkFile.close();
+
+	Serial.print(player.getNumInstruments());
+	Serial.println(F(" instruments loaded"));
+	player.setLoop(true);
+}
+
+
+void loop() {
+	player.update();
+}
@@ -0,0 +1,83 @@
+/**
+ * This is a demo sketch for the OPL2 library. It implements a simple 16-step drum sequencer on the percussion mode of
+ * the OPL2 using the rhythm engine. All drums of a step are hit together with a single register write, and the snare
+ * and tom keep their pitch when the hi-hat or cymbal that share their channel are hit at the same time. Steps are timed
+ * from the start of the sequence, so the tempo does not drift.
+ *
+ * OPL2 board is connected as follows:
+ *   Pin  8 - Reset
+ *   Pin  9 - A0
+ *   Pin 10 - Latch
+ *   Pin 11 - Data
+ *   Pin 13 - Shift
+ *
+ * Refer to the wiki at https://github.com/DhrBaksteen/ArduinoOPL2/wiki/Connecting to learn how to connect your platform
+ * of choice!
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <SPI.h>
+#include <OPL2.h>
+#include <Rhythm.h>
+#include <instruments.h>
+
+
+struct Pattern {
+	byte drum;
+	byte octave;
+	byte note;
+	byte steps[16];
+};
+
+const byte BPM = 110;
+const Pattern sequence[NUM_DRUM_SOUNDS] = {
+	{ DRUM_BASS,   4, NOTE_C, { 1,0,0,0,1,0,0,0,1,0,0,0,1,0,1,0 }},
+	{ DRUM_SNARE,  3, NOTE_C, { 0,0,1,0,0,0,1,0,0,0,1,0,0,0,1,1 }},
+	{ DRUM_TOM,    3, NOTE_A, { 0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1 }},
+	{ DRUM_CYMBAL, 3, NOTE_C, { 1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 }},
+	{ DRUM_HI_HAT, 3, NOTE_C, { 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1 }}
+};
+
+OPL2 opl2;
+Rhythm rhythm(&opl2);
+
+unsigned long tStep = 60000 / (BPM * 4);
+unsigned long tStart;
+unsigned long stepCount = 0;
+
+
+void setup() {
+	opl2.begin();
+	rhythm.begin();
+
+	// Instruments are only written to the OPL2 when their drum is first hit.
+	rhythm.setInstrument(DRUM_BASS,   opl2.loadInstrument(INSTRUMENT_BDRUM2));
+	rhythm.setInstrument(DRUM_SNARE,  opl2.loadInstrument(INSTRUMENT_RKSNARE1));
+	rhythm.setInstrument(DRUM_TOM,    opl2.loadInstrument(INSTRUMENT_TOM2));
+	rhythm.setInstrument(DRUM_CYMBAL, opl2.loadInstrument(INSTRUMENT_CYMBAL1));
+	rhythm.setInstrument(DRUM_HI_HAT, opl2.loadInstrument(INSTRUMENT_HIHAT2), 0.6);
+	rhythm.setPitchPolicy(RHYTHM_PITCH_TONAL);
+
+	tStart = millis();
+}
+
+
+void loop() {
+	// Hit all drums of the step and play them together.
+	byte step = stepCount % 16;
+	for (byte i = 0; i < NUM_DRUM_SOUNDS; i ++) {
+		if (sequence[i].steps[step]) {
+			rhythm.trigger(sequence[i].drum, sequence[i].octave, sequence[i].note);
+		}
+	}
+	rhythm.flush();
+	stepCount ++;
+
+	// Release drums while waiting for the next step.
+	while ((long)(tStart + stepCount * tStep - millis()) > 0) {
+		rhythm.update();
+	}
+}
@@ -0,0 +1,114 @@
+/**
+ * This is an example sketch from the OPL2 library for Arduino. It benchmarks the register write path of the board by
+ * playing digitized samples with the SamplePlayer. First it measures how many full register writes and how many data
+ * only writes can be made per second, where the latter is the highest sample rate the board can reach. Then it plays a
+ * 500 Hz tone as samples at increasing sample rates and reports the sample rate that was achieved and the number of
+ * samples that were late. Open the serial monitor at 9600 baud to see the results.
+ *
+ * OPL2 board is connected as follows:
+ *   Pin  8 - Reset
+ *   Pin  9 - A0
+ *   Pin 10 - Latch
+ *   Pin 11 - Data
+ *   Pin 13 - Shift
+ *
+ * To benchmark an OPL3 Duo! instead uncomment the USE_OPL3_DUO define below.
+ *
+ * Refer to the wiki at https://github.com/DhrBaksteen/ArduinoOPL2/wiki/Connecting to learn how to connect your platform
+ * of choice!
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+// #define USE_OPL3_DUO
+
+#include <SamplePlayer.h>
+#ifdef USE_OPL3_DUO
+	#include <OPL3Duo.h>
+	OPL3Duo opl;
+#else
+	#include <OPL2.h>
+	OPL2 opl;
+#endif
+
+
+#define NUM_WRITES     2000
+#define TONE_PERIOD      16		// Samples per period of the tone.
+#define PLAY_TIME         2		// Seconds to play at each sample rate.
+
+const unsigned int sampleRates[] = { 4000, 8000, 11025, 16000, 22050 };
+
+SamplePlayer player(&opl);
+byte tone[TONE_PERIOD];
+
+SAMPLEPLAYER_TIMER_ISR(player)
+
+
+/**
+ * Sample reader that repeats a single period of the tone.
+ */
+int readTone(unsigned long offset, byte *buffer, unsigned int length) {
+	for (unsigned int i = 0; i < length; i ++) {
+		buffer[i] = tone[(offset + i) % TONE_PERIOD];
+	}
+	return length;
+}
+
+
+void setup() {
+	Serial.begin(9600);
+	opl.begin();
+
+	for (byte i = 0; i < TONE_PERIOD; i ++) {
+		tone[i] = 128 + 100 * sin(i * 2.0 * PI / TONE_PERIOD);
+	}
+
+	// Full register writes select the register and then write its data.
+	unsigned long start = micros();
+	for (unsigned int i = 0; i < NUM_WRITES; i ++) {
+		opl.write(0x40, 0x3F);
+	}
+	reportRate(F("Full writes per second: "), NUM_WRITES, micros() - start);
+
+	// Data writes only write the data of the selected register, this is the highest rate samples can be played at.
+	player.begin();
+	start = micros();
+	for (unsigned int i = 0; i < NUM_WRITES; i ++) {
+		player.writeSample(0x80);
+	}
+	reportRate(F("Data writes per second: "), NUM_WRITES, micros() - start);
+
+	for (byte i = 0; i < sizeof(sampleRates) / sizeof(sampleRates[0]); i ++) {
+		unsigned long numSamples = (unsigned long)sampleRates[i] * PLAY_TIME;
+		player.play(readTone, numSamples, sampleRates[i]);
+		start = micros();
+		while (player.isPlaying()) {
+			player.update();
+		}
+		unsigned long duration = micros() - start;
+
+		Serial.print(F("Requested "));
+		Serial.print(sampleRates[i]);
+		Serial.print(F(" Hz, timer "));
+		Serial.print(player.getSampleRate());
+		Serial.print(F(" Hz, "));
+		reportRate(F("achieved "), numSamples, duration);
+		Serial.print(F("  Late samples: "));
+		Serial.println(player.getUnderruns());
+	}
+}
+
+
+void loop() {
+}
+
+
+/**
+ * Print the number of events per second.
+ */
+void reportRate(const __FlashStringHelper *label, unsigned long count, unsigned long duration) {
+	Serial.print(label);
+	Serial.println((unsigned long)(count * 1000000.0 / duration));
+}
@@ -28,14 +28,14 @@
 #include <MIDI.h>
 #include <SPI.h>
 #include <OPL2.h>
-#include <midi_instruments.h>
-#include <midi_drums.h>
+#include <midi_instrument_tables.h>
 
 //for USB MIDI, USBMIDI_CREATE_DEFAULT_INSTANCE(); - needs a Leonardo or Pro Micro
 MIDI_CREATE_DEFAULT_INSTANCE();
 
 #define MIDI_NUM_CHANNELS 16  
 #define MIDI_DRUM_CHANNEL 10
+#define DRUM_NOTE_BASE    28
 
 #define CONTROL_VOLUME          7
 #define CONTROL_ALL_SOUND_OFF 120
@@ -162,9 +162,8 @@ void onNoteOn(byte midiChannel, byte note, byte velocity) {
 	opl2ChannelMap[opl2Channel].noteVelocity = log(min((float)velocity, 127.0)) / log(127.0);
 
 	// For notes on drum channel the note determines the instrument to load.
-	if (midiChannel == MIDI_DRUM_CHANNEL && note >= DRUM_NOTE_BASE && note < DRUM_NOTE_BASE + NUM_MIDI_DRUMS) {
-		const unsigned char *instrumentDataPtr = midiDrums[note - DRUM_NOTE_BASE];
-		midiChannelMap[MIDI_DRUM_CHANNEL].instrument = opl2.loadInstrument(instrumentDataPtr);
+	if (midiChannel == MIDI_DRUM_CHANNEL && note >= DRUM_NOTE_BASE && note < DRUM_NOTE_BASE + midiDrumTable.numPrograms) {
+		midiChannelMap[MIDI_DRUM_CHANNEL].instrument = opl2.loadInstrument(midiDrumTable, note - DRUM_NOTE_BASE);
 	}
 
 	// Calculate octave and note number.
@@ -227,10 +226,9 @@ void onProgramChange(byte midiChannel, byte program) {
 	program = min(program, 127);
 	midiChannelMap[midiChannel].program = program;
 
-	// Fetch pointer to the instrument and load.
+	// Load the instrument from the instrument table.
 	if (midiChannel != MIDI_DRUM_CHANNEL) {
-		const unsigned char *instrumentDataPtr = midiInstruments[program];
-		midiChannelMap[midiChannel].instrument = opl2.loadInstrument(instrumentDataPtr);
+		midiChannelMap[midiChannel].instrument = opl2.loadInstrument(midiInstrumentTable, program);
 	}
 }
 
@@ -0,0 +1,42 @@
+/**
+ * This is a demonstration sketch for the OPL2 Audio Board. It demonstrates how the TuneParser plays music from command
+ * strings on an OPL2 using the 2-OP MIDI instruments.
+ *
+ * OPL2 board is connected as follows:
+ * Pin  8 - Reset
+ * Pin  9 - A0
+ * Pin 10 - Latch
+ * Pin 11 - Data
+ * Pin 13 - Shift
+ *
+ * Refer to the wiki at https://github.com/DhrBaksteen/ArduinoOPL2/wiki/Connecting to learn how to connect your platform
+ * of choice!
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <SPI.h>
+#include <OPL2.h>
+#include <midi_instruments.h>
+#include <TuneParser.h>
+
+const char voice1[] PROGMEM = "i0t150o5l8egredgrdcerc<b>er<ba>a<a>agdefefedr4.regredgrdcerc<b>er<ba>a<a>agdedcr4.";
+const char voice2[] PROGMEM = "i0o4l8crer<br>dr<ar>cr<grbrfr>cr<grbr>crer<gb>dgcrer<br>dr<ar>cr<grbrfr>cr<grbr>ceger4.";
+const char voice3[] PROGMEM = "i32o3l8r4gr4.gr4.er4.err4fr4.gr4.gr4.grr4gr4.er4.er4.frr4g";
+
+OPL2 opl2;
+TuneParser tuneParser(&opl2);
+
+
+void setup() {
+	// OPL2 is initialized by the TuneParser.
+	tuneParser.begin();
+}
+
+
+void loop() {
+	tuneParser.play(voice1, voice2, voice3);
+	delay(2000);
+}
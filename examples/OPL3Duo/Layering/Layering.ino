@@ -0,0 +1,48 @@
+/**
+ * This is a demonstration sketch for the OPL3 Duo! This example shows how the two synth units of the OPL3 Duo can be
+ * layered. With layering enabled every note that is played on synth unit 0 is also played slightly detuned on synth
+ * unit 1. Unit 0 plays on the left speaker and unit 1 on the right, which gives a wide stereo chorus. The sketch plays
+ * a short arpeggio, first with a single voice and then layered.
+ *
+ * Code by Maarten Janssen
+ * WWW.CHEERFUL.NL
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <OPL3Duo.h>
+#include <instruments.h>
+
+
+const byte notes[4] = { NOTE_C, NOTE_E, NOTE_G, NOTE_B };
+
+OPL3Duo opl3Duo;
+
+
+void setup() {
+	// Initialize the OPL3Duo! and enable OPL3 features (requered to enable panning support).
+	opl3Duo.begin();
+	opl3Duo.setOPL3Enabled(true);
+
+	Instrument instrument = opl3Duo.loadInstrument(INSTRUMENT_STRINGS1);
+	for (byte i = 0; i < 4; i ++) {
+		opl3Duo.setInstrument(i, instrument);
+	}
+}
+
+
+void loop() {
+	// Layering copies all registers of unit 0 to unit 1, so the instruments set up before are layered too.
+	opl3Duo.setLayering(!opl3Duo.isLayering());
+
+	for (byte i = 0; i < 4; i ++) {
+		opl3Duo.playNote(i, 4, notes[i]);
+		delay(300);
+	}
+	delay(1200);
+
+	for (byte i = 0; i < 4; i ++) {
+		opl3Duo.setKeyOn(i, false);
+	}
+	delay(1000);
+}
@@ -0,0 +1,64 @@
+/**
+ * This is an example sketch from the OPL2 library for Arduino. It plays a song in the OPL Compact Song format from SD
+ * card on the OPL3 Duo. Compact songs are converted on a PC from VGM, VGZ, DRO and IMF files with the oplconvert tool
+ * found in examples_pi/oplconvert:
+ *   oplconvert song.vgz song.ocs
+ *
+ * Songs for OPL2, dual OPL2, OPL3 and dual OPL3 can all be played on the OPL3 Duo. Because the conversion has already
+ * resolved all register banks and removed anything that is not needed for playback, song data is read from the SD
+ * card in large blocks and even dense OPL3 songs play smoothly on an Arduino Uno.
+ *
+ * Connect the SD card with Arduino SPI pins as usual and use pin 10 as CS.
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <SPI.h>
+#include <SD.h>
+#include <OPL3Duo.h>
+#include <CompactSong.h>
+
+
+OPL3Duo opl3Duo;
+CompactSong song(&opl3Duo);
+File songFile;
+
+
+/**
+ * Read a block of song data from SD card. The CompactSong player always reads whole blocks, so the file only needs
+ * to be repositioned when the song loops.
+ */
+int readSong(unsigned long offset, byte *buffer, unsigned int length) {
+	if (songFile.position() != offset) {
+		songFile.seek(offset);
+	}
+	return songFile.read(buffer, length);
+}
+
+
+void setup() {
+	Serial.begin(9600);
+	opl3Duo.begin();
+
+	if (!SD.begin(10)) {
+		Serial.println(F("SD card not found"));
+		return;
+	}
+
+	songFile = SD.open("song.ocs", FILE_READ);
+	if (!songFile || !song.load(readSong)) {
+		Serial.println(F("Unable to load song.ocs"));
+		return;
+	}
+
+	song.setLoop(true);
+}
+
+
+void loop() {
+	// Play everything that is due and return the number of us until the next register burst. There is plenty of time
+	// for other work in between.
+	song.update();
+}
@@ -0,0 +1,55 @@
+/**
+ * This is a demonstration sketch for the OPL3 Duo! It demonstrates how the TuneParser can play sound effects over
+ * music that loops in the background. The sound effect has a higher priority than the music, so it steals a channel from
+ * the music when all channels are in use. The music continues on that channel once the sound effect is done. A channel
+ * is reserved for the bass line, so the sound effect can never take it away.
+ *
+ * Code by Maarten Janssen
+ * WWW.CHEERFUL.NL
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <OPL3Duo.h>
+#include <midi_instruments_4op.h>
+#include <TuneParser.h>
+
+const char music1[] PROGMEM = "t120i44o3l16 frfrfrfrfrfrfrfr grgrgrgrgrgrgrgr  brbrbrbr arararar  grgrgrgrgrgrgrfr grgrgrgrgrgrgrgr";
+const char music2[] PROGMEM = "    i44o3l16 arararararararar brbrbrbrbrbrbrbr >drdrdrdr crcrcrcr <brbrbrbrbrbrbrar brbrbrbrbrbrbrbr";
+const char music3[] PROGMEM = "    i33o2l2  d d g f d d";
+const char coin[]   PROGMEM = "t200i9o6l32 b>e2";
+
+OPL3Duo opl3;
+TuneParser tuneParser(&opl3);
+Tune music;
+Tune soundEffect;
+
+
+void setup() {
+	// OPL3Duo is initialized by the TuneParser.
+	tuneParser.begin();
+	music = tuneParser.playBackground(music1, music2, music3);
+	soundEffect = tuneParser.playBackground(coin);
+	tuneParser.stopTune(soundEffect);
+
+	tuneParser.setPriority(soundEffect, 1);
+	tuneParser.reserveChannel(music, 0);
+}
+
+
+void loop() {
+	if (tuneParser.tuneEnded(music)) {
+		tuneParser.restartTune(music);
+	}
+
+	// Play the sound effect every 2 seconds.
+	static unsigned long nextSoundEffect = 2000;
+	if (millis() >= nextSoundEffect) {
+		tuneParser.restartTune(soundEffect);
+		nextSoundEffect += 2000;
+	}
+
+	// Both tunes are updated. They share the OPL3 Duo, so the sound effect can use any free channel.
+	tuneParser.update(music);
+	tuneParser.update(soundEffect);
+}
@@ -18,7 +18,9 @@ struct MidiChannel {
     float volume;                       // Channel volume.
     float modulation;                   // Channel modulation.
     float afterTouch;                   // Channel aftertouch.
-    unsigned long tAfterTouch;          // Aftertouch start.
+    bool portamento;                    // Glide from the previous note to new notes.
+    unsigned int portamentoRate;        // Glide speed in cents per second.
+    byte lastNote;                      // Last note played on this MIDI channel.
 };
 
 
@@ -53,6 +55,7 @@ byte getFreeMelodicChannel();
 byte getFreeDrumChannel();
 void playDrum(byte note, byte velocity);
 void playMelodic(byte midiChannel, byte note, byte velocity);
+void setVibrato(byte midiChannel);
 void setOplChannelVolume(byte channel4OP, byte midiChannel);
 void onNoteOff(byte midiChannel, byte note, byte velocity);
 void onNoteOn(byte midiChannel, byte note, byte velocity);
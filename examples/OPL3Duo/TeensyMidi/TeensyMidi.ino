@@ -4,39 +4,77 @@
  * should appear in the device list as 'OPL3Duo MIDI'. You can now use test the board with, for example, MIDI-OX, your
  * favorite music creation software or DosBox!
  *
+ * On a Teensy with a built-in SD card slot the melodic instruments are taken from bank.wopl in the root of the SD card
+ * when it is present. Any bank format of the InstrumentBank class can be used by changing BANK_FILE. Programs that the
+ * bank does not have use the built-in instruments.
+ *
  * Code by Maarten Janssen, 2020-06-20
  * WWW.CHEERFUL.NL
  * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
  */
 
 #include <SPI.h>
+#include <SD.h>
 #include <OPL3Duo.h>
+#include <Modulator.h>
+#include <Glide.h>
+#include <InstrumentBank.h>
 #include <midi_instruments_4op.h>
 #include <midi_drums.h>
 #include "TeensyMidi.h"
 
 
 #define CONTROL_MODULATION      1
+#define CONTROL_PORTAMENTO_TIME 5
 #define CONTROL_VOLUME          7
+#define CONTROL_PORTAMENTO     65
 #define CONTROL_ALL_SOUND_OFF 120
 #define CONTROL_RESET_ALL     121
 #define CONTROL_ALL_NOTES_OFF 123
-#define PI2 6.28318
+#define VIBRATO_RATE          5.0		// Vibrato frequency in Hz.
+#define VIBRATO_DEPTH          50		// Maximum vibrato depth in cents.
+#define BANK_FILE     "bank.wopl"		// Instrument bank on SD card that replaces the built-in instruments.
 
 
 
 OPL3Duo opl3;
+Modulator modulator(&opl3);
+Glide glide(&opl3);
+InstrumentBank bank;
+InstrumentBank *instrumentBank = NULL;
+File bankFile;
 
 MidiChannel midiChannels[NUM_MIDI_CHANNELS];
 OPLChannel melodicChannels[NUM_MELODIC_CHANNELS];
 OPLChannel drumChannels[NUM_DRUM_CHANNELS];
+byte vibratoRoutes[NUM_MELODIC_CHANNELS];
 unsigned long midiEventIndex = 0;
 
 
+/**
+ * Read a block of the instrument bank from SD card.
+ */
+int readBank(unsigned long offset, byte *buffer, unsigned int length) {
+	if (bankFile.position() != offset) {
+		bankFile.seek(offset);
+	}
+	return bankFile.read(buffer, length);
+}
+
+
 /**
  * Register MIDI event handlers and initialize.
  */
 void setup() {
+	#if defined(BUILTIN_SDCARD)
+		if (SD.begin(BUILTIN_SDCARD)) {
+			bankFile = SD.open(BANK_FILE, FILE_READ);
+			if (bankFile && bank.open(readBank)) {
+				instrumentBank = &bank;
+			}
+		}
+	#endif
+
 	usbMIDI.setHandleNoteOn(onNoteOn);
 	usbMIDI.setHandleNoteOff(onNoteOff);
 	usbMIDI.setHandleProgramChange(onProgramChange);
@@ -49,25 +87,27 @@ void setup() {
 
 
 /**
- * Read and handle MIDI events.
+ * Read and handle MIDI events and update the vibrato of the melodic channels.
  */
 void loop() {
 	usbMIDI.read();
+	modulator.update();
+	glide.update();
+}
 
-	for (byte i = 0; i < NUM_MELODIC_CHANNELS; i ++) {
-		byte midiChannel = melodicChannels[i].midiChannel;
-		float modulation = max(
-			midiChannels[midiChannel].modulation,
-			midiChannels[midiChannel].afterTouch
-		);
 
-		if (modulation > 0.0) {
-			float tModulation  = (millis() - midiChannels[midiChannel].tAfterTouch) * (PI2 / 200);
-			byte controlChannel = opl3.get4OPControlChannel(i);
-			byte baseNote = (melodicChannels[i].note % 12) + 2;
-			float fModulation = (notePitches[baseNote + 1] - notePitches[baseNote]) * modulation;
-			float fDelta = (1.0 - ((cos(tModulation) * 0.5) + 0.5)) * fModulation;
-			opl3.setFNumber(controlChannel, notePitches[baseNote] + fDelta);
+/**
+ * Set the vibrato depth of all melodic channels playing the given MIDI channel from its modulation and aftertouch.
+ */
+void setVibrato(byte midiChannel) {
+	float modulation = max(
+		midiChannels[midiChannel].modulation,
+		midiChannels[midiChannel].afterTouch
+	);
+
+	for (byte i = 0; i < NUM_MELODIC_CHANNELS; i ++) {
+		if (melodicChannels[i].midiChannel == midiChannel) {
+			modulator.setDepth(vibratoRoutes[i], modulation * VIBRATO_DEPTH);
 		}
 	}
 }
@@ -148,14 +188,22 @@ void playMelodic(byte midiChannel, byte note, byte velocity) {
 		}
 		setOplChannelVolume(oplChannelIndex, midiChannel);
 
+		byte controlChannel = opl3.get4OPControlChannel(oplChannelIndex);
+		modulator.resetPhase(controlChannel);
+		setVibrato(midiChannel);
+
+		// With portamento on the note starts at the previous note of the MIDI channel and glides to the new note.
 		note = max(24, min(note, 119));
-		byte octave = 1 + (note - 24) / 12;
-		note = note % 12;
-		opl3.playNote(
-			opl3.get4OPControlChannel(oplChannelIndex),
-			octave,
-			note
-		);
+		byte lastNote = midiChannels[midiChannel].lastNote;
+		midiChannels[midiChannel].lastNote = note;
+		if (midiChannels[midiChannel].portamento && lastNote != VALUE_UNDEFINED) {
+			opl3.playNote(controlChannel, 1 + (lastNote - 24) / 12, lastNote % 12);
+			glide.setRate(controlChannel, midiChannels[midiChannel].portamentoRate);
+			glide.glideToNote(controlChannel, 1 + (note - 24) / 12, note % 12);
+		} else {
+			glide.stop(controlChannel);
+			opl3.playNote(controlChannel, 1 + (note - 24) / 12, note % 12);
+		}
 	}
 }
 
@@ -310,16 +358,21 @@ void onNoteOn(byte midiChannel, byte note, byte velocity) {
 
 
 /**
- * Handle program changes. If the progranm change occurs on a melodic channel then load the instrument and store it with
- * the MIDI channel.
+ * Handle program changes. If the progranm change occurs on a melodic channel then load the instrument from the
+ * instrument bank, or the built-in instruments if there is no bank, and store it with the MIDI channel.
  */
 void onProgramChange(byte midiChannel, byte program) {
 	midiChannel = midiChannel % NUM_MIDI_CHANNELS;
 
 	if (midiChannel != MIDI_DRUM_CHANNEL) {
 		program = program % 128;
-		const unsigned char *instrumentDataPtr = midiInstruments[program];
-		Instrument4OP instrument = opl3.loadInstrument4OP(instrumentDataPtr);
+		const byte *bankData = instrumentBank != NULL ? instrumentBank->getInstrument(program) : NULL;
+		Instrument4OP instrument;
+		if (bankData != NULL) {
+			instrument = opl3.loadInstrument4OP(bankData, INSTRUMENT_DATA_SRAM);
+		} else {
+			instrument = opl3.loadInstrument4OP(midiInstruments[program]);
+		}
  
 		midiChannels[midiChannel].program = program;
 		midiChannels[midiChannel].instrument = instrument;
@@ -338,6 +391,19 @@ void onControlChange(byte midiChannel, byte control, byte value) {
 		// Change channel modulation.
 		case CONTROL_MODULATION: {
 			midiChannels[midiChannel].modulation = value / 127.0;
+			setVibrato(midiChannel);
+			break;
+		}
+
+		// Change the glide speed of the MIDI channel, from an octave in 0.1 seconds to an octave in 1.4 seconds.
+		case CONTROL_PORTAMENTO_TIME: {
+			midiChannels[midiChannel].portamentoRate = 120000 / (value + 10);
+			break;
+		}
+
+		// Switch portamento on or off.
+		case CONTROL_PORTAMENTO: {
+			midiChannels[midiChannel].portamento = value >= 64;
 			break;
 		}
 
@@ -357,6 +423,7 @@ void onControlChange(byte midiChannel, byte control, byte value) {
 		case CONTROL_RESET_ALL:
 			for (byte i = 0; i < NUM_MIDI_CHANNELS; i ++) {
 				midiChannels[i].volume = log(127.0 * 0.8) / log(127.0);
+				midiChannels[i].portamento = false;
 			}
 			break;
 
@@ -419,10 +486,9 @@ void onPitchChange(byte midiChannel, int pitch) {
 
 
 void onAfterTouch(byte midiChannel, byte pressure) {
-	if (midiChannels[midiChannel].afterTouch == 0.0) {
-		midiChannels[midiChannel].tAfterTouch = millis();
-	}
+	midiChannel = midiChannel % NUM_MIDI_CHANNELS;
 	midiChannels[midiChannel].afterTouch = pressure / 127.0;
+	setVibrato(midiChannel);
 }
 
 
@@ -445,7 +511,9 @@ void onSystemReset() {
 		midiChannels[i].volume = defaultVolume;
 		midiChannels[i].modulation = 0.0;
 		midiChannels[i].afterTouch = 0.0;
-		midiChannels[i].tAfterTouch = 0;
+		midiChannels[i].portamento = false;
+		midiChannels[i].portamentoRate = 120000 / 10;
+		midiChannels[i].lastNote = VALUE_UNDEFINED;
 	}
 
 	// Initialize melodic channels.
@@ -455,6 +523,10 @@ void onSystemReset() {
 		melodicChannels[i].program = VALUE_UNDEFINED;
 		melodicChannels[i].note = VALUE_UNDEFINED;
 		melodicChannels[i].noteVelocity = 0.0;
+
+		byte controlChannel = opl3.get4OPControlChannel(i);
+		modulator.removeRoutes(controlChannel);
+		vibratoRoutes[i] = modulator.addRoute(controlChannel, MOD_TARGET_PITCH, LFO_SINE, VIBRATO_RATE, 0);
 	}
 
 	// Initialize drum channels.
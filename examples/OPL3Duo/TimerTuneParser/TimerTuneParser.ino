@@ -0,0 +1,59 @@
+/**
+ * This is a demonstration sketch for the OPL3 Duo! It demonstrates how the TuneParser can play a piece of music from
+ * timer 1 of an AVR based Arduino. The music keeps in time while the sketch is busy, but the sketch must leave the OPL3
+ * Duo and the SPI bus alone while the tune is playing. The timer interrupt that plays the tune is added to the sketch with
+ * TUNEPARSER_TIMER_ISR.
+ *
+ * Code by Maarten Janssen
+ * WWW.CHEERFUL.NL
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <OPL3Duo.h>
+#include <midi_instruments_4op.h>
+#include <TuneParser.h>
+
+const char pattern1[] PROGMEM = "t133i44o3l16 frfrfrfrfrfrfrfr grgrgrgrgrgrgrgr  brbrbrbr arararar  grgrgrgrgrgrgrfr grgrgrgrgrgrgrgr";
+const char pattern2[] PROGMEM = "     i44o3l16 arararararararar brbrbrbrbrbrbrbr >drdrdrdr crcrcrcr <brbrbrbrbrbrbrar brbrbrbrbrbrbrbr";
+const char pattern3[] PROGMEM = "     i44o4l16 drdrdrdrdrdrdrdr drdrdrdrdrdrdrdr  grgrgrgr frfrfrfr  drdrdrdrdrdrdrdr drdrdrdrdrdrdrdr";
+
+OPL3Duo opl3;
+TuneParser tuneParser(&opl3);
+Tune tune;
+
+TUNEPARSER_TIMER_ISR(tuneParser)
+
+
+void setup() {
+	Serial.begin(9600);
+
+	// OPL3Duo is initialized by the TuneParser.
+	tuneParser.begin();
+	tune = tuneParser.playBackground(pattern1, pattern2, pattern3);
+
+	if (!tuneParser.startBackground(tune)) {
+		Serial.println(F("No timer available on this board"));
+	}
+}
+
+
+void loop() {
+	// When the tune has reached its end stop the timer to restart it.
+	if (tuneParser.tuneEnded(tune)) {
+		tuneParser.stopBackground();
+		tuneParser.restartTune(tune);
+		tuneParser.startBackground(tune);
+	}
+
+	// Do some heavy work, the music is not affected by it.
+	unsigned long start = millis();
+	float x = 0.0;
+	for (unsigned int i = 1; i < 2000; i ++) {
+		x += sqrt(i);
+	}
+	Serial.print(x);
+	Serial.print(F(" in "));
+	Serial.print(millis() - start);
+	Serial.println(F(" ms"));
+}
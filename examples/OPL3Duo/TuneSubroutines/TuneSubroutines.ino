@@ -0,0 +1,49 @@
+/**
+ * This is a demonstration sketch for the OPL3 Duo! It demonstrates how loops, subroutines and macros keep the command
+ * strings of the TuneParser short.
+ *
+ *   [ ... ]n - Play the commands between the brackets n times, or twice when n is omitted.
+ *              Octave and length changes carry over to the next pass, so o3 [c>]3 climbs like o3 c>c>c>.
+ *   $x       - Call subroutine x. Subroutines start in octave 4 with quarter notes, whatever the voice was playing.
+ *   !x       - Insert macro x. Macros are inserted as if they were part of the command string.
+ *
+ * Subroutines are compiled once and can be called from any voice, so a long tune only takes the space of its unique
+ * parts. Subroutines and macros share their names, so each letter names either a subroutine or a macro.
+ *
+ * Code by Maarten Janssen
+ * WWW.CHEERFUL.NL
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <OPL3Duo.h>
+#include <midi_instruments_4op.h>
+#include <TuneParser.h>
+
+const char arpeggio[]  PROGMEM = "o4l16 [ceg>c<]2 [dfa>d<]2";
+const char bassLine[]  PROGMEM = "o2l8 [c>c<]4 [d>d<]4";
+const char setup1[]    PROGMEM = "t120 i0 v12";
+const char setup2[]    PROGMEM = "i33 v15";
+
+const char voice1[] PROGMEM = "!x [$a]4 [$a $a]2";
+const char voice2[] PROGMEM = "!y [$b]4 [$b $b]2";
+
+OPL3Duo opl3;
+TuneParser tuneParser(&opl3);
+
+
+void setup() {
+	// OPL3Duo is initialized by the TuneParser.
+	tuneParser.begin();
+
+	tuneParser.defineSubroutine('a', arpeggio);
+	tuneParser.defineSubroutine('b', bassLine);
+	tuneParser.defineMacro('x', setup1);
+	tuneParser.defineMacro('y', setup2);
+}
+
+
+void loop() {
+	tuneParser.play(voice1, voice2);
+	delay(1000);
+}
@@ -17,8 +17,18 @@
 
 #include <OPL2.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
 #include <wiringPi.h>
-#include "midi_instruments.h"
+#include <midi_instruments.h>
+
+#define NS_PER_SECOND 1000000000LL
+#define MISSED_DEADLINE_NS 1000000LL
 
 
 const int noteDefs[21] = {
@@ -54,6 +64,11 @@ const char tuneData[3][200] = {
 OPL2 opl2;
 struct Tune music[3];
 
+unsigned long numWaits = 0;
+unsigned long numMissed = 0;
+long long totalLateness = 0;
+long long maxLateness = 0;
+
 
 float parseNumber(struct Tune *tune) {
 	float number = 0.0f;
@@ -156,9 +171,78 @@ void parseTune(struct Tune *tune) {
 }
 
 
+/**
+ * Run the main loop with realtime priority on the last CPU core and lock all memory, so that the tune is not delayed by
+ * other processes or page faults. Requires root, otherwise the tune plays with normal priority.
+ */
+void enableRealtime() {
+	struct sched_param schedParam;
+	schedParam.sched_priority = 80;
+	if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &schedParam) != 0) {
+		printf("Warning: No permission for realtime scheduling, are you running this as root?\n");
+	}
+
+	if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+		printf("Warning: Unable to lock memory.\n");
+	}
+
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(sysconf(_SC_NPROCESSORS_ONLN) - 1, &cpuSet);
+	pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+}
+
+
+/**
+ * Sleep until the given absolute deadline on CLOCK_MONOTONIC and record how late the main loop woke up, so timing
+ * jitter can be reported after the tune has played.
+ *
+ * @param deadline - The time to wake up.
+ */
+void waitUntil(struct timespec *deadline) {
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline, NULL) == EINTR);
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	long long lateness = (now.tv_sec - deadline->tv_sec) * NS_PER_SECOND + (now.tv_nsec - deadline->tv_nsec);
+	if (lateness < 0) {
+		lateness = 0;
+	}
+
+	numWaits ++;
+	totalLateness += lateness;
+	if (lateness > MISSED_DEADLINE_NS) {
+		numMissed ++;
+	}
+	if (lateness > maxLateness) {
+		maxLateness = lateness;
+	}
+}
+
+
+/**
+ * Print the measured timing jitter of the main loop.
+ */
+void reportJitter() {
+	if (numWaits > 0) {
+		printf("Timing jitter: average %.1f us, maximum %.1f us over %lu waits\n",
+			(totalLateness / numWaits) / 1000.0,
+			maxLateness / 1000.0,
+			numWaits);
+		printf("Missed deadlines: %lu\n", numMissed);
+	}
+}
+
+
 int main(int argc, char **argv) {
 	tempo = 120.0f;
 
+	for (int i = 1; i < argc; i ++) {
+		if (strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--realtime") == 0) {
+			enableRealtime();
+		}
+	}
+
 	// Initialize 3 channels of the tune.
 	for (int i = 0; i < 3; i ++) {
 		struct Tune channel;
@@ -181,6 +265,10 @@ int main(int argc, char **argv) {
 		opl2.setInstrument(i, piano);
 	}
 
+	// Tick every 1ms against an absolute deadline so the time spent parsing does not add up.
+	struct timespec tick;
+	clock_gettime(CLOCK_MONOTONIC, &tick);
+
 	int hasData = 1;
 	while(hasData) {
 		hasData = 0;
@@ -193,8 +281,15 @@ int main(int argc, char **argv) {
 			}
 			hasData += music[i].data[music[i].index];
 		}
-		delay(1);
+
+		tick.tv_nsec += 1000000;
+		if (tick.tv_nsec >= 1000000000) {
+			tick.tv_nsec -= 1000000000;
+			tick.tv_sec ++;
+		}
+		waitUntil(&tick);
 	}
 
+	reportJitter();
 	return 0;
 }
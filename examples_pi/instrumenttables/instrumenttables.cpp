@@ -0,0 +1,358 @@
+/**
+ * instrumenttables generates midi_instrument_tables.h from the instrument headers of the library. Every instrument is
+ * split into its transpose and its 2-OP voices. Identical voices are stored only once per table, so drums that only
+ * differ in their note and instruments that appear twice take up a few bytes instead of a full instrument. Programs
+ * refer to their voices by number, which replaces the pointer arrays of the headers that are kept in SRAM on AVR. When
+ * a table has hardly any duplicates and all programs share the same transpose the voices are stored in program order
+ * without any voice numbers, which is smaller.
+ *
+ * Run it from the root of the library after changing any of the instrument headers:
+ *   g++ -std=c++11 -Wall -o instrumenttables examples_pi/instrumenttables/instrumenttables.cpp
+ *   ./instrumenttables src/midi_instrument_tables.h midiInstrumentTable=src/midi_instruments.h ...
+ *
+ * This tool does not need WiringPi or an OPL board and can be built on any Linux machine.
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+#include <stdio.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "instrumenttables.h"
+
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		showHelp();
+		return 0;
+	}
+
+	std::vector<Table> tables;
+	for (int i = 2; i < argc; i ++) {
+		const char *separator = strchr(argv[i], '=');
+		if (separator == NULL) {
+			printf("Expected table=header instead of %s\n", argv[i]);
+			return 1;
+		}
+
+		Table table;
+		table.name = std::string(argv[i], separator - argv[i]);
+		table.fileName = separator + 1;
+
+		SourceHeader header;
+		if (!readHeader(separator + 1, header)) {
+			printf("Unable to read instruments from %s\n", separator + 1);
+			return 1;
+		}
+		if (!buildTable(header, table)) {
+			printf("Unable to build %s from %s\n", table.name.c_str(), separator + 1);
+			return 1;
+		}
+		tables.push_back(table);
+	}
+
+	FILE *file = fopen(argv[1], "w");
+	if (file == NULL) {
+		printf("Unable to write %s\n", argv[1]);
+		return 1;
+	}
+
+	fprintf(file, "/**\n");
+	fprintf(file, " * This file was generated by examples_pi/instrumenttables from the instrument headers of the library. Do not\n");
+	fprintf(file, " * edit it by hand, change the instrument headers and run instrumenttables again instead.\n");
+	fprintf(file, " *\n");
+	fprintf(file, " * Every table stores the unique 2-OP voices of its instruments once and per program the transpose followed by\n");
+	fprintf(file, " * the voice number of each 2-OP half. Load an instrument with OPL2.loadInstrument(table, program) or\n");
+	fprintf(file, " * OPL3.loadInstrument4OP(table, program). Tables that are not used by a sketch do not take up any flash.\n");
+	fprintf(file, " */\n\n");
+	fprintf(file, "#include \"OPL2.h\"\n\n");
+	fprintf(file, "#ifndef _MIDI_INSTRUMENT_TABLES_H_\n");
+	fprintf(file, "\t#define _MIDI_INSTRUMENT_TABLES_H_\n");
+	for (unsigned int i = 0; i < tables.size(); i ++) {
+		writeTable(file, tables[i]);
+	}
+	fprintf(file, "#endif\n");
+	fclose(file);
+
+	for (unsigned int i = 0; i < tables.size(); i ++) {
+		const Table &table = tables[i];
+		unsigned int numPrograms = table.voices.size() / table.voicesPerProgram;
+		if (!table.programs.empty()) {
+			numPrograms = table.programs.size();
+		}
+		printf("%-26s %3u programs, %3u voices, %5u bytes (was %5u bytes)\n", table.name.c_str(), numPrograms,
+			(unsigned int)table.voices.size(), getTableSize(table), numPrograms * table.recordSize);
+	}
+
+	return 0;
+}
+
+
+/**
+ * Read the instrument arrays and the program pointer array from an instrument header. Instruments are expected to be
+ * declared as 'const unsigned char NAME[size] PROGMEM = { ... };' and the programs as
+ * 'const unsigned char *midiXxx[] = { NAME, ... };', like they are in the headers of the library.
+ */
+bool readHeader(const char *fileName, SourceHeader &header) {
+	FILE *file = fopen(fileName, "r");
+	if (file == NULL) {
+		return false;
+	}
+
+	std::string text;
+	char block[4096];
+	size_t numRead;
+	while ((numRead = fread(block, 1, sizeof(block), file)) > 0) {
+		text.append(block, numRead);
+	}
+	fclose(file);
+	header.fileName = fileName;
+
+	// Skip the comment at the start of the file, it describes the instrument format using the same keywords.
+	size_t position = text.find("*/");
+	position = position == std::string::npos ? 0 : position + 2;
+
+	while ((position = text.find("const unsigned char ", position)) != std::string::npos) {
+		position += 20;
+		size_t end = text.find(';', position);
+		if (end == std::string::npos) {
+			return false;
+		}
+		std::string declaration = text.substr(position, end - position);
+		position = end + 1;
+
+		// Skip constants like DRUM_NOTE_BASE that are not arrays.
+		size_t open = declaration.find('{');
+		size_t close = declaration.find('}');
+		size_t bracket = declaration.find('[');
+		if (open == std::string::npos || bracket == std::string::npos || bracket > open) {
+			continue;
+		}
+		if (close == std::string::npos) {
+			return false;
+		}
+		std::string values = declaration.substr(open + 1, close - open - 1);
+
+		if (declaration[0] == '*') {
+			// Program pointer array, a list of instrument names.
+			size_t start = 0;
+			while (start < values.size()) {
+				size_t comma = values.find(',', start);
+				if (comma == std::string::npos) {
+					comma = values.size();
+				}
+
+				std::string name;
+				for (size_t i = start; i < comma; i ++) {
+					if (isalnum(values[i]) || values[i] == '_') {
+						name += values[i];
+					}
+				}
+				if (!name.empty()) {
+					header.programs.push_back(name);
+				}
+				start = comma + 1;
+			}
+		} else {
+			std::string name = declaration.substr(0, bracket);
+			while (!name.empty() && isspace(name[name.size() - 1])) {
+				name.erase(name.size() - 1);
+			}
+
+			std::vector<unsigned char> bytes;
+			if (!parseBytes(values, bytes)) {
+				return false;
+			}
+			header.instruments[name] = bytes;
+		}
+	}
+
+	return header.programs.size() > 0;
+}
+
+
+/**
+ * Parse a comma separated list of hexadecimal or decimal byte values.
+ */
+bool parseBytes(const std::string &text, std::vector<unsigned char> &bytes) {
+	const char *value = text.c_str();
+	while (*value) {
+		char *end;
+		long number = strtol(value, &end, 0);
+		if (end == value || number < 0 || number > 255) {
+			return false;
+		}
+		bytes.push_back(number);
+
+		while (isspace(*end)) {
+			end ++;
+		}
+		if (*end == ',') {
+			end ++;
+		} else if (*end != 0) {
+			return false;
+		}
+		value = end;
+	}
+
+	return true;
+}
+
+
+/**
+ * Split the instruments of each program into their transpose and voices. Instruments are 11 bytes for 2-OP and 21 bytes
+ * for 4-OP instruments where the second voice starts at byte 11.
+ */
+bool buildTable(const SourceHeader &header, Table &table) {
+	if (header.programs.size() > 255) {
+		return false;
+	}
+
+	table.recordSize = 0;
+	for (unsigned int i = 0; i < header.programs.size(); i ++) {
+		const std::string &name = header.programs[i];
+		std::map<std::string, std::vector<unsigned char> >::const_iterator instrument = header.instruments.find(name);
+		if (instrument == header.instruments.end()) {
+			printf("Instrument %s is not defined\n", name.c_str());
+			return false;
+		}
+
+		const std::vector<unsigned char> &data = instrument->second;
+		if (table.recordSize == 0) {
+			table.recordSize = data.size();
+		}
+		if (data.size() != table.recordSize || (data.size() != 11 && data.size() != 21)) {
+			printf("Instrument %s has an unexpected size\n", name.c_str());
+			return false;
+		}
+
+		std::vector<unsigned char> program;
+		program.push_back(data[0]);
+		for (unsigned int offset = 1; offset < data.size(); offset += VOICE_SIZE) {
+			if (table.voices.size() == MAX_TABLE_VOICES) {
+				printf("Too many unique voices in %s\n", header.fileName.c_str());
+				return false;
+			}
+			Voice voice(data.begin() + offset, data.begin() + offset + VOICE_SIZE);
+			program.push_back(addVoice(table, voice, name));
+		}
+		table.programs.push_back(program);
+	}
+
+	table.voicesPerProgram = (table.recordSize - 1) / VOICE_SIZE;
+	useProgramOrder(header, table);
+	return true;
+}
+
+
+/**
+ * Get the number of the given voice in the table, adding it when the table does not have it yet.
+ */
+unsigned char addVoice(Table &table, const Voice &voice, const std::string &name) {
+	for (unsigned int i = 0; i < table.voices.size(); i ++) {
+		if (table.voices[i] == voice) {
+			return i;
+		}
+	}
+
+	table.voices.push_back(voice);
+	table.voiceNames.push_back(name);
+	return table.voices.size() - 1;
+}
+
+
+/**
+ * Store the voices in program order without voice numbers when all programs have the same transpose and this takes up
+ * less space than the deduplicated voices.
+ */
+void useProgramOrder(const SourceHeader &header, Table &table) {
+	for (unsigned int i = 1; i < table.programs.size(); i ++) {
+		if (table.programs[i][0] != table.programs[0][0]) {
+			return;
+		}
+	}
+	if (table.programs.size() * table.voicesPerProgram * VOICE_SIZE >= getTableSize(table)) {
+		return;
+	}
+
+	std::vector<Voice> voices;
+	std::vector<std::string> voiceNames;
+	for (unsigned int i = 0; i < table.programs.size(); i ++) {
+		for (unsigned int j = 1; j < table.programs[i].size(); j ++) {
+			voices.push_back(table.voices[table.programs[i][j]]);
+			voiceNames.push_back(header.programs[i]);
+		}
+	}
+
+	table.transpose = table.programs[0][0];
+	table.voices = voices;
+	table.voiceNames = voiceNames;
+	table.programs.clear();
+}
+
+
+/**
+ * Get the number of bytes of PROGMEM that the voices and programs of a table take up.
+ */
+unsigned int getTableSize(const Table &table) {
+	return table.voices.size() * VOICE_SIZE + table.programs.size() * (table.voicesPerProgram + 1);
+}
+
+
+/**
+ * Write the voices, programs and the InstrumentTable of a table.
+ */
+void writeTable(FILE *file, const Table &table) {
+	const char *fileName = strrchr(table.fileName.c_str(), '/');
+	fileName = fileName == NULL ? table.fileName.c_str() : fileName + 1;
+
+	fprintf(file, "\n\n\t// Instruments of %s.\n", fileName);
+	fprintf(file, "\tconst unsigned char %sVoices[%u][%u] PROGMEM = {\n", table.name.c_str(),
+		(unsigned int)table.voices.size(), VOICE_SIZE);
+	for (unsigned int i = 0; i < table.voices.size(); i ++) {
+		fprintf(file, "\t\t{");
+		for (unsigned int j = 0; j < VOICE_SIZE; j ++) {
+			fprintf(file, "%s0x%02X", j > 0 ? ", " : " ", table.voices[i][j]);
+		}
+		fprintf(file, " },  // %3u %s\n", i, table.voiceNames[i].c_str());
+	}
+	fprintf(file, "\t};\n\n");
+
+	if (table.programs.empty()) {
+		fprintf(file, "\tconst InstrumentTable %s = {\n", table.name.c_str());
+		fprintf(file, "\t\t%sVoices[0], NULL, %u, %u, 0x%02X\n", table.name.c_str(),
+			(unsigned int)table.voices.size() / table.voicesPerProgram, table.voicesPerProgram, table.transpose);
+		fprintf(file, "\t};\n");
+		return;
+	}
+
+	unsigned int programSize = table.voicesPerProgram + 1;
+	fprintf(file, "\tconst unsigned char %sPrograms[%u][%u] PROGMEM = {\n", table.name.c_str(),
+		(unsigned int)table.programs.size(), programSize);
+	for (unsigned int i = 0; i < table.programs.size(); i ++) {
+		fprintf(file, i % 6 == 0 ? "\t\t{" : " {");
+		for (unsigned int j = 0; j < programSize; j ++) {
+			fprintf(file, "%s0x%02X", j > 0 ? ", " : " ", table.programs[i][j]);
+		}
+		fprintf(file, i % 6 == 5 || i == table.programs.size() - 1 ? " },\n" : " },");
+	}
+	fprintf(file, "\t};\n\n");
+
+	fprintf(file, "\tconst InstrumentTable %s = {\n", table.name.c_str());
+	fprintf(file, "\t\t%sVoices[0], %sPrograms[0], %u, %u, 0x00\n", table.name.c_str(), table.name.c_str(),
+		(unsigned int)table.programs.size(), table.voicesPerProgram);
+	fprintf(file, "\t};\n");
+}
+
+
+void showHelp() {
+	printf("instrumenttables - Generate deduplicated instrument tables from instrument headers\n\n");
+	printf("Usage: instrumenttables output.h table=header.h [table=header.h ...]\n\n");
+	printf("Each header must declare its instruments as PROGMEM byte arrays of 11 (2-OP) or 21 (4-OP) bytes\n");
+	printf("and a pointer array that lists them in program order. The library tables are generated with:\n");
+	printf("  instrumenttables src/midi_instrument_tables.h midiInstrumentTable=src/midi_instruments.h \\\n");
+	printf("    midiInstrumentTable4OP=src/midi_instruments_4op.h midiInstrumentTable2_4OP=src/midi_instruments2_4op.h \\\n");
+	printf("    midiDrumTable=src/midi_drums.h midiDrumTable4OP=src/midi_drums_4op.h\n\n");
+}
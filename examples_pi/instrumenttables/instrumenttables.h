@@ -0,0 +1,43 @@
+#ifndef INSTRUMENTTABLES_H_
+	#define INSTRUMENTTABLES_H_
+
+	#include <map>
+	#include <string>
+	#include <vector>
+
+	#define VOICE_SIZE 10
+	#define MAX_TABLE_VOICES 256
+
+
+	typedef std::vector<unsigned char> Voice;
+
+
+	typedef struct SourceHeader {
+		std::string fileName;
+		std::map<std::string, std::vector<unsigned char> > instruments;	// Instrument data by name.
+		std::vector<std::string> programs;		// Instrument name of each program of the pointer array.
+	} SourceHeader;
+
+
+	typedef struct Table {
+		std::string name;
+		std::string fileName;
+		unsigned int recordSize;				// 11 for 2-OP or 21 for 4-OP instruments.
+		std::vector<Voice> voices;
+		std::vector<std::string> voiceNames;	// Name of the first instrument that uses each voice.
+		std::vector<std::vector<unsigned char> > programs;	// Transpose and voice numbers, empty in program order.
+		unsigned int voicesPerProgram;
+		unsigned char transpose;				// Transpose of all programs when the voices are in program order.
+	} Table;
+
+
+	int main(int argc, char **argv);
+	bool readHeader(const char *fileName, SourceHeader &header);
+	bool parseBytes(const std::string &text, std::vector<unsigned char> &bytes);
+	bool buildTable(const SourceHeader &header, Table &table);
+	unsigned char addVoice(Table &table, const Voice &voice, const std::string &name);
+	void useProgramOrder(const SourceHeader &header, Table &table);
+	unsigned int getTableSize(const Table &table);
+	void writeTable(FILE *file, const Table &table);
+	void showHelp();
+#endif
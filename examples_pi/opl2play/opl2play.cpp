@@ -1,19 +1,71 @@
 #include <OPL2.h>
+#include <OPL3.h>
+#include <OPL3Duo.h>
 #include <wiringPi.h>
-#include <zlib.h>
 #include <stdio.h>
 #include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
 #include "opl2play.h"
 
-#define CHUNK 16384
+#define MISSED_DEADLINE_NS 1000000ULL
+#define REALTIME_PRIORITY 80
+#define KEYFRAME_INTERVAL_NS (2 * NS_PER_SECOND)
 
 
-FILE *oplFile;
+SongFile songFile;
+PlaybackClock playbackClock;
+EventQueue eventQueue;
+std::atomic<bool> isSongDone(false);
 OPL2 opl2;
+OPL3 opl3;
+OPL3Duo opl3Duo;
+OPL3 *opl3Chip = NULL;
+int chipType = CHIP_OPL2;
+bool isOPL3Started = false;
+bool isOPL3DuoStarted = false;
 int repeat = FALSE;
 int silent = FALSE;
+int realtime = FALSE;
+
+RegisterModel songRegisters;
+RegisterModel chipRegisters;
+std::vector<std::vector<Keyframe> > songIndexes;
+std::vector<Keyframe> *keyframes = NULL;
+unsigned long long seekTime = 0;
+bool isIndexing = false;
+bool isSeeking = false;
+
+
+/**
+ * Play a song that was just loaded from the given player state. When a seek time is set and the song has no index of
+ * keyframes yet, the index is built first by running the player without any delays or register writes. The index is
+ * kept for each song on the command line, so repeating the songs does not build it again. Playback then starts at the
+ * keyframe nearest to the seek time.
+ *
+ * @param play - Function that plays the song from a player state.
+ * @param start - Player state at the start of the song data.
+ */
+template<typename PlayFunction> void playSong(PlayFunction play, PlayerState start) {
+	// The chip was reset by selectChip when the song was loaded, so nothing is known about its registers.
+	memset(&chipRegisters, 0, sizeof(RegisterModel));
+
+	if (seekTime > 0) {
+		if (keyframes->empty()) {
+			beginIndex(start);
+			play(start);
+		}
+		start = seekIndex(seekTime);
+	}
+
+	play(start);
+}
 
 
 int main(int argc, char **argv) {
@@ -29,6 +81,10 @@ int main(int argc, char **argv) {
 			repeat = TRUE;
 		} else if (strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--silent") == 0) {
 			silent = TRUE;
+		} else if (strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--realtime") == 0) {
+			realtime = TRUE;
+		} else if (strncmp(argv[i], "--seek=", 7) == 0) {
+			seekTime = atof(argv[i] + 7) * NS_PER_SECOND;
 		} else if (strcmp(argv[i], "-k") == 0 || strcmp(argv[i], "--kill") == 0) {
 			opl2.reset();
 			return 0;
@@ -42,6 +98,11 @@ int main(int argc, char **argv) {
 	}
 
 	printHeader();
+	songIndexes.resize(argc);
+
+	if (realtime && !startRealtimePlayer()) {
+		realtime = FALSE;
+	}
 
 	for (int i = 1; i < argc; i ++) {
 		if (argv[i][0] != '-') {
@@ -50,42 +111,32 @@ int main(int argc, char **argv) {
 				ext[i] = tolower(ext[i]);
 			}
 
-			oplFile = fopen(argv[i], "rb");
-			if (oplFile == NULL) return fileError();
+			if (!openSongFile(&songFile, argv[i])) return fileError();
+			keyframes = &songIndexes[i];
+			if (seekTime > 0) inflateSong(&songFile);
 			if (!silent) printf("Playing %s\n", argv[i]);
 
-			opl2.reset();
 			if (strcmp(ext, ".dro") == 0) {
-				DRO dro = loadDro(oplFile);
+				DRO dro = loadDro(&songFile);
 				if (dro.file == NULL) return fileError();
-				playDroMusic(dro);
-			} else if (strcmp(ext, ".imf") == 0) {
+				selectChip(dro.chipType);
+				playSong([&](PlayerState state) { playDroMusic(dro, state); }, initialState(dro.file));
+			} else if (strcmp(ext, ".imf") == 0 || strcmp(ext, ".wlf") == 0) {
 				int speed = 560;
 				if (i < argc - 1 && atoi(argv[i + 1])) speed = atoi(argv[++i]);
-				IMF imf = loadImf(oplFile, speed);
+				IMF imf = loadImf(&songFile, speed);
 				if (imf.file == NULL) return fileError();
-				playImfMusic(imf);
-			} else if (strcmp(ext, ".vgm") == 0) {
-				VGM vgm = loadVgm(oplFile);
+				selectChip(CHIP_OPL2);
+				playSong([&](PlayerState state) { playImfMusic(imf, state); }, initialState(imf.file));
+			} else if (strcmp(ext, ".vgm") == 0 || strcmp(ext, ".vgz") == 0 || strcmp(ext, ".gz") == 0) {
+				VGM vgm = loadVgm(&songFile);
 				if (vgm.file == NULL) return fileError();
-				playVgmMusic(vgm);
-			} else if ((strcmp(ext, ".vgz") == 0) || (strcmp(ext, ".gz") == 0)) {
-				FILE *tempFile = fopen("./temp.vgm", "w");
-				int result = inflate(oplFile, tempFile);
-				fclose(tempFile);
-
-				if (result == 0) {
-					fclose(oplFile);
-					oplFile = fopen("./temp.vgm", "rb");
-					VGM vgm = loadVgm(oplFile);
-					if (vgm.file == NULL) return fileError();
-					playVgmMusic(vgm);
-				} else {
-					printf("Decompression error %d\n", result);
-				}
+				if (repeat && vgm.loopOffset > 0) inflateSong(&songFile);
+				selectChip(vgm.chipType);
+				playSong([&](PlayerState state) { playVgmMusic(vgm, state); }, initialState(vgm.file));
 			}
 
-			fclose(oplFile);
+			closeSongFile(&songFile);
 		}
 
 		if (i == argc -1 && repeat) {
@@ -93,251 +144,488 @@ int main(int argc, char **argv) {
 		}
 	}
 
-	opl2.reset();
+	if (opl3Chip != NULL) {
+		opl3Chip->reset();
+	} else {
+		opl2.reset();
+	}
 	printf("\n");
 	return 0;
 }
 
 
-void playDroMusic(DRO dro) {
-	// Load file data into memory...
-	unsigned long dataOffset = ftell(dro.file);
-	fseek(dro.file, 0, SEEK_END);
-	unsigned long dataSize = ftell(dro.file) - dataOffset;
-	fseek(dro.file, dataOffset, SEEK_SET);
-	unsigned char fileData[dataSize];
-	for (unsigned long i = 0; i < dataSize; i ++) {
-		fileData[i] = fileRead(dro.file);
-	}
-
-	// Play!
-	unsigned long offset = 0;
-	unsigned char registerCode;
-	unsigned char reg;
-	unsigned char value;
-
-	while(offset < dro.songLength * 2) {
-		registerCode = fileData[offset ++];
-		value        = fileData[offset ++];
-
-		if (registerCode == dro.codeShortDelay) {
-			delay(value + 1);
-		} else if (registerCode == dro.codeLongDelay) {
-			delay((value + 1) << 8);
-		} else if (registerCode < 128) {
-			reg = dro.registerMap[registerCode];
-			opl2.write(reg, value);
+/**
+ * Select the OPL chip class that matches the hardware a song was recorded for and reset it. Dual OPL2 songs are played
+ * on the two synth units of an OPL3 Duo. Switching away from an OPL3 chip resets it first, so no notes keep sounding.
+ *
+ * @param type - The chip type required by the song, one of CHIP_OPL2, CHIP_DUAL_OPL2, CHIP_OPL3 or CHIP_DUAL_OPL3.
+ */
+void selectChip(int type) {
+	if (!silent && type != chipType) {
+		printf("Using %s\n",
+			type == CHIP_OPL3 ? "OPL3" :
+			type == CHIP_DUAL_OPL3 ? "OPL3 Duo" :
+			type == CHIP_DUAL_OPL2 ? "OPL3 Duo as dual OPL2" : "OPL2");
+	}
+
+	if (opl3Chip != NULL && type != chipType) {
+		opl3Chip->reset();
+	}
+
+	chipType = type;
+	if (type == CHIP_OPL3) {
+		opl3Chip = &opl3;
+		if (!isOPL3Started) {
+			opl3.begin();
+			isOPL3Started = true;
+		} else {
+			opl3.reset();
+		}
+	} else if (type == CHIP_DUAL_OPL2 || type == CHIP_DUAL_OPL3) {
+		opl3Chip = &opl3Duo;
+		if (!isOPL3DuoStarted) {
+			opl3Duo.begin();
+			isOPL3DuoStarted = true;
+		} else {
+			opl3Duo.reset();
+		}
+
+		// For dual OPL2 songs both units run in OPL2 mode, just like a pair of YM3812 chips.
+		if (type == CHIP_DUAL_OPL2) {
+			opl3Duo.setOPL3Enabled(0, false);
+			opl3Duo.setOPL3Enabled(1, false);
 		}
+	} else {
+		opl3Chip = NULL;
+		opl2.reset();
+	}
+}
+
+
+/**
+ * Write a register of the selected chip.
+ *
+ * @param bank - Register bank; bit 0 selects the OPL3 high bank, bit 1 selects the second chip of a dual chip song.
+ * @param reg - The register to write to.
+ * @param value - The value to write to the register.
+ */
+void oplWrite(unsigned char bank, unsigned char reg, unsigned char value) {
+	chipRegisters.values[bank & 0x03][reg] = value;
+	chipRegisters.isWritten[bank & 0x03][reg] = true;
+
+	if (opl3Chip != NULL) {
+		opl3Chip->write(bank, reg, value);
+	} else if (bank == 0) {
+		opl2.write(reg, value);
 	}
 }
 
 
-DRO loadDro(FILE *droFile) {
-	DRO dro;
-	dro.file = NULL;
+/**
+ * Signal the start of a new song. In realtime mode the event is queued for the player thread, otherwise the playback
+ * clock is started right away. While indexing or seeking the clock is not started until the seek time is reached.
+ */
+void songStart() {
+	if (isIndexing || isSeeking) {
+		return;
+	}
 
-	if (fseek(droFile, 12, SEEK_SET) == 0) {
-		dro.songLength = readDWord(droFile);
+	startClock(0);
+}
 
-		if (fseek(droFile, 23, SEEK_SET) == 0) {
-			dro.codeShortDelay    = fileRead(droFile);
-			dro.codeLongDelay     = fileRead(droFile);
-			dro.registerMapLength = fileRead(droFile);
 
-			for (int i = 0; i < dro.registerMapLength; i ++) {
-				dro.registerMap[i] = fileRead(droFile);
-			}
+/**
+ * Write a register of the OPL chip as part of the song. While indexing or seeking only the register model of the song
+ * is updated.
+ *
+ * @param bank - The register bank [0, 3].
+ * @param reg - The register to write to.
+ * @param value - The value to write to the register.
+ */
+void songWrite(unsigned char bank, unsigned char reg, unsigned char value) {
+	songRegisters.values[bank & 0x03][reg] = value;
+	songRegisters.isWritten[bank & 0x03][reg] = true;
+
+	if (isIndexing || isSeeking) {
+		return;
+	}
+
+	if (realtime) {
+		queueEvent(EVENT_WRITE, 0, bank, reg, value);
+	} else {
+		oplWrite(bank, reg, value);
+	}
+}
 
-			dro.file = droFile;
+
+/**
+ * Wait until the given song time has been reached before processing any further register writes. While indexing a
+ * keyframe is recorded every KEYFRAME_INTERVAL_NS. While seeking there is no delay until the seek time is reached,
+ * then the chip is brought up to date and the song continues to play normally.
+ *
+ * @param songTime - Time in ns since the start of the song.
+ * @param state - State of the player after this wait, used to resume playback from a keyframe.
+ */
+void songWait(unsigned long long songTime, PlayerState state) {
+	if (isIndexing) {
+		if (songTime >= keyframes->back().songTime + KEYFRAME_INTERVAL_NS) {
+			addKeyframe(songTime, state);
 		}
+		return;
+	}
+
+	if (isSeeking) {
+		if (songTime < seekTime) {
+			return;
+		}
+		syncRegisters();
+		isSeeking = false;
+		startClock(songTime);
+	}
+
+	if (realtime) {
+		queueEvent(EVENT_WAIT, songTime, 0, 0, 0);
+	} else {
+		clockWaitUntil(&playbackClock, songTime);
 	}
+}
 
-	return dro;
+
+/**
+ * The loop point of the song has been reached. Looping songs are played from the song data again, so nothing needs to
+ * be remembered.
+ */
+void songLoopPoint() {
 }
 
 
-void playImfMusic(IMF imf) {
-	// Load file data into memory...
-	unsigned long dataOffset = ftell(imf.file);
-	fseek(imf.file, 0, SEEK_END);
-	unsigned long dataSize = ftell(imf.file) - dataOffset;
-	fseek(imf.file, dataOffset, SEEK_SET);
-	unsigned char fileData[dataSize];
-	for (unsigned long i = 0; i < dataSize; i ++) {
-		fileData[i] = fileRead(imf.file);
+/**
+ * Should a looping song continue to play from its loop point when its end is reached? Songs loop when they are played
+ * on repeat, but never while indexing.
+ *
+ * @return True to continue playing from the loop point.
+ */
+bool songRepeat() {
+	return repeat && !isIndexing;
+}
+
+
+/**
+ * Signal the end of the song. In realtime mode this waits for the player thread to play all remaining events.
+ */
+void songEnd() {
+	if (isIndexing) {
+		isIndexing = false;
+		return;
+	}
+
+	// The seek time lies beyond the end of the song.
+	if (isSeeking) {
+		isSeeking = false;
+		return;
 	}
 
-	// Play!
-	unsigned long offset = 0;
-	unsigned char reg;
-	unsigned char value;
-	unsigned int delayCycles;
+	if (realtime) {
+		queueEvent(EVENT_END, 0, 0, 0, 0);
+		while (!isSongDone) {
+			usleep(1000);
+		}
+	} else {
+		clockReport(&playbackClock);
+	}
+}
 
-	while (offset < imf.songLength) {
-		reg   = fileData[offset ++];
-		value = fileData[offset ++];;
-		delayCycles  = fileData[offset ++];
-		delayCycles += fileData[offset ++] << 8;
 
-		opl2.write(reg, value);
-		delay((int)(delayCycles * (1000.0 / imf.speed)));
+/**
+ * Start the playback clock at the given song time.
+ *
+ * @param songTime - Time in ns since the start of the song that playback starts at.
+ */
+void startClock(unsigned long long songTime) {
+	if (realtime) {
+		isSongDone = false;
+		queueEvent(EVENT_START, songTime, 0, 0, 0);
+	} else {
+		clockStart(&playbackClock, songTime);
 	}
 }
 
 
-IMF loadImf(FILE *imfFile, int speed) {
-	IMF imf;
+/**
+ * Prepare to build an index of keyframes for the current song. The first keyframe is at the start of the song data.
+ *
+ * @param start - The player state at the start of the song data.
+ */
+void beginIndex(PlayerState start) {
+	memset(&songRegisters, 0, sizeof(RegisterModel));
+	keyframes->clear();
+	addKeyframe(0, start);
+	isIndexing = true;
+}
+
+
+void addKeyframe(unsigned long long songTime, PlayerState state) {
+	Keyframe keyframe;
+	keyframe.songTime  = songTime;
+	keyframe.state     = state;
+	keyframe.registers = songRegisters;
+	keyframes->push_back(keyframe);
+}
 
-	imf.file  = imfFile;
-	imf.speed = speed;
-	imf.songLength = readWord(imfFile);
 
-	// If song length is 0 we're probably dealing with a type 0 file. In that
-	// case we want to play the file until EOF, so set songLength to max.
-	if (imf.songLength == 0) {
-		imf.songLength = 65535;
-		fseek(imfFile, 0, SEEK_SET);
+/**
+ * Restore the register model of the last keyframe before the given song time. The player then only needs to
+ * fast forward from the keyframe to the song time.
+ *
+ * @param songTime - Time in ns since the start of the song to seek to.
+ * @return The player state to resume playback from.
+ */
+PlayerState seekIndex(unsigned long long songTime) {
+	size_t index = 0;
+	while (index + 1 < keyframes->size() && (*keyframes)[index + 1].songTime <= songTime) {
+		index ++;
 	}
 
-	return imf;
+	if (!silent) {
+		printf("Seeking to %.1f s from keyframe at %.1f s\n",
+			songTime / (double)NS_PER_SECOND, (*keyframes)[index].songTime / (double)NS_PER_SECOND);
+	}
+
+	songRegisters = (*keyframes)[index].registers;
+	isSeeking = true;
+	return (*keyframes)[index].state;
 }
 
 
-void playVgmMusic(VGM vgm) {
-	// Load file data into memory...
-	unsigned long dataOffset = ftell(vgm.file);
-	fseek(vgm.file, 0, SEEK_END);
-	unsigned long dataSize = ftell(vgm.file) - dataOffset;
-	fseek(vgm.file, dataOffset, SEEK_SET);
-	unsigned char fileData[dataSize];
-	for (unsigned long i = 0; i < dataSize; i ++) {
-		fileData[i] = fileRead(vgm.file);
-	}
-
-	// Play!
-	unsigned long offset = 0;
-	unsigned char command;
-	unsigned char reg;
-	unsigned char data;
-	unsigned int sampleDelay;
-
-	while(offset < dataSize) {
-		command = fileData[offset ++];
-
-		switch (command) {
-			// YM3812 command.
-			case 0x5A: {
-				reg = fileData[offset ++];
-				data = fileData[offset ++];
-				opl2.write(reg, data);
-				break;
-			}
+/**
+ * Write all registers where the register model of the song differs from what is known to be in the chip. OPL3 mode and
+ * 4-op registers are written first and key on registers last, so no notes are started before their instrument is set.
+ */
+void syncRegisters() {
+	const unsigned char firstRegisters[2] = { 0x05, 0x04 };
+	int numWrites = 0;
+
+	for (int pass = 0; pass < 3; pass ++) {
+		for (int bank = 0; bank < 4; bank ++) {
+			for (int reg = 0; reg < 256; reg ++) {
+				bool isFirst = (bank & 0x01) && (reg == firstRegisters[0] || reg == firstRegisters[1]);
+				bool isKeyOn = (reg >= 0xB0 && reg <= 0xB8) || reg == 0xBD;
+				if ((pass == 0 && !isFirst) || (pass == 1 && (isFirst || isKeyOn)) || (pass == 2 && !isKeyOn)) {
+					continue;
+				}
 
-			// Sample delay long.
-			case 0x61: {
-				sampleDelay  = fileData[offset ++];
-				sampleDelay += fileData[offset ++] << 8;
-				delay(sampleDelay * 0.023);
-				break;
+				unsigned char value = songRegisters.values[bank][reg];
+				if (songRegisters.isWritten[bank][reg] &&
+					(!chipRegisters.isWritten[bank][reg] || chipRegisters.values[bank][reg] != value)) {
+					if (realtime) {
+						queueEvent(EVENT_WRITE, 0, bank, reg, value);
+					} else {
+						oplWrite(bank, reg, value);
+					}
+					numWrites ++;
+				}
 			}
+		}
+	}
 
-			// 60 Hz delay.
-			case 0x62: {
-				delay(17);
-				break;
-			}
+	if (!silent) {
+		printf("Restored %d registers\n", numWrites);
+	}
+}
 
-			// 50 Hz delay.
-			case 0x63: {
-				delay(20);
-				break;
-			}
 
-			// End of song data. Stop or loop.
-			case 0x66: {
-				if (repeat && vgm.loopOffset > 0) {
-					offset = vgm.loopOffset;
-				} else {
-					offset = dataSize;
-				}
-				break;
-			}
+/**
+ * Add an event to the queue of the player thread. When the queue is full the decoder waits for the player to catch
+ * up, so the decoder can never run more than EVENT_QUEUE_SIZE events ahead.
+ *
+ * The queue is a lock free single producer, single consumer ring buffer. Only the decoder moves the head and only the
+ * player thread moves the tail.
+ */
+void queueEvent(unsigned char type, unsigned long long time, unsigned char bank, unsigned char reg,
+	unsigned char value) {
+	unsigned int head = eventQueue.head.load(std::memory_order_relaxed);
+	unsigned int nextHead = (head + 1) % EVENT_QUEUE_SIZE;
+	while (nextHead == eventQueue.tail.load(std::memory_order_acquire)) {
+		usleep(1000);
+	}
 
-			// Sample dalay short.
-			case 0x70 ... 0x7F: {
-				sampleDelay = (command % 0x0F) + 1;
-				delay(sampleDelay * 0.023);
-				break;
-			}
+	SongEvent &event = eventQueue.events[head];
+	event.type  = type;
+	event.time  = time;
+	event.bank  = bank;
+	event.reg   = reg;
+	event.value = value;
+	eventQueue.head.store(nextHead, std::memory_order_release);
+}
 
-			// Unsupported sample
-			case 0x51 ... 0x59:
-			case 0x5B ... 0x5F: {
-				offset += 2;
-				break;
+
+/**
+ * Take the next event from the queue.
+ *
+ * @param event - Receives the event.
+ * @return True if an event was available.
+ */
+bool dequeueEvent(SongEvent *event) {
+	unsigned int tail = eventQueue.tail.load(std::memory_order_relaxed);
+	if (tail == eventQueue.head.load(std::memory_order_acquire)) {
+		return false;
+	}
+
+	*event = eventQueue.events[tail];
+	eventQueue.tail.store((tail + 1) % EVENT_QUEUE_SIZE, std::memory_order_release);
+	return true;
+}
+
+
+/**
+ * Player thread for realtime mode. Takes events from the queue and writes them to the OPL at their deadline.
+ */
+void *playerThread(void *arg) {
+	SongEvent event;
+	bool isPlaying = false;
+	bool isStarved = false;
+
+	while (true) {
+		if (!dequeueEvent(&event)) {
+			// The decoder did not keep up; count it once for every time the queue runs dry.
+			if (isPlaying && !isStarved) {
+				playbackClock.numUnderruns ++;
+				isStarved = true;
 			}
+			usleep(100);
+			continue;
 		}
 
-		// Do we need to loop?
-		if (repeat && vgm.loopOffset >= 0 && vgm.loopLength > 0 && offset > vgm.loopLength) {
-			offset = vgm.loopOffset;
+		isStarved = false;
+		switch (event.type) {
+			case EVENT_START:
+				clockStart(&playbackClock, event.time);
+				isPlaying = true;
+				break;
+			case EVENT_WRITE:
+				oplWrite(event.bank, event.reg, event.value);
+				break;
+			case EVENT_WAIT:
+				clockWaitUntil(&playbackClock, event.time);
+				break;
+			case EVENT_END:
+				clockReport(&playbackClock);
+				isPlaying = false;
+				isSongDone = true;
+				break;
 		}
 	}
+
+	return NULL;
 }
 
 
-VGM loadVgm(FILE *vgmFile) {
-	VGM vgm;
-	vgm.file = NULL;
+/**
+ * Start the realtime player thread. All memory is locked to prevent page faults during playback and the player thread
+ * is pinned to the last CPU core with SCHED_FIFO priority. Decoding of song files remains on the main thread.
+ *
+ * @return True if the player thread was started.
+ */
+bool startRealtimePlayer() {
+	pthread_t thread;
+	pthread_attr_t attributes;
+	struct sched_param schedParam;
 
-	if (fileRead(vgmFile) == 0x56 && fileRead(vgmFile) == 0x67 && fileRead(vgmFile) == 0x6D) {
-		fseek(vgmFile, 0x50, SEEK_SET);
-		unsigned long clockSpeed = readDWord(vgmFile);
+	if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0 && !silent) {
+		printf("Warning: Unable to lock memory, playback may be interrupted by page faults.\n");
+	}
 
-		if (clockSpeed > 0) {
-			fseek(vgmFile, 0x18, SEEK_SET);
-			vgm.songLength = readDWord(vgmFile);
-			vgm.loopOffset = readDWord(vgmFile);
-			vgm.loopLength = readDWord(vgmFile);
+	pthread_attr_init(&attributes);
+	pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED);
+	pthread_attr_setschedpolicy(&attributes, SCHED_FIFO);
+	schedParam.sched_priority = REALTIME_PRIORITY;
+	pthread_attr_setschedparam(&attributes, &schedParam);
 
-			// Calculate loop offset relative to song data offset.
-			if (vgm.loopOffset > 0) {
-				vgm.loopOffset -= 0xE4;
-			}
+	int result = pthread_create(&thread, &attributes, playerThread, NULL);
+	if (result == EPERM) {
+		if (!silent) printf("Warning: No permission for realtime scheduling, are you running this as root?\n");
+		result = pthread_create(&thread, NULL, playerThread, NULL);
+	}
+	pthread_attr_destroy(&attributes);
 
-			fseek(vgmFile, 0x100, SEEK_SET);
-			vgm.file = vgmFile;
-		} else {
-			printf("No YM3812 sample data!\n");
-		}
+	if (result != 0) {
+		printf("Unable to start the player thread, realtime mode is disabled.\n");
+		return false;
 	}
 
-	return vgm;
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(sysconf(_SC_NPROCESSORS_ONLN) - 1, &cpuSet);
+	pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet);
+	pthread_detach(thread);
+
+	return true;
 }
 
 
-unsigned char fileRead(FILE *file) {
-	unsigned char byte[1];
-	if (fread(byte, sizeof(byte), 1, file)) {
-		return byte[0];
-	}
-	return 0;
+/**
+ * Start the playback clock. All song times passed to clockWaitUntil are relative to this moment.
+ *
+ * @param clock - The playback clock to start.
+ */
+void clockStart(PlaybackClock *clock, unsigned long long songTime) {
+	memset(clock, 0, sizeof(PlaybackClock));
+	clock_gettime(CLOCK_MONOTONIC, &clock->start);
+
+	// Move the start of the clock back so that now is the given song time.
+	unsigned long long start = clock->start.tv_sec * NS_PER_SECOND + clock->start.tv_nsec - songTime;
+	clock->start.tv_sec  = start / NS_PER_SECOND;
+	clock->start.tv_nsec = start % NS_PER_SECOND;
 }
 
 
-unsigned int readWord(FILE *file) {
-	unsigned int value = fileRead(file);
-	value += fileRead(file) << 8;
-	return value;
+/**
+ * Sleep until the given song time has been reached. The deadline is absolute on CLOCK_MONOTONIC, so the time spent
+ * writing registers or reading the song is automatically compensated for. How late the player woke up is recorded to
+ * report timing jitter after playback.
+ *
+ * @param clock - The playback clock.
+ * @param songTime - The song time in ns since the start of the song.
+ */
+void clockWaitUntil(PlaybackClock *clock, unsigned long long songTime) {
+	unsigned long long deadline = clock->start.tv_sec * NS_PER_SECOND + clock->start.tv_nsec + songTime;
+	struct timespec wakeTime;
+	wakeTime.tv_sec  = deadline / NS_PER_SECOND;
+	wakeTime.tv_nsec = deadline % NS_PER_SECOND;
+
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, NULL) == EINTR);
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	long long lateness = (long long)(now.tv_sec * NS_PER_SECOND + now.tv_nsec) - (long long)deadline;
+	if (lateness < 0) {
+		lateness = 0;
+	}
+
+	clock->numWaits ++;
+	clock->totalLateness += lateness;
+	if (lateness > (long long)MISSED_DEADLINE_NS) {
+		clock->numMissed ++;
+	}
+	if (lateness > clock->maxLateness) {
+		clock->maxLateness = lateness;
+	}
 }
 
 
-unsigned int readDWord(FILE *file) {
-	unsigned int value = fileRead(file);
-	value += fileRead(file) << 8;
-	value += fileRead(file) << 16;
-	value += fileRead(file) << 24;
-	return value;
+/**
+ * Print the measured timing jitter of the last song that was played.
+ *
+ * @param clock - The playback clock.
+ */
+void clockReport(PlaybackClock *clock) {
+	if (!silent && clock->numWaits > 0) {
+		printf("Timing jitter: average %.1f us, maximum %.1f us over %lu waits\n",
+			(clock->totalLateness / clock->numWaits) / 1000.0,
+			clock->maxLateness / 1000.0,
+			clock->numWaits);
+		printf("Missed deadlines: %lu, queue underruns: %lu\n", clock->numMissed, clock->numUnderruns);
+	}
 }
 
 
@@ -353,73 +641,6 @@ int fileError() {
 }
 
 
-/* Decompress from file source to file dest until stream ends or EOF.
-   inf() returns Z_OK on success, Z_MEM_ERROR if memory could not be
-   allocated for processing, Z_DATA_ERROR if the deflate data is
-   invalid or incomplete, Z_VERSION_ERROR if the version of zlib.h and
-   the version of the library linked do not match, or Z_ERRNO if there
-   is an error reading or writing the files. */
-int inflate(FILE *source, FILE *dest) {
-	int ret;
-	unsigned int have;
-	z_stream strm;
-	unsigned char in[CHUNK];
-	unsigned char out[CHUNK];
-
-		/* allocate inflate state */
-	strm.zalloc = Z_NULL;
-	strm.zfree = Z_NULL;
-	strm.opaque = Z_NULL;
-	strm.avail_in = 0;
-	strm.next_in = Z_NULL;
-	ret = inflateInit2(&strm, 16 + MAX_WBITS);
-	if (ret != Z_OK)
-		return ret;
-
-
-	/* decompress until deflate stream ends or end of file */
-	do {
-		strm.avail_in = fread(in, 1, CHUNK, source);
-		if (ferror(source)) {
-			(void)inflateEnd(&strm);
-			return Z_ERRNO;
-		}
-		if (strm.avail_in == 0)
-			break;
-		strm.next_in = in;
-
-		/* run inflate() on input until output buffer not full */
-		do {
-			strm.avail_out = CHUNK;
-			strm.next_out = out;
-
-			ret = inflate(&strm, Z_NO_FLUSH);
-			//assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
-			switch (ret) {
-			case Z_NEED_DICT:
-				ret = Z_DATA_ERROR;     /* and fall through */
-			case Z_DATA_ERROR:
-			case Z_MEM_ERROR:
-				(void)inflateEnd(&strm);
-				return ret;
-			}
-
-			have = CHUNK - strm.avail_out;
-			if (fwrite(out, 1, have, dest) != have || ferror(dest)) {
-				(void)inflateEnd(&strm);
-				return Z_ERRNO;
-			}
-
-		} while (strm.avail_out == 0);
-		/* done when inflate() says it's done */
-	} while (ret != Z_STREAM_END);
-
-	/* clean up and return */
-	(void)inflateEnd(&strm);
-	return ret == Z_STREAM_END ? Z_OK : Z_DATA_ERROR;
-}
-
-
 void printHeader() {
 	if (!silent) {
 		printf("\033[2J\033[1;1H\033[0m");
@@ -442,11 +663,11 @@ void showHelp() {
 	printf("variants that lets you play various audio formats for YM3512. OPL2Play supports\n");
 	printf("the following file formats:\n");
 	printf("    *.DRO        - Raw Adlib register captures from DosBox\n");
-	printf("    *.IMF        - id Software music files\n");
+	printf("    *.IMF, *.WLF - id Software music files\n");
 	printf("    *.VGM, *.VGZ - Video Game Music files\n");
 	printf("\n");
 	printf("Usage: opl2play <file> [imf_speed] [<file_n> [imf_speed_n]]\n");
-	printf("                [--help] [--kill] [--silent] [--repeat]\n");
+	printf("                [--help] [--kill] [--silent] [--repeat] [--realtime] [--seek=SECONDS]\n");
 	printf("\n");
 	printf("file             The music file to play. Multiple files may be provided to play\n");
 	printf("                 one after the other\n");
@@ -468,6 +689,11 @@ void showHelp() {
 	printf("\n");
 	printf("--repeat, -r     Repeats when all songs have been played.\n");
 	printf("\n");
+	printf("--realtime, -t   Play from a dedicated thread with realtime priority that is\n");
+	printf("                 pinned to the last CPU core. Requires root.\n");
+	printf("\n");
+	printf("--seek=SECONDS   Start playing each song at the given time.\n");
+	printf("\n");
 }
 
 
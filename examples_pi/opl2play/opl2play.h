@@ -1,50 +1,77 @@
 #ifndef OPL2PLAY_H_
 	#define OPL2PLAY_H_
 
-	#include <stdio.h>
-
-
-	typedef struct DRO {
-		FILE *file;
-		unsigned long songLength;
-		unsigned char codeShortDelay;
-		unsigned char codeLongDelay;
-		unsigned char registerMapLength;
-		unsigned char registerMap[256];
-	} DRO;
-
-
-	typedef struct IMF {
-		FILE *file;
-		unsigned long songLength;
-		int speed;
-	} IMF;
-	
-	
-	typedef struct VGM {
-		FILE *file;
-		unsigned long songLength;
-		unsigned long loopOffset;
-		unsigned long loopLength;
-	} VGM;
+	#include <time.h>
+	#include <atomic>
+	#include <vector>
+	#include "songformats.h"
+
+	#define EVENT_QUEUE_SIZE 4096
+
+	#define EVENT_START 0
+	#define EVENT_WRITE 1
+	#define EVENT_WAIT  2
+	#define EVENT_END   3
+
+
+	typedef struct PlaybackClock {
+		struct timespec start;			// Moment the song started playing.
+		unsigned long numWaits;			// Number of waits for the next register burst.
+		long long totalLateness;		// Sum of wake up lateness in ns.
+		long long maxLateness;			// Maximum wake up lateness in ns.
+		unsigned long numMissed;		// Number of waits that woke up later than MISSED_DEADLINE_NS.
+		unsigned long numUnderruns;		// Number of times the player thread ran out of events.
+	} PlaybackClock;
+
+
+	typedef struct SongEvent {
+		unsigned long long time;		// Song time in ns for wait events.
+		unsigned char type;
+		unsigned char bank;
+		unsigned char reg;
+		unsigned char value;
+	} SongEvent;
+
+
+	typedef struct EventQueue {
+		SongEvent events[EVENT_QUEUE_SIZE];
+		std::atomic<unsigned int> head;	// Next event to be written by the decoder.
+		std::atomic<unsigned int> tail;	// Next event to be played by the player thread.
+	} EventQueue;
+
+
+	typedef struct RegisterModel {
+		unsigned char values[4][256];	// Register values of each bank.
+		bool isWritten[4][256];			// Indicates that a register value is known.
+	} RegisterModel;
+
+
+	typedef struct Keyframe {
+		unsigned long long songTime;	// Song time in ns of the keyframe.
+		PlayerState state;				// State to resume the player from.
+		RegisterModel registers;		// Registers of the song at the keyframe.
+	} Keyframe;
 
 
 	int main(int argc, char **argv);
-	DRO loadDro(FILE *droFile);
-	IMF loadImf(FILE *imfFile, int speed);
-	VGM loadVgm(FILE *vgmFile);
-	VGM loadVgz(FILE *vgzFile);
-	void playDroMusic(DRO dro);
-	void playImfMusic(IMF imf);
-	void playVgmMusic(VGM vgm);
-	unsigned char fileRead(FILE *file);
-	unsigned int readWord(FILE *file);
-	unsigned int readDWord(FILE *file);
+	void selectChip(int type);
+	void oplWrite(unsigned char bank, unsigned char reg, unsigned char value);
+	void startClock(unsigned long long songTime);
+	void beginIndex(PlayerState start);
+	void addKeyframe(unsigned long long songTime, PlayerState state);
+	PlayerState seekIndex(unsigned long long songTime);
+	void syncRegisters();
+	void queueEvent(unsigned char type, unsigned long long time, unsigned char bank, unsigned char reg,
+		unsigned char value);
+	bool dequeueEvent(SongEvent *event);
+	void *playerThread(void *arg);
+	bool startRealtimePlayer();
+	void clockStart(PlaybackClock *clock, unsigned long long songTime);
+	void clockWaitUntil(PlaybackClock *clock, unsigned long long songTime);
+	void clockReport(PlaybackClock *clock);
 	int spiError();
 	int fileError();
 	void printHeader();
 	void showHelp();
 	void showConnections();
-	
-	int inflate(FILE *source, FILE *dest);
 #endif
@@ -0,0 +1,719 @@
+/**
+ * Song file reading and decoding of the DRO, IMF and VGM song formats, shared by opl2play and oplconvert. Songs are
+ * decoded by the play*Music functions, which pass every register write and wait of the song to the song* functions
+ * that are declared in songformats.h. Each tool implements these to either play the song or convert it.
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+#include <zlib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <limits.h>
+#include "songformats.h"
+
+
+/**
+ * Open the given song file and map its contents into memory. Song data is then read directly from the page cache
+ * without any per byte system calls and without copying the file onto the stack. When the file cannot be mapped its
+ * contents are read into a heap buffer in large blocks instead.
+ *
+ * Gzip compressed files (such as VGZ) are detected by their header and are inflated on the fly into a window of
+ * WINDOW_SIZE bytes as the song is being read. Playback can start as soon as the first window is available and no
+ * temporary file is written. Songs that are read more than once are inflated completely with inflateSong instead.
+ *
+ * @param song - The song file to open.
+ * @param fileName - Name of the file to open.
+ * @return True if the file was opened successfully.
+ */
+bool openSongFile(SongFile *song, const char *fileName) {
+	struct stat fileStat;
+
+	memset(song, 0, sizeof(SongFile));
+	song->fd = open(fileName, O_RDONLY);
+	if (song->fd < 0) {
+		return false;
+	}
+
+	if (fstat(song->fd, &fileStat) != 0 || fileStat.st_size == 0) {
+		closeSongFile(song);
+		return false;
+	}
+	song->fileSize = fileStat.st_size;
+
+	void *data = mmap(NULL, song->fileSize, PROT_READ, MAP_PRIVATE, song->fd, 0);
+	if (data != MAP_FAILED) {
+		// The advice values are not flags, so each needs its own call.
+		madvise(data, song->fileSize, MADV_SEQUENTIAL);
+		madvise(data, song->fileSize, MADV_WILLNEED);
+		song->fileData = (unsigned char *)data;
+		song->isMapped = true;
+	} else {
+		// Mapping failed, so fall back to reading the file in large blocks.
+		song->fileData = (unsigned char *)malloc(song->fileSize);
+		unsigned long bytesRead = 0;
+		while (song->fileData != NULL && bytesRead < song->fileSize) {
+			ssize_t result = read(song->fd, song->fileData + bytesRead, song->fileSize - bytesRead);
+			if (result <= 0) {
+				closeSongFile(song);
+				return false;
+			}
+			bytesRead += result;
+		}
+
+		if (song->fileData == NULL) {
+			closeSongFile(song);
+			return false;
+		}
+	}
+
+	// Check for the gzip magic number to see if we need to inflate the file.
+	if (song->fileSize > 2 && song->fileData[0] == 0x1F && song->fileData[1] == 0x8B) {
+		song->inflater = (z_stream *)calloc(1, sizeof(z_stream));
+		song->window = (unsigned char *)malloc(WINDOW_SIZE);
+		if (song->inflater == NULL || song->window == NULL ||
+			inflateInit2(song->inflater, 16 + MAX_WBITS) != Z_OK) {
+			closeSongFile(song);
+			return false;
+		}
+
+		song->data = song->window;
+		rewindInflater(song);
+		fillWindow(song);
+	} else {
+		song->data = song->fileData;
+		song->dataLength = song->fileSize;
+		song->isEndOfData = true;
+	}
+
+	return song->dataLength > 0;
+}
+
+
+/**
+ * Unmap or free the song data and close the song file.
+ *
+ * @param song - The song file to close.
+ */
+void closeSongFile(SongFile *song) {
+	if (song->inflater != NULL) {
+		inflateEnd(song->inflater);
+		free(song->inflater);
+	}
+
+	if (song->window != NULL) {
+		free(song->window);
+	}
+
+	if (song->fileData != NULL) {
+		if (song->isMapped) {
+			munmap(song->fileData, song->fileSize);
+		} else {
+			free(song->fileData);
+		}
+	}
+
+	if (song->fd > 0) {
+		close(song->fd);
+	}
+
+	memset(song, 0, sizeof(SongFile));
+}
+
+
+/**
+ * Restart inflating a compressed song file from the beginning.
+ *
+ * @param song - The compressed song file.
+ */
+void rewindInflater(SongFile *song) {
+	inflateReset(song->inflater);
+	song->inflater->next_in = song->fileData;
+	song->inflater->avail_in = song->fileSize;
+	song->dataStart = 0;
+	song->dataLength = 0;
+	song->isEndOfData = false;
+}
+
+
+/**
+ * Inflate all of a compressed song file into memory at once. Songs that loop or are indexed for seeking read parts of
+ * the song again, which would otherwise restart decompression from the beginning of the file every time. When there is
+ * not enough memory the song keeps being inflated one window at a time.
+ *
+ * @param song - The song file.
+ * @return True if the whole song is available in memory.
+ */
+bool inflateSong(SongFile *song) {
+	if (song->inflater == NULL) {
+		return true;
+	}
+
+	rewindInflater(song);
+	unsigned long size = WINDOW_SIZE;
+	int result;
+	do {
+		if (song->dataLength == size) {
+			unsigned char *buffer = (unsigned char *)realloc(song->window, size * 2);
+			if (buffer == NULL) {
+				song->data = song->window;
+				rewindInflater(song);
+				fillWindow(song);
+				return false;
+			}
+			song->window = buffer;
+			size *= 2;
+		}
+
+		song->inflater->next_out = song->window + song->dataLength;
+		song->inflater->avail_out = size - song->dataLength;
+		result = inflate(song->inflater, Z_NO_FLUSH);
+		song->dataLength = size - song->inflater->avail_out;
+	} while (result == Z_OK);
+
+	if (result != Z_STREAM_END) {
+		printf("Decompression error %d\n", result);
+	}
+
+	// The inflater is no longer needed, so the song is read like an uncompressed file from now on.
+	inflateEnd(song->inflater);
+	free(song->inflater);
+	song->inflater = NULL;
+	song->data = song->window;
+	song->isEndOfData = true;
+	return true;
+}
+
+
+/**
+ * Inflate the next window of data of a compressed song file. The window that was previously held is discarded.
+ *
+ * @param song - The compressed song file.
+ * @return True if new data was added to the window.
+ */
+bool fillWindow(SongFile *song) {
+	if (song->isEndOfData) {
+		return false;
+	}
+
+	song->dataStart += song->dataLength;
+	song->inflater->next_out = song->window;
+	song->inflater->avail_out = WINDOW_SIZE;
+
+	int result = inflate(song->inflater, Z_NO_FLUSH);
+	while (result == Z_OK && song->inflater->avail_out > 0 && song->inflater->avail_in > 0) {
+		result = inflate(song->inflater, Z_NO_FLUSH);
+	}
+
+	song->dataLength = WINDOW_SIZE - song->inflater->avail_out;
+	if (result != Z_OK) {
+		song->isEndOfData = true;
+		if (result != Z_STREAM_END) {
+			printf("Decompression error %d\n", result);
+		}
+	}
+
+	return song->dataLength > 0;
+}
+
+
+/**
+ * Make sure that the given position of the song is available in memory. For mapped files this is always the case, for
+ * compressed files the window is moved forward until the position is reached. Moving back before the current window
+ * restarts decompression from the beginning of the file.
+ *
+ * @param song - The song file.
+ * @param position - The position in the (uncompressed) song data that must be available.
+ * @return True if the data at the given position is available.
+ */
+bool fileFetch(SongFile *song, unsigned long position) {
+	if (position < song->dataStart) {
+		if (song->inflater == NULL) {
+			return false;
+		}
+		rewindInflater(song);
+	}
+
+	while (position - song->dataStart >= song->dataLength) {
+		if (song->inflater == NULL || !fillWindow(song)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * Move the read position of the song file.
+ *
+ * @param song - The song file.
+ * @param position - The new read position from the start of the (uncompressed) song data.
+ * @return True if the position lies within the file.
+ */
+bool fileSeek(SongFile *song, unsigned long position) {
+	song->position = position;
+	return fileFetch(song, position);
+}
+
+
+/**
+ * Has the end of the song data been reached?
+ *
+ * @param song - The song file.
+ * @return True when there is no more data to be read.
+ */
+bool fileEnd(SongFile *song) {
+	return !fileFetch(song, song->position);
+}
+
+
+unsigned char fileRead(SongFile *song) {
+	unsigned long offset = song->position - song->dataStart;
+	if (offset < song->dataLength || fileFetch(song, song->position)) {
+		offset = song->position - song->dataStart;
+		song->position ++;
+		return song->data[offset];
+	}
+	return 0;
+}
+
+
+unsigned int readWord(SongFile *song) {
+	unsigned int value = fileRead(song);
+	value += fileRead(song) << 8;
+	return value;
+}
+
+
+unsigned int readDWord(SongFile *song) {
+	unsigned int value = fileRead(song);
+	value += fileRead(song) << 8;
+	value += fileRead(song) << 16;
+	value += fileRead(song) << 24;
+	return value;
+}
+
+
+/**
+ * Get the state of a player at the start of the song data.
+ *
+ * @param file - The song file, positioned at the start of the song data.
+ */
+PlayerState initialState(SongFile *file) {
+	return playerState(file, 0, 0);
+}
+
+
+PlayerState playerState(SongFile *file, unsigned long long songUnits, unsigned char bank) {
+	PlayerState state;
+	state.position  = file->position;
+	state.songUnits = songUnits;
+	state.bank      = bank;
+	return state;
+}
+
+
+void playDroMusic(DRO dro, PlayerState state) {
+	if (dro.version == 1) {
+		playDroV1Music(dro, state);
+	} else {
+		playDroV2Music(dro, state);
+	}
+}
+
+
+/**
+ * Play a DRO v0.1 song. The song data is a stream of commands where codes 0x00 to 0x04 are special and any other code
+ * is a register followed by its value.
+ */
+void playDroV1Music(DRO dro, PlayerState state) {
+	unsigned long endPosition = dro.dataStart + dro.songLength;
+	unsigned char bank = state.bank;
+	unsigned char code;
+	unsigned char value;
+	unsigned long long songTimeMs = state.songUnits;
+
+	fileSeek(dro.file, state.position);
+	songStart();
+	while (dro.file->position < endPosition && !fileEnd(dro.file)) {
+		code = fileRead(dro.file);
+
+		switch (code) {
+			case 0x00:
+				songTimeMs += fileRead(dro.file) + 1;
+				songWait(songTimeMs * 1000000ULL, playerState(dro.file, songTimeMs, bank));
+				break;
+			case 0x01:
+				songTimeMs += readWord(dro.file) + 1;
+				songWait(songTimeMs * 1000000ULL, playerState(dro.file, songTimeMs, bank));
+				break;
+			case 0x02:
+				bank = 0;
+				break;
+			case 0x03:
+				bank = dro.highBank;
+				break;
+			case 0x04:
+				code  = fileRead(dro.file);
+				value = fileRead(dro.file);
+				songWrite(bank, code, value);
+				break;
+			default:
+				value = fileRead(dro.file);
+				songWrite(bank, code, value);
+				break;
+		}
+	}
+
+	songEnd();
+}
+
+
+/**
+ * Play a DRO v2.0 song. The song data consists of register code and value pairs where bit 7 of the register code
+ * selects the high register bank or second chip.
+ */
+void playDroV2Music(DRO dro, PlayerState state) {
+	unsigned long remaining = dro.songLength - (state.position - dro.dataStart) / 2;
+	unsigned char registerCode;
+	unsigned char reg;
+	unsigned char value;
+	unsigned long long songTimeMs = state.songUnits;
+
+	fileSeek(dro.file, state.position);
+	songStart();
+	while(remaining > 0 && !fileEnd(dro.file)) {
+		registerCode = fileRead(dro.file);
+		value        = fileRead(dro.file);
+		remaining --;
+
+		if (registerCode == dro.codeShortDelay) {
+			songTimeMs += value + 1;
+			songWait(songTimeMs * 1000000ULL, playerState(dro.file, songTimeMs, 0));
+		} else if (registerCode == dro.codeLongDelay) {
+			songTimeMs += (value + 1) << 8;
+			songWait(songTimeMs * 1000000ULL, playerState(dro.file, songTimeMs, 0));
+		} else if ((registerCode & 0x7F) < dro.registerMapLength) {
+			// Codes outside of the register map are invalid and skipped.
+			reg = dro.registerMap[registerCode & 0x7F];
+			songWrite((registerCode & 0x80) ? dro.highBank : 0, reg, value);
+		}
+	}
+
+	songEnd();
+}
+
+
+/**
+ * Load the header of a DOSBox raw OPL capture. Both the v0.1 and the v2.0 format are supported. The file is left
+ * positioned at the start of the song data.
+ */
+DRO loadDro(SongFile *droFile) {
+	DRO dro;
+	dro.file = NULL;
+	dro.chipType = CHIP_OPL2;
+
+	const char signature[] = "DBRAWOPL";
+	fileSeek(droFile, 0);
+	for (int i = 0; i < 8; i ++) {
+		if (fileRead(droFile) != signature[i]) {
+			return dro;
+		}
+	}
+
+	unsigned int versionMajor = readWord(droFile);
+	unsigned int versionMinor = readWord(droFile);
+
+	if (versionMajor == 2 && versionMinor == 0) {
+		// Hardware type of v2.0 files: 0 = OPL2, 1 = dual OPL2, 2 = OPL3.
+		dro.version = 2;
+		fileSeek(droFile, 12);
+		dro.songLength = readDWord(droFile);
+		fileSeek(droFile, 20);
+		dro.chipType = fileRead(droFile);
+
+		if (fileSeek(droFile, 23)) {
+			dro.codeShortDelay    = fileRead(droFile);
+			dro.codeLongDelay     = fileRead(droFile);
+			dro.registerMapLength = fileRead(droFile);
+
+			for (int i = 0; i < dro.registerMapLength; i ++) {
+				dro.registerMap[i] = fileRead(droFile);
+			}
+
+			dro.file = droFile;
+		}
+	} else if (versionMajor == 0 && versionMinor == 1) {
+		// Hardware type of v0.1 files: 0 = OPL2, 1 = OPL3, 2 = dual OPL2. Some versions of DOSBox store it as a single
+		// byte instead of a dword, in which case the upper bytes hold song data.
+		dro.version = 1;
+		fileSeek(droFile, 16);
+		dro.songLength = readDWord(droFile);
+		unsigned int hardwareType = readDWord(droFile);
+		if (hardwareType & 0xFFFFFF00) {
+			fileSeek(droFile, 21);
+			hardwareType &= 0xFF;
+		}
+
+		dro.chipType = hardwareType == 1 ? CHIP_OPL3 : hardwareType == 2 ? CHIP_DUAL_OPL2 : CHIP_OPL2;
+		dro.file = droFile;
+	}
+
+	if (dro.chipType > CHIP_OPL3) {
+		dro.chipType = CHIP_OPL2;
+	}
+	dro.highBank = dro.chipType == CHIP_DUAL_OPL2 ? 2 : 1;
+	dro.dataStart = droFile->position;
+
+	return dro;
+}
+
+
+void playImfMusic(IMF imf, PlayerState state) {
+	unsigned char reg;
+	unsigned char value;
+	unsigned int delayCycles;
+	unsigned long long songCycles = state.songUnits;
+
+	fileSeek(imf.file, state.position);
+	songStart();
+	while (imf.file->position + 3 < imf.endPosition && !fileEnd(imf.file)) {
+		reg   = fileRead(imf.file);
+		value = fileRead(imf.file);
+		delayCycles = readWord(imf.file);
+
+		songWrite(0, reg, value);
+		if (delayCycles > 0) {
+			songCycles += delayCycles;
+			songWait(songCycles * NS_PER_SECOND / imf.speed, playerState(imf.file, songCycles, 0));
+		}
+	}
+
+	songEnd();
+}
+
+
+IMF loadImf(SongFile *imfFile, int speed) {
+	IMF imf;
+
+	imf.file  = speed > 0 ? imfFile : NULL;
+	imf.speed = speed;
+	imf.songLength = readWord(imfFile);
+
+	imf.endPosition = imfFile->position + imf.songLength;
+
+	// If song length is 0 we're probably dealing with a type 0 file. In that
+	// case we want to play the file until EOF, so set songLength to max.
+	if (imf.songLength == 0) {
+		imf.songLength = 0xFFFFFFFF;
+		imf.endPosition = ULONG_MAX;
+		fileSeek(imfFile, 0);
+	}
+
+	return imf;
+}
+
+
+void playVgmMusic(VGM vgm, PlayerState state) {
+	unsigned char command;
+	unsigned char reg;
+	unsigned char data;
+	unsigned long long songSamples = state.songUnits;
+	bool isPlaying = true;
+
+	fileSeek(vgm.file, state.position);
+	// All waits are added to a 44.1 kHz sample counter and each register burst is scheduled against the absolute
+	// time of that sample since the start of the song, so rounding of short waits can never accumulate.
+	songStart();
+	while(isPlaying && !fileEnd(vgm.file)) {
+		if (vgm.file->position == vgm.loopOffset) {
+			songLoopPoint();
+		}
+
+		command = fileRead(vgm.file);
+
+		// Register write to one of the OPL chips of the song.
+		if (vgm.commandBank[command] != VGM_NO_BANK) {
+			reg  = fileRead(vgm.file);
+			data = fileRead(vgm.file);
+			songWrite(vgm.commandBank[command], reg, data);
+			continue;
+		}
+
+		switch (command) {
+			// Sample delay long.
+			case 0x61: {
+				songSamples += readWord(vgm.file);
+				break;
+			}
+
+			// 60 Hz delay.
+			case 0x62: {
+				songSamples += 735;
+				break;
+			}
+
+			// 50 Hz delay.
+			case 0x63: {
+				songSamples += 882;
+				break;
+			}
+
+			// End of song data. Stop or loop.
+			case 0x66: {
+				if (vgm.loopOffset > 0 && songRepeat()) {
+					fileSeek(vgm.file, vgm.loopOffset);
+				} else {
+					isPlaying = false;
+				}
+				break;
+			}
+
+			// Data block.
+			case 0x67: {
+				fileSeek(vgm.file, vgm.file->position + 2);
+				unsigned long size = readDWord(vgm.file) & 0x7FFFFFFF;
+				fileSeek(vgm.file, vgm.file->position + size);
+				break;
+			}
+
+			// Sample delay short.
+			case 0x70 ... 0x7F: {
+				songSamples += (command & 0x0F) + 1;
+				break;
+			}
+
+			// YM2612 DAC write and delay.
+			case 0x80 ... 0x8F: {
+				songSamples += command & 0x0F;
+				break;
+			}
+
+			// Commands for other chips.
+			default: {
+				fileSeek(vgm.file, vgm.file->position + vgmCommandLength(command));
+				break;
+			}
+		}
+
+		// Wait until the next register burst is due.
+		if ((command >= 0x61 && command <= 0x63) || (command >= 0x70 && command <= 0x8F)) {
+			songWait(songSamples * NS_PER_SECOND / VGM_SAMPLE_RATE, playerState(vgm.file, songSamples, 0));
+		}
+	}
+
+	songEnd();
+}
+
+
+/**
+ * Get the number of operand bytes of a VGM command that is not played.
+ *
+ * @param command - The VGM command.
+ * @return The number of bytes following the command.
+ */
+unsigned int vgmCommandLength(unsigned char command) {
+	switch (command) {
+		case 0x4F:
+		case 0x50:
+		case 0x94:
+			return 1;
+		case 0x68:
+			return 11;
+		case 0x90:
+		case 0x91:
+		case 0x95:
+			return 4;
+		case 0x92:
+			return 5;
+		case 0x93:
+			return 10;
+	}
+
+	if (command >= 0x30 && command <= 0x3F) return 1;
+	if (command >= 0x40 && command <= 0x5F) return 2;
+	if (command >= 0xA0 && command <= 0xBF) return 2;
+	if (command >= 0xC0 && command <= 0xDF) return 3;
+	if (command >= 0xE0) return 4;
+	return 0;
+}
+
+
+/**
+ * Load the header of a VGM file. The clocks of all OPL family chips are read from the header to decide which chip
+ * class to play the song on, and each chip of the song is assigned a register bank:
+ *  - A single YMF262 uses banks 0 and 1 of an OPL3; a dual YMF262 uses banks 0 to 3 of an OPL3 Duo.
+ *  - A single YM3812, YM3526 or Y8950 plays on an OPL2. Two of them play on the units of an OPL3 Duo in OPL2 mode.
+ * Commands of any further chips are skipped. The file is left positioned at the start of the song data.
+ */
+VGM loadVgm(SongFile *vgmFile) {
+	VGM vgm;
+	vgm.file = NULL;
+	memset(vgm.commandBank, VGM_NO_BANK, sizeof(vgm.commandBank));
+
+	if (fileRead(vgmFile) != 0x56 || fileRead(vgmFile) != 0x67 || fileRead(vgmFile) != 0x6D) {
+		return vgm;
+	}
+
+	// Song data starts at 0x40 for files older than v1.50.
+	fileSeek(vgmFile, 0x34);
+	unsigned long dataOffset = readDWord(vgmFile);
+	dataOffset = dataOffset > 0 ? dataOffset + 0x34 : 0x40;
+
+	// Clocks of YM3812, YM3526, Y8950 and YMF262, only present when the header is long enough.
+	unsigned long clocks[4] = { 0, 0, 0, 0 };
+	for (unsigned int i = 0; i < 4; i ++) {
+		if (0x50 + i * 4 + 4 <= dataOffset) {
+			fileSeek(vgmFile, 0x50 + i * 4);
+			clocks[i] = readDWord(vgmFile);
+		}
+	}
+
+	if (clocks[VGM_YMF262] & 0x3FFFFFFF) {
+		bool isDual = clocks[VGM_YMF262] & 0x40000000;
+		vgm.chipType = isDual ? CHIP_DUAL_OPL3 : CHIP_OPL3;
+		vgm.commandBank[0x5E] = 0;
+		vgm.commandBank[0x5F] = 1;
+		if (isDual) {
+			vgm.commandBank[0xAE] = 2;
+			vgm.commandBank[0xAF] = 3;
+		}
+	} else {
+		const unsigned char commands[3] = { 0x5A, 0x5B, 0x5C };
+		unsigned char numChips = 0;
+
+		for (int i = VGM_YM3812; i <= VGM_Y8950; i ++) {
+			if (clocks[i] & 0x3FFFFFFF) {
+				if (numChips < 2) vgm.commandBank[commands[i]] = numChips++ * 2;
+				if (numChips < 2 && (clocks[i] & 0x40000000)) vgm.commandBank[commands[i] + 0x50] = numChips++ * 2;
+			}
+		}
+
+		if (numChips == 0) {
+			printf("No OPL sample data!\n");
+			return vgm;
+		}
+		vgm.chipType = numChips == 2 ? CHIP_DUAL_OPL2 : CHIP_OPL2;
+	}
+
+	fileSeek(vgmFile, 0x18);
+	vgm.songLength = readDWord(vgmFile);
+	vgm.loopOffset = readDWord(vgmFile);
+	vgm.loopLength = readDWord(vgmFile);
+
+	// Loop offset is relative to its own position in the header.
+	if (vgm.loopOffset > 0) {
+		vgm.loopOffset += 0x1C;
+	}
+
+	fileSeek(vgmFile, dataOffset);
+	vgm.file = vgmFile;
+	return vgm;
+}
@@ -0,0 +1,107 @@
+#ifndef SONGFORMATS_H_
+	#define SONGFORMATS_H_
+
+	#include <zlib.h>
+
+	#define WINDOW_SIZE 16384
+	#define VGM_SAMPLE_RATE 44100
+	#define NS_PER_SECOND 1000000000ULL
+
+	#define CHIP_OPL2      0
+	#define CHIP_DUAL_OPL2 1
+	#define CHIP_OPL3      2
+	#define CHIP_DUAL_OPL3 3
+
+	#define VGM_YM3812 0
+	#define VGM_YM3526 1
+	#define VGM_Y8950  2
+	#define VGM_YMF262 3
+	#define VGM_NO_BANK 0xFF
+
+
+	typedef struct SongFile {
+		int fd;
+		unsigned char *fileData;		// Mapped or buffered contents of the file on disk.
+		unsigned long fileSize;
+		bool isMapped;
+		z_stream *inflater;				// Inflate state for gzip compressed files, NULL otherwise.
+		unsigned char *window;			// Window of inflated song data for compressed files, or all of it.
+		unsigned char *data;			// Song data that is currently available (file data or window).
+		unsigned long dataStart;		// Position of the first byte of data in the song.
+		unsigned long dataLength;		// Number of bytes available in data.
+		bool isEndOfData;				// No more data can be added after the current data.
+		unsigned long position;			// Read position in the (uncompressed) song.
+	} SongFile;
+
+
+	typedef struct PlayerState {
+		unsigned long position;			// Position in the song file.
+		unsigned long long songUnits;	// Song time in the time unit of the song format.
+		unsigned char bank;				// Selected register bank (DRO v0.1 only).
+	} PlayerState;
+
+
+	typedef struct DRO {
+		SongFile *file;
+		unsigned char version;			// 1 for DRO v0.1, 2 for DRO v2.0.
+		unsigned char chipType;			// One of CHIP_OPL2, CHIP_DUAL_OPL2 or CHIP_OPL3.
+		unsigned char highBank;			// Bank used for writes to the second chip or OPL3 high bank.
+		unsigned long songLength;		// Song length in register pairs (v2.0) or bytes (v0.1).
+		unsigned long dataStart;		// Position of the song data in the file.
+		unsigned char codeShortDelay;
+		unsigned char codeLongDelay;
+		unsigned char registerMapLength;
+		unsigned char registerMap[256];
+	} DRO;
+
+
+	typedef struct IMF {
+		SongFile *file;
+		unsigned long songLength;
+		unsigned long endPosition;
+		int speed;
+	} IMF;
+	
+	
+	typedef struct VGM {
+		SongFile *file;
+		unsigned char chipType;			// One of CHIP_OPL2, CHIP_DUAL_OPL2, CHIP_OPL3 or CHIP_DUAL_OPL3.
+		unsigned char commandBank[256];	// Register bank for each OPL write command or VGM_NO_BANK.
+		unsigned long songLength;
+		unsigned long loopOffset;
+		unsigned long loopLength;
+	} VGM;
+
+
+	// Functions that decode the song files.
+	DRO loadDro(SongFile *droFile);
+	IMF loadImf(SongFile *imfFile, int speed);
+	VGM loadVgm(SongFile *vgmFile);
+	void playDroMusic(DRO dro, PlayerState state);
+	void playDroV1Music(DRO dro, PlayerState state);
+	void playDroV2Music(DRO dro, PlayerState state);
+	void playImfMusic(IMF imf, PlayerState state);
+	void playVgmMusic(VGM vgm, PlayerState state);
+	unsigned int vgmCommandLength(unsigned char command);
+	PlayerState initialState(SongFile *file);
+	PlayerState playerState(SongFile *file, unsigned long long songUnits, unsigned char bank);
+	bool openSongFile(SongFile *song, const char *fileName);
+	void closeSongFile(SongFile *song);
+	void rewindInflater(SongFile *song);
+	bool inflateSong(SongFile *song);
+	bool fillWindow(SongFile *song);
+	bool fileFetch(SongFile *song, unsigned long position);
+	bool fileSeek(SongFile *song, unsigned long position);
+	bool fileEnd(SongFile *song);
+	unsigned char fileRead(SongFile *song);
+	unsigned int readWord(SongFile *song);
+	unsigned int readDWord(SongFile *song);
+
+	// Functions that receive the decoded song. These are implemented by the tool that uses the song decoders.
+	void songStart();
+	void songWrite(unsigned char bank, unsigned char reg, unsigned char value);
+	void songWait(unsigned long long songTime, PlayerState state);
+	void songLoopPoint();
+	bool songRepeat();
+	void songEnd();
+#endif
@@ -0,0 +1,293 @@
+/**
+ * oplconvert converts VGM, VGZ, DRO and IMF files into the OPL Compact Song format that can be played by the
+ * CompactSong class of the library. Conversion happens offline, so the microcontroller only has to deal with register
+ * bursts and waits. Commands for other chips, headers and tags are dropped, all times are converted to 44.1 kHz
+ * samples and register writes are resolved to the register bank and synth unit they are played on.
+ *
+ * Song files are read and decoded by the same code as opl2play, found in ../opl2play/songformats.cpp. This tool does
+ * not need WiringPi or an OPL board and can be built on any Linux machine with:
+ *   g++ -std=c++11 -Wall -o oplconvert oplconvert.cpp ../opl2play/songformats.cpp -lz
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+#include <stdio.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <algorithm>
+#include <functional>
+#include "oplconvert.h"
+
+
+SongFile songFile;
+Song song;
+
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		showHelp();
+		return 0;
+	}
+
+	// The whole song is read anyway, so compressed files are inflated at once.
+	if (!openSongFile(&songFile, argv[1]) || !inflateSong(&songFile)) {
+		printf("Unable to read %s\n", argv[1]);
+		return 1;
+	}
+
+	char ext[8] = "";
+	const char *dot = strrchr(argv[1], '.');
+	if (dot != NULL) {
+		for (int i = 0; dot[i] && i < 7; i ++) {
+			ext[i] = tolower(dot[i]);
+			ext[i + 1] = 0;
+		}
+	}
+
+	song.chipType = OCS_CHIP_OPL2;
+	song.songTime = 0;
+	song.songSamples = 0;
+
+	// The CHIP_* types of the song decoders have the same values as OCS_CHIP_*.
+	bool isConverted = false;
+	if (strcmp(ext, ".dro") == 0) {
+		DRO dro = loadDro(&songFile);
+		if (dro.file != NULL) {
+			song.chipType = dro.chipType;
+			playDroMusic(dro, initialState(dro.file));
+			isConverted = true;
+		}
+	} else if (strcmp(ext, ".imf") == 0 || strcmp(ext, ".wlf") == 0) {
+		IMF imf = loadImf(&songFile, argc > 3 ? atoi(argv[3]) : 560);
+		if (imf.file != NULL) {
+			song.chipType = OCS_CHIP_OPL2;
+			playImfMusic(imf, initialState(imf.file));
+			isConverted = true;
+		}
+	} else if (strcmp(ext, ".vgm") == 0 || strcmp(ext, ".vgz") == 0 || strcmp(ext, ".gz") == 0) {
+		VGM vgm = loadVgm(&songFile);
+		if (vgm.file != NULL) {
+			song.chipType = vgm.chipType;
+			playVgmMusic(vgm, initialState(vgm.file));
+			isConverted = true;
+		}
+	} else {
+		printf("Unsupported file type %s\n", ext);
+		return 1;
+	}
+
+	unsigned long songSize = songFile.dataLength;
+	closeSongFile(&songFile);
+	if (!isConverted) {
+		printf("%s is not a valid or supported song file\n", argv[1]);
+		return 1;
+	}
+
+	std::vector<unsigned char> output;
+	encodeSong(song, output);
+
+	FILE *outputFile = fopen(argv[2], "wb");
+	if (outputFile == NULL || fwrite(output.data(), 1, output.size(), outputFile) != output.size()) {
+		printf("Unable to write %s\n", argv[2]);
+		if (outputFile != NULL) fclose(outputFile);
+		return 1;
+	}
+	fclose(outputFile);
+
+	printf("Converted %s (%lu bytes) to %s (%lu bytes), %.1f seconds\n",
+		argv[1], songSize, argv[2], (unsigned long)output.size(),
+		song.songSamples / (float)OCS_SAMPLE_RATE);
+	return 0;
+}
+
+
+void songStart() {
+}
+
+
+void songWrite(unsigned char bank, unsigned char reg, unsigned char value) {
+	addWrite(song, bank, reg, value);
+}
+
+
+void songWait(unsigned long long songTime, PlayerState state) {
+	addWaitUntil(song, songTime);
+}
+
+
+void songLoopPoint() {
+	addLoop(song);
+}
+
+
+/**
+ * Songs are converted up to their end. The loop point is stored in the converted song instead.
+ *
+ * @return Always false.
+ */
+bool songRepeat() {
+	return false;
+}
+
+
+void songEnd() {
+}
+
+
+void addWrite(Song &song, unsigned char bank, unsigned char reg, unsigned char value) {
+	SongEvent event = { EVENT_WRITE, bank, reg, value, 0 };
+	song.events.push_back(event);
+}
+
+
+/**
+ * Add a wait until the given song time. Song time is rounded to the nearest sample, so rounding of individual waits
+ * never accumulates over the song.
+ *
+ * @param songTime - Time in ns since the start of the song.
+ */
+void addWaitUntil(Song &song, unsigned long long songTime) {
+	unsigned long targetSamples = (songTime * OCS_SAMPLE_RATE + NS_PER_SECOND / 2) / NS_PER_SECOND;
+	if (targetSamples <= song.songSamples) {
+		return;
+	}
+
+	unsigned long samples = targetSamples - song.songSamples;
+	song.songTime = songTime;
+	song.songSamples = targetSamples;
+
+	// Merge consecutive waits.
+	if (!song.events.empty() && song.events.back().type == EVENT_WAIT) {
+		song.events.back().samples += samples;
+	} else {
+		SongEvent event = { EVENT_WAIT, 0, 0, 0, samples };
+		song.events.push_back(event);
+	}
+}
+
+
+void addLoop(Song &song) {
+	SongEvent event = { EVENT_LOOP, 0, 0, 0, 0 };
+	song.events.push_back(event);
+}
+
+
+/**
+ * Find the most common waits that do not fit a short wait command. These are usually the frame rate of the game the
+ * song was ripped from and the lengths of its notes, so a song only uses a handful of them. Each entry in the wait
+ * table takes two bytes in the header and turns a wait of three or more bytes into a single byte, so only waits that
+ * occur more than once are put in the table.
+ *
+ * @return The number of samples of up to OCS_MAX_WAIT_TABLE waits, most common first.
+ */
+std::vector<unsigned long> findWaitTable(const Song &song) {
+	std::map<unsigned long, unsigned long> counts;
+	for (const SongEvent &event : song.events) {
+		if (event.type == EVENT_WAIT && event.samples > OCS_MAX_SHORT_WAIT && event.samples <= 0xFFFF) {
+			counts[event.samples] ++;
+		}
+	}
+
+	std::vector<std::pair<unsigned long, unsigned long> > waits;
+	for (const auto &count : counts) {
+		if (count.second > 1) {
+			waits.push_back(std::make_pair(count.second, count.first));
+		}
+	}
+	std::sort(waits.begin(), waits.end(), std::greater<std::pair<unsigned long, unsigned long> >());
+
+	std::vector<unsigned long> waitTable;
+	for (size_t i = 0; i < waits.size() && i < OCS_MAX_WAIT_TABLE; i ++) {
+		waitTable.push_back(waits[i].second);
+	}
+
+	return waitTable;
+}
+
+
+/**
+ * Encode the song into the OPL Compact Song format. Register writes to the same bank are grouped into bursts of up to
+ * OCS_MAX_BURST writes. A burst is only broken by a change of bank, a wait or the loop point.
+ */
+void encodeSong(const Song &song, std::vector<unsigned char> &output) {
+	std::vector<unsigned long> waitTable = findWaitTable(song);
+	unsigned long loopOffset = 0;
+
+	output.assign(OCS_HEADER_SIZE, 0);
+	output[0] = 'O';
+	output[1] = 'C';
+	output[2] = 'S';
+	output[3] = OCS_VERSION;
+	output[4] = song.chipType;
+	output[5] = waitTable.size();
+	for (unsigned long samples : waitTable) {
+		output.push_back(samples & 0xFF);
+		output.push_back(samples >> 8);
+	}
+
+	size_t i = 0;
+	while (i < song.events.size()) {
+		const SongEvent &event = song.events[i];
+
+		if (event.type == EVENT_WAIT) {
+			encodeWait(output, event.samples, waitTable);
+			i ++;
+		} else if (event.type == EVENT_LOOP) {
+			loopOffset = output.size();
+			i ++;
+		} else {
+			// Collect a burst of writes to the same bank.
+			size_t burstEnd = i;
+			while (burstEnd < song.events.size() && burstEnd - i < OCS_MAX_BURST &&
+				song.events[burstEnd].type == EVENT_WRITE && song.events[burstEnd].bank == event.bank) {
+				burstEnd ++;
+			}
+
+			output.push_back(OCS_CMD_BURST | (event.bank << 4) | (burstEnd - i - 1));
+			for (; i < burstEnd; i ++) {
+				output.push_back(song.events[i].reg);
+				output.push_back(song.events[i].value);
+			}
+		}
+	}
+
+	output.push_back(OCS_CMD_END);
+	writeDWord(output, 8, loopOffset);
+	writeDWord(output, 12, song.songSamples);
+}
+
+
+void encodeWait(std::vector<unsigned char> &output, unsigned long samples, const std::vector<unsigned long> &waitTable) {
+	std::vector<unsigned long>::const_iterator entry = std::find(waitTable.begin(), waitTable.end(), samples);
+	if (entry != waitTable.end()) {
+		output.push_back(OCS_CMD_WAIT_TABLE + (entry - waitTable.begin()));
+	} else if (samples <= OCS_MAX_SHORT_WAIT) {
+		output.push_back(OCS_CMD_WAIT_SHORT + samples - 1);
+	} else {
+		output.push_back(OCS_CMD_WAIT);
+		while (samples >= 0x80) {
+			output.push_back((samples & 0x7F) | 0x80);
+			samples >>= 7;
+		}
+		output.push_back(samples);
+	}
+}
+
+
+void writeDWord(std::vector<unsigned char> &data, unsigned long offset, unsigned long value) {
+	for (int i = 0; i < 4; i ++) {
+		data[offset + i] = (value >> (i * 8)) & 0xFF;
+	}
+}
+
+
+void showHelp() {
+	printf("oplconvert - Convert songs to the OPL Compact Song format\n\n");
+	printf("Usage: oplconvert input output.ocs [imf speed]\n\n");
+	printf("Supported input formats are VGM and VGZ (YM3812, YM3526, Y8950 and YMF262), DRO v0.1 and\n");
+	printf("v2.0 and IMF or WLF. IMF files are played at 560 Hz unless a different speed is given.\n");
+	printf("The resulting file can be played with the CompactSong class of the library.\n\n");
+}
@@ -0,0 +1,39 @@
+#ifndef OPLCONVERT_H_
+	#define OPLCONVERT_H_
+
+	#include <vector>
+	#include "../../src/CompactSongFormat.h"
+	#include "../opl2play/songformats.h"
+
+	#define EVENT_WRITE 0
+	#define EVENT_WAIT  1
+	#define EVENT_LOOP  2
+
+
+	typedef struct SongEvent {
+		unsigned char type;
+		unsigned char bank;
+		unsigned char reg;
+		unsigned char value;
+		unsigned long samples;			// Number of samples to wait for wait events.
+	} SongEvent;
+
+
+	typedef struct Song {
+		unsigned char chipType;			// One of OCS_CHIP_*.
+		std::vector<SongEvent> events;
+		unsigned long long songTime;	// Time of the last wait in ns since the start of the song.
+		unsigned long songSamples;		// Time of the last wait in samples since the start of the song.
+	} Song;
+
+
+	int main(int argc, char **argv);
+	void addWrite(Song &song, unsigned char bank, unsigned char reg, unsigned char value);
+	void addWaitUntil(Song &song, unsigned long long songTime);
+	void addLoop(Song &song);
+	std::vector<unsigned long> findWaitTable(const Song &song);
+	void encodeSong(const Song &song, std::vector<unsigned char> &output);
+	void encodeWait(std::vector<unsigned char> &output, unsigned long samples, const std::vector<unsigned long> &waitTable);
+	void writeDWord(std::vector<unsigned char> &data, unsigned long offset, unsigned long value);
+	void showHelp();
+#endif
@@ -0,0 +1,97 @@
+/**
+ * This program benchmarks the register write path of the OPL2 Audio Board or OPL3 Duo! on the Raspberry Pi by playing
+ * digitized samples with the SamplePlayer. First it measures how many full register writes and how many data only
+ * writes can be made per second, where the latter is the highest sample rate the board can reach. Then it plays a
+ * 500 Hz tone as samples at increasing sample rates and reports the sample rate that was achieved and the number of
+ * samples that were late.
+ *
+ * Usage: samplebenchmark [opl2 | opl3duo]
+ *
+ * Code by Maarten Janssen (maarten@cheerful.nl)
+ * Most recent version of the library can be found at my GitHub: https://github.com/DhrBaksteen/ArduinoOPL2
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <wiringPi.h>
+#include <OPL3Duo.h>
+#include <SamplePlayer.h>
+
+
+#define NUM_WRITES     10000
+#define TONE_PERIOD       16		// Samples per period of the tone.
+#define PLAY_TIME          2		// Seconds to play at each sample rate.
+
+const unsigned int sampleRates[] = { 8000, 11025, 16000, 22050, 32000, 44100 };
+
+OPL2 opl2;
+OPL3Duo opl3Duo;
+byte tone[TONE_PERIOD];
+
+
+/**
+ * Sample reader that repeats a single period of the tone.
+ */
+int readTone(unsigned long offset, byte *buffer, unsigned int length) {
+	for (unsigned int i = 0; i < length; i ++) {
+		buffer[i] = tone[(offset + i) % TONE_PERIOD];
+	}
+	return length;
+}
+
+
+/**
+ * Print the number of events per second.
+ */
+void reportRate(const char *label, unsigned long count, unsigned long duration) {
+	printf("%s%lu\n", label, (unsigned long)(count * 1000000.0 / duration));
+}
+
+
+int main(int argc, char **argv) {
+	bool useOPL3Duo = argc > 1 && strcmp(argv[1], "opl3duo") == 0;
+	OPL2 *opl = useOPL3Duo ? &opl3Duo : &opl2;
+	SamplePlayer player(opl);
+
+	printf("Benchmarking the %s\n", useOPL3Duo ? "OPL3 Duo!" : "OPL2 Audio Board");
+	opl->begin();
+
+	for (byte i = 0; i < TONE_PERIOD; i ++) {
+		tone[i] = 128 + 100 * sin(i * 2.0 * M_PI / TONE_PERIOD);
+	}
+
+	// Full register writes select the register and then write its data.
+	unsigned long start = micros();
+	for (unsigned int i = 0; i < NUM_WRITES; i ++) {
+		opl->write(0x40, 0x3F);
+	}
+	reportRate("Full writes per second: ", NUM_WRITES, micros() - start);
+
+	// Data writes only write the data of the selected register, this is the highest rate samples can be played at.
+	player.begin();
+	start = micros();
+	for (unsigned int i = 0; i < NUM_WRITES; i ++) {
+		player.writeSample(0x80);
+	}
+	reportRate("Data writes per second: ", NUM_WRITES, micros() - start);
+
+	for (byte i = 0; i < sizeof(sampleRates) / sizeof(sampleRates[0]); i ++) {
+		unsigned long numSamples = (unsigned long)sampleRates[i] * PLAY_TIME;
+		player.play(readTone, numSamples, sampleRates[i]);
+		start = micros();
+		while (player.isPlaying()) {
+			player.update();
+			usleep(1000);
+		}
+		unsigned long duration = micros() - start;
+
+		printf("Requested %u Hz, ", sampleRates[i]);
+		reportRate("achieved ", numSamples, duration);
+		printf("  Late samples: %u\n", player.getUnderruns());
+	}
+
+	return 0;
+}
@@ -0,0 +1,533 @@
+/**
+ * Player for Creative Music Files (CMF) as used by Sound Blaster software. A CMF file holds a block of SBI instruments
+ * followed by a single track of MIDI events. The instruments are converted once when the song is loaded and the MIDI
+ * events are streamed through a callback in fixed size blocks, so songs of any length play with the same amount of RAM.
+ *
+ * Melodic MIDI channels are dynamically assigned to the nine OPL2 channels. When a song enables rhythm mode the
+ * channels 7 - 9 of the OPL2 are used for the drums, which are played by MIDI channels 12 - 16.
+ */
+
+#include "CMFPlayer.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+#endif
+
+
+#define CMF_NO_INSTRUMENT 0xFF
+
+static const byte cmfDrumBits[NUM_DRUM_SOUNDS] = {
+	DRUM_BITS_BASS, DRUM_BITS_SNARE, DRUM_BITS_TOM, DRUM_BITS_CYMBAL, DRUM_BITS_HI_HAT
+};
+
+// Piano that plays the melodic voices of songs without any instruments.
+static const byte cmfDefaultInstrument[11] = {
+	0x00, 0x01, 0x4F, 0xF1, 0x53, 0x06, 0x11, 0x00, 0xD2, 0x74, 0x00
+};
+
+
+/**
+ * Create a CMF player.
+ *
+ * @param opl2Ref - Reference to the OPL2 instance used for playback.
+ */
+CMFPlayer::CMFPlayer(OPL2* opl2Ref) {
+	opl2 = opl2Ref;
+}
+
+
+/**
+ * Load a song and prepare it for playback. The instruments of the song are read and converted into the packed
+ * instrument format of the library. The OPL2 must have been initialized by calling its begin function before loading
+ * a song.
+ *
+ * @param songReader - Callback that reads song data.
+ * @return True if the song data is a valid CMF file.
+ */
+bool CMFPlayer::load(CMFReader songReader) {
+	reader = songReader;
+	ended = true;
+
+	if (!fillBuffer(0) || bufferLength < 0x28) {
+		return false;
+	}
+
+	if (buffer[0] != 'C' || buffer[1] != 'T' || buffer[2] != 'M' || buffer[3] != 'F') {
+		return false;
+	}
+
+	unsigned int instrumentOffset = buffer[0x06] + (buffer[0x07] << 8);
+	musicOffset    = buffer[0x08] + (buffer[0x09] << 8);
+	ticksPerSecond = buffer[0x0C] + (buffer[0x0D] << 8);
+	if (ticksPerSecond == 0) {
+		return false;
+	}
+	tickDuration  = 1000000UL / ticksPerSecond;
+	tickRemainder = 1000000UL % ticksPerSecond;
+
+	// Version 1.0 stores the number of instruments in a byte, later versions in a word.
+	unsigned int numSongInstruments = buffer[0x24];
+	if (buffer[0x04] > 0x00) {
+		numSongInstruments += buffer[0x25] << 8;
+	}
+	numInstruments = numSongInstruments < CMF_MAX_INSTRUMENTS ? numSongInstruments : CMF_MAX_INSTRUMENTS;
+
+	// Instruments are stored as 16 bytes of SBI register data with modulator and carrier registers interleaved.
+	position = instrumentOffset;
+	ended = false;
+	for (byte i = 0; i < numInstruments; i ++) {
+		byte data[16];
+		for (byte j = 0; j < 16; j ++) {
+			data[j] = readByte();
+		}
+		if (ended) {
+			return false;
+		}
+
+		instruments[i][0]  = 0x00;
+		instruments[i][1]  = data[0];
+		instruments[i][2]  = data[2];
+		instruments[i][3]  = data[4];
+		instruments[i][4]  = data[6];
+		instruments[i][5]  = data[10];
+		instruments[i][6]  = data[1];
+		instruments[i][7]  = data[3];
+		instruments[i][8]  = data[5];
+		instruments[i][9]  = data[7];
+		instruments[i][10] = (data[8] & 0x07) + ((data[9] & 0x07) << 4);
+	}
+
+	if (numInstruments == 0) {
+		for (byte i = 0; i < 11; i ++) {
+			instruments[0][i] = cmfDefaultInstrument[i];
+		}
+	}
+
+	opl2->setWaveFormSelect(true);
+	restart();
+	return true;
+}
+
+
+/**
+ * Restart the song from the beginning.
+ */
+void CMFPlayer::restart() {
+	silence();
+	setRhythmMode(false);
+
+	for (byte i = 0; i < CMF_NUM_MIDI_CHANNELS; i ++) {
+		programs[i] = 0;
+	}
+	for (byte i = 0; i < CMF_NUM_VOICES; i ++) {
+		voices[i].instrument = CMF_NO_INSTRUMENT;
+		voices[i].startTime = 0;
+	}
+	for (byte i = 0; i < NUM_DRUM_SOUNDS; i ++) {
+		drumInstruments[i] = CMF_NO_INSTRUMENT;
+	}
+
+	position = musicOffset;
+	runningStatus = 0;
+	noteCounter = 0;
+	ended = false;
+
+	nextEventTime = micros();
+	tickFraction = 0;
+	wait(readVarLength());
+}
+
+
+/**
+ * Play the loaded song until it ends. When looping is enabled this function does not return.
+ */
+void CMFPlayer::play() {
+	while (!ended) {
+		update();
+	}
+}
+
+
+/**
+ * Update the player to play the song in the background. All MIDI events that are due are processed and the time until
+ * the next event is returned. If it is not yet time to process the next event this function exits immediately.
+ *
+ * @return The number of us until update should be called again.
+ */
+unsigned long CMFPlayer::update() {
+	while (!ended && (long)(micros() - nextEventTime) >= 0) {
+		processEvent();
+		if (!ended) {
+			wait(readVarLength());
+		}
+	}
+
+	long remaining = (long)(nextEventTime - micros());
+	return ended || remaining < 0 ? 0 : remaining;
+}
+
+
+/**
+ * Has the song ended?
+ *
+ * @return True if the end of the song has been reached and looping is disabled.
+ */
+bool CMFPlayer::songEnded() {
+	return ended;
+}
+
+
+/**
+ * Enable or disable looping of the song.
+ *
+ * @param enable - Restart the song when its end is reached.
+ */
+void CMFPlayer::setLoop(bool enable) {
+	loop = enable;
+}
+
+
+/**
+ * Get the number of instruments that were loaded from the song.
+ *
+ * @return The number of instruments, at most CMF_MAX_INSTRUMENTS.
+ */
+byte CMFPlayer::getNumInstruments() {
+	return numInstruments;
+}
+
+
+/**
+ * Process the next MIDI event. Data bytes without a status byte reuse the status of the previous channel event.
+ */
+void CMFPlayer::processEvent() {
+	byte status = readByte();
+	byte data;
+
+	if (status & 0x80) {
+		if (status >= 0xF0) {
+			processSystemEvent(status);
+			return;
+		}
+		runningStatus = status;
+		data = readByte();
+	} else {
+		data = status;
+		status = runningStatus;
+	}
+
+	byte channel = status & 0x0F;
+	switch (status & 0xF0) {
+		case 0x80:
+			readByte();
+			noteOff(channel, data);
+			break;
+
+		case 0x90:
+			if (readByte() > 0) {
+				noteOn(channel, data);
+			} else {
+				noteOff(channel, data);
+			}
+			break;
+
+		case 0xB0:
+			controlChange(channel, data, readByte());
+			break;
+
+		case 0xC0:
+			programs[channel] = data;
+			break;
+
+		case 0xA0:
+		case 0xE0:
+			readByte();
+			break;
+	}
+}
+
+
+/**
+ * Process a system exclusive or meta event. All of them are skipped except for the end of track event, which ends or
+ * restarts the song.
+ *
+ * @param status - Status byte of the event.
+ */
+void CMFPlayer::processSystemEvent(byte status) {
+	byte type = status == 0xFF ? readByte() : 0x00;
+	unsigned long length = readVarLength();
+
+	if (status == 0xFF && type == 0x2F) {
+		if (loop) {
+			restart();
+		} else {
+			silence();
+			ended = true;
+		}
+		return;
+	}
+
+	position += length;
+}
+
+
+/**
+ * Start a note. In rhythm mode notes on MIDI channels 12 - 16 play the drums.
+ *
+ * @param channel - MIDI channel of the note.
+ * @param note - MIDI note number.
+ */
+void CMFPlayer::noteOn(byte channel, byte note) {
+	byte octave = note / 12 > 0 ? note / 12 - 1 : 0;
+	octave = octave < 7 ? octave : 7;
+
+	if (isRhythmMode && channel >= CMF_DRUM_CHANNEL) {
+		byte drum = channel - CMF_DRUM_CHANNEL;
+		if (drumInstruments[drum] != programs[channel]) {
+			setDrumInstrument(drum, programs[channel]);
+		}
+		opl2->playDrum(drum, octave, note % 12);
+		return;
+	}
+
+	byte voice = allocateVoice(channel);
+	CMFVoice &cmfVoice = voices[voice];
+	if (cmfVoice.isKeyOn) {
+		opl2->setChannelRegister(0xB0, voice, opl2->getChannelRegister(0xB0, voice) & 0x1F);
+	}
+	if (cmfVoice.instrument != programs[channel]) {
+		loadVoiceInstrument(voice, programs[channel]);
+	}
+
+	short fNumber = opl2->getNoteFNumber(note % 12);
+	opl2->setChannelRegister(0xA0, voice, fNumber & 0xFF);
+	opl2->setChannelRegister(0xB0, voice, 0x20 + (octave << 2) + ((fNumber >> 8) & 0x03));
+
+	cmfVoice.channel = channel;
+	cmfVoice.note = note;
+	cmfVoice.isKeyOn = true;
+	cmfVoice.startTime = noteCounter ++;
+}
+
+
+/**
+ * Release a note.
+ *
+ * @param channel - MIDI channel of the note.
+ * @param note - MIDI note number.
+ */
+void CMFPlayer::noteOff(byte channel, byte note) {
+	if (isRhythmMode && channel >= CMF_DRUM_CHANNEL) {
+		opl2->setDrums(opl2->getDrums() & ~cmfDrumBits[channel - CMF_DRUM_CHANNEL]);
+		return;
+	}
+
+	for (byte i = 0; i < numMelodicVoices; i ++) {
+		if (voices[i].isKeyOn && voices[i].channel == channel && voices[i].note == note) {
+			opl2->setChannelRegister(0xB0, i, opl2->getChannelRegister(0xB0, i) & 0x1F);
+			voices[i].isKeyOn = false;
+		}
+	}
+}
+
+
+/**
+ * Process a MIDI controller. CMF uses controller 0x67 to switch rhythm mode.
+ *
+ * @param channel - MIDI channel of the controller.
+ * @param control - Controller number.
+ * @param value - New value of the controller.
+ */
+void CMFPlayer::controlChange(byte channel, byte control, byte value) {
+	switch (control) {
+		case CMF_CONTROL_RHYTHM_MODE:
+			setRhythmMode(value != 0);
+			break;
+
+		case CMF_CONTROL_NOTES_OFF:
+			for (byte i = 0; i < numMelodicVoices; i ++) {
+				if (voices[i].isKeyOn && voices[i].channel == channel) {
+					noteOff(channel, voices[i].note);
+				}
+			}
+			break;
+	}
+}
+
+
+/**
+ * Find a voice to play a note of the given MIDI channel on. A free voice that already has the instrument of the
+ * channel is preferred, then any free voice and finally the voice that has been playing the longest is taken.
+ *
+ * @param channel - MIDI channel of the note.
+ * @return The OPL2 channel to play the note on.
+ */
+byte CMFPlayer::allocateVoice(byte channel) {
+	byte freeVoice = CMF_NUM_VOICES;
+	byte oldestVoice = 0;
+
+	for (byte i = 0; i < numMelodicVoices; i ++) {
+		if (!voices[i].isKeyOn) {
+			if (voices[i].instrument == programs[channel]) {
+				return i;
+			}
+			if (freeVoice == CMF_NUM_VOICES) {
+				freeVoice = i;
+			}
+		}
+		if ((unsigned int)(noteCounter - voices[i].startTime) > (unsigned int)(noteCounter - voices[oldestVoice].startTime)) {
+			oldestVoice = i;
+		}
+	}
+
+	return freeVoice < CMF_NUM_VOICES ? freeVoice : oldestVoice;
+}
+
+
+/**
+ * Load a packed instrument into a melodic voice. Instrument numbers the song doesn't have use the first instrument, or
+ * the default piano when the song has no instruments at all.
+ *
+ * @param voice - OPL2 channel to load the instrument into.
+ * @param instrument - Instrument number of the song.
+ */
+void CMFPlayer::loadVoiceInstrument(byte voice, byte instrument) {
+	const byte *data = instruments[instrument < numInstruments ? instrument : 0];
+
+	for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+		opl2->setOperatorRegister(0x20, voice, op, data[op * 5 + 1]);
+		opl2->setOperatorRegister(0x40, voice, op, data[op * 5 + 2]);
+		opl2->setOperatorRegister(0x60, voice, op, data[op * 5 + 3]);
+		opl2->setOperatorRegister(0x80, voice, op, data[op * 5 + 4]);
+	}
+	opl2->setOperatorRegister(0xE0, voice, OPERATOR1, data[10] & 0x07);
+	opl2->setOperatorRegister(0xE0, voice, OPERATOR2, (data[10] >> 4) & 0x07);
+	opl2->setChannelRegister(0xC0, voice, data[5] & 0x0F);
+
+	voices[voice].instrument = instrument;
+}
+
+
+/**
+ * Load a packed instrument into a drum.
+ *
+ * @param drum - The drum to set the instrument of.
+ * @param instrument - Instrument number of the song.
+ */
+void CMFPlayer::setDrumInstrument(byte drum, byte instrument) {
+	if (numInstruments == 0) {
+		return;
+	}
+
+	const byte *data = instruments[instrument < numInstruments ? instrument : 0];
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+		opl2->setDrumInstrument(opl2->loadInstrument(data, INSTRUMENT_DATA_SRAM), drum);
+	#else
+		opl2->setDrumInstrument(opl2->loadInstrument(data), drum);
+	#endif
+	drumInstruments[drum] = instrument;
+}
+
+
+/**
+ * Enable or disable rhythm mode. In rhythm mode only OPL2 channels 1 - 6 are used for melodic voices.
+ *
+ * @param enable - Enable rhythm mode when true.
+ */
+void CMFPlayer::setRhythmMode(bool enable) {
+	isRhythmMode = enable;
+	numMelodicVoices = enable ? 6 : CMF_NUM_VOICES;
+
+	for (byte i = numMelodicVoices; i < CMF_NUM_VOICES; i ++) {
+		if (voices[i].isKeyOn) {
+			opl2->setChannelRegister(0xB0, i, opl2->getChannelRegister(0xB0, i) & 0x1F);
+			voices[i].isKeyOn = false;
+		}
+		voices[i].instrument = CMF_NO_INSTRUMENT;
+	}
+	for (byte i = 0; i < NUM_DRUM_SOUNDS; i ++) {
+		drumInstruments[i] = CMF_NO_INSTRUMENT;
+	}
+
+	opl2->setDrums(false, false, false, false, false);
+	opl2->setPercussion(enable);
+}
+
+
+/**
+ * Release all notes and drums.
+ */
+void CMFPlayer::silence() {
+	for (byte i = 0; i < CMF_NUM_VOICES; i ++) {
+		opl2->setChannelRegister(0xB0, i, opl2->getChannelRegister(0xB0, i) & 0x1F);
+		voices[i].isKeyOn = false;
+	}
+	opl2->setDrums(false, false, false, false, false);
+}
+
+
+/**
+ * Read the block of song data that holds the given file offset into the buffer.
+ *
+ * @param offset - File offset that must be available in the buffer.
+ * @return True if the offset is within the song data.
+ */
+bool CMFPlayer::fillBuffer(unsigned long offset) {
+	bufferOffset = offset - (offset % CMF_BUFFER_SIZE);
+	int numRead = reader(bufferOffset, buffer, CMF_BUFFER_SIZE);
+	bufferLength = numRead > 0 ? numRead : 0;
+	return offset - bufferOffset < bufferLength;
+}
+
+
+/**
+ * Read the next byte of song data. When the end of the data is reached the song ends.
+ *
+ * @return The next byte of song data or 0 if there is no more data.
+ */
+byte CMFPlayer::readByte() {
+	if (position - bufferOffset >= bufferLength && !fillBuffer(position)) {
+		ended = true;
+		return 0x00;
+	}
+
+	return buffer[position ++ - bufferOffset];
+}
+
+
+/**
+ * Read a MIDI variable length quantity.
+ *
+ * @return The value that was read.
+ */
+unsigned long CMFPlayer::readVarLength() {
+	unsigned long value = 0;
+	byte data;
+	byte numBytes = 0;
+
+	do {
+		data = readByte();
+		value = (value << 7) + (data & 0x7F);
+	} while ((data & 0x80) && ++ numBytes < 4);
+
+	return value;
+}
+
+
+/**
+ * Delay the next event by the given number of ticks. The remainder of the tick duration is carried over to the next
+ * wait so rounding errors never accumulate.
+ *
+ * @param ticks - Number of MIDI ticks to wait.
+ */
+void CMFPlayer::wait(unsigned long ticks) {
+	while (ticks > 0) {
+		unsigned long chunk = ticks > 0xFFFF ? 0xFFFF : ticks;
+		unsigned long fraction = chunk * tickRemainder + tickFraction;
+		nextEventTime += chunk * tickDuration + fraction / ticksPerSecond;
+		tickFraction = fraction % ticksPerSecond;
+		ticks -= chunk;
+	}
+}
@@ -0,0 +1,99 @@
+#include "OPL2.h"
+
+#ifndef CMF_PLAYER_H_
+	#define CMF_PLAYER_H_
+
+	// Song data is read in blocks of this size. Instruments are kept in RAM in the 11 byte packed format of the
+	// instruments in instruments.h; songs with more instruments use the first instrument for the others.
+	#if defined(__AVR__)
+		#define CMF_BUFFER_SIZE      128
+		#define CMF_MAX_INSTRUMENTS   16
+	#else
+		#define CMF_BUFFER_SIZE      512
+		#define CMF_MAX_INSTRUMENTS  128
+	#endif
+
+	#define CMF_NUM_MIDI_CHANNELS 16
+	#define CMF_NUM_VOICES         9
+	#define CMF_DRUM_CHANNEL      11	// MIDI channels 11 - 15 play the drums in rhythm mode.
+
+	#define CMF_CONTROL_MARKER      0x66
+	#define CMF_CONTROL_RHYTHM_MODE 0x67
+	#define CMF_CONTROL_NOTES_OFF   0x7B
+
+
+	/**
+	 * Callback used to read song data. It must read length bytes at the given offset of the CMF file into buffer and
+	 * return the number of bytes that were read.
+	 */
+	typedef int (*CMFReader)(unsigned long offset, byte *buffer, unsigned int length);
+
+
+	/**
+	 * A melodic OPL2 channel that is allocated to the notes of the MIDI channels.
+	 */
+	typedef struct CMFVoice {
+		byte channel;				// MIDI channel playing on this voice.
+		byte note;					// MIDI note playing on this voice.
+		byte instrument;			// Instrument loaded into the voice or 0xFF if none.
+		bool isKeyOn;
+		unsigned int startTime;		// Note counter value when the note was started, used to steal the oldest voice.
+	} CMFVoice;
+
+
+	class CMFPlayer {
+		public:
+			CMFPlayer(OPL2* opl2Ref);
+			bool load(CMFReader songReader);
+			void restart();
+			void play();
+			unsigned long update();
+			bool songEnded();
+			void setLoop(bool enable);
+			byte getNumInstruments();
+
+		private:
+			void processEvent();
+			void processSystemEvent(byte status);
+			void noteOn(byte channel, byte note);
+			void noteOff(byte channel, byte note);
+			void controlChange(byte channel, byte control, byte value);
+			byte allocateVoice(byte channel);
+			void loadVoiceInstrument(byte voice, byte instrument);
+			void setDrumInstrument(byte drum, byte instrument);
+			void setRhythmMode(bool enable);
+			void silence();
+			bool fillBuffer(unsigned long offset);
+			byte readByte();
+			unsigned long readVarLength();
+			void wait(unsigned long ticks);
+
+			OPL2* opl2 = NULL;
+			CMFReader reader = NULL;
+
+			unsigned long musicOffset = 0;		// File offset of the MIDI events.
+			unsigned int ticksPerSecond = 0;
+			unsigned long tickDuration = 0;		// Duration of a tick in us.
+			unsigned int tickRemainder = 0;		// Fraction of a us of each tick in 1 / ticksPerSecond us.
+			byte numInstruments = 0;
+			byte instruments[CMF_MAX_INSTRUMENTS][11];
+			bool loop = false;
+			bool ended = true;
+
+			byte buffer[CMF_BUFFER_SIZE];
+			unsigned long bufferOffset = 0;		// File offset of the first byte in the buffer.
+			unsigned int bufferLength = 0;		// Number of valid bytes in the buffer.
+			unsigned long position = 0;			// File offset of the next byte to decode.
+
+			byte runningStatus = 0;
+			byte programs[CMF_NUM_MIDI_CHANNELS];
+			CMFVoice voices[CMF_NUM_VOICES];
+			byte drumInstruments[NUM_DRUM_SOUNDS];	// Instrument loaded for each drum or 0xFF if none.
+			bool isRhythmMode = false;
+			byte numMelodicVoices = CMF_NUM_VOICES;
+			unsigned int noteCounter = 0;
+
+			unsigned long nextEventTime = 0;	// Time in us at which the next event is due.
+			unsigned int tickFraction = 0;		// Fraction of a us carried over between events.
+	};
+#endif
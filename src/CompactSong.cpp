@@ -0,0 +1,255 @@
+/**
+ * Player for songs in the OPL Compact Song format. Songs are converted offline from VGM, DRO or IMF files with the
+ * oplconvert tool. All register writes are grouped into bursts for a single register bank and all waits are expressed
+ * in samples, so the player does not spend time on commands for other chips or on parsing while the song plays.
+ *
+ * Song data is read through a callback in fixed size blocks, which allows songs to be played from SD card, flash or any
+ * other storage.
+ */
+
+#include "CompactSong.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+#endif
+
+
+/**
+ * Create a CompactSong player for an OPL2. Register writes to any bank other than bank 0 are ignored.
+ *
+ * @param opl2Ref - Reference to the OPL2 instance used for playback.
+ */
+CompactSong::CompactSong(OPL2* opl2Ref) {
+	opl2 = opl2Ref;
+}
+
+
+/**
+ * Create a CompactSong player for an OPL3 or OPL3Duo.
+ *
+ * @param opl3Ref - Reference to the OPL3 or OPL3Duo instance used for playback.
+ */
+CompactSong::CompactSong(OPL3* opl3Ref) {
+	opl2 = opl3Ref;
+	opl3 = opl3Ref;
+}
+
+
+/**
+ * Load a song and prepare it for playback. The OPL instance must have been initialized by calling its begin function
+ * before loading a song.
+ *
+ * @param songReader - Callback that reads song data.
+ * @return True if the song data is valid.
+ */
+bool CompactSong::load(CompactSongReader songReader) {
+	reader = songReader;
+	ended = true;
+
+	if (!fillBuffer(0) || bufferLength < OCS_HEADER_SIZE) {
+		return false;
+	}
+
+	if (buffer[0] != 'O' || buffer[1] != 'C' || buffer[2] != 'S' || buffer[3] != OCS_VERSION) {
+		return false;
+	}
+
+	chipType   = buffer[4];
+	numWaits   = buffer[5];
+	loopOffset = buffer[8]  + ((unsigned long)buffer[9]  << 8) + ((unsigned long)buffer[10] << 16) + ((unsigned long)buffer[11] << 24);
+	songLength = buffer[12] + ((unsigned long)buffer[13] << 8) + ((unsigned long)buffer[14] << 16) + ((unsigned long)buffer[15] << 24);
+
+	// The wait table directly follows the header and always fits in the first block.
+	dataOffset = OCS_HEADER_SIZE + numWaits * 2;
+	if (numWaits > OCS_MAX_WAIT_TABLE || bufferLength < dataOffset) {
+		return false;
+	}
+	for (byte i = 0; i < numWaits; i ++) {
+		waitTable[i] = buffer[OCS_HEADER_SIZE + i * 2] + (buffer[OCS_HEADER_SIZE + i * 2 + 1] << 8);
+	}
+
+	// Songs for (dual) OPL2 need OPL3 mode to be disabled to be audible on an OPL3.
+	if (opl3 != NULL) {
+		maxBank = opl3->getNumChannels() > OPL3_NUM_2OP_CHANNELS ? 3 : 1;
+		opl3->setOPL3Enabled(chipType == OCS_CHIP_OPL3 || chipType == OCS_CHIP_DUAL_OPL3);
+	} else {
+		maxBank = 0;
+	}
+
+	restart();
+	return true;
+}
+
+
+/**
+ * Restart the song from the beginning.
+ */
+void CompactSong::restart() {
+	position = dataOffset;
+	nextEventTime = micros();
+	sampleRemainder = 0;
+	ended = false;
+}
+
+
+/**
+ * Play the loaded song until it ends. When looping is enabled this function does not return.
+ */
+void CompactSong::play() {
+	while (!ended) {
+		update();
+	}
+}
+
+
+/**
+ * Update the player to play the song in the background. All commands that are due are processed and the time until
+ * the next command is returned. If it is not yet time to process the next command this function exits immediately.
+ *
+ * @return The number of us until update should be called again.
+ */
+unsigned long CompactSong::update() {
+	while (!ended && (long)(micros() - nextEventTime) >= 0) {
+		byte command = readByte();
+
+		if (command < OCS_CMD_WAIT_SHORT) {
+			byte bank = (command >> 4) & 0x03;
+			byte numWrites = (command & 0x0F) + 1;
+			for (byte i = 0; i < numWrites; i ++) {
+				byte reg = readByte();
+				write(bank, reg, readByte());
+			}
+		} else if (command < OCS_CMD_WAIT) {
+			wait(command - OCS_CMD_WAIT_SHORT + 1);
+		} else if (command == OCS_CMD_WAIT) {
+			unsigned long samples = 0;
+			byte shift = 0;
+			byte data;
+			do {
+				data = readByte();
+				samples |= (unsigned long)(data & 0x7F) << shift;
+				shift += 7;
+			} while ((data & 0x80) && shift < 28);
+			wait(samples);
+		} else if (command >= OCS_CMD_WAIT_TABLE && command < OCS_CMD_WAIT_TABLE + numWaits) {
+			wait(waitTable[command - OCS_CMD_WAIT_TABLE]);
+		} else if (command == OCS_CMD_END) {
+			if (loop && loopOffset > 0 && !ended) {
+				position = loopOffset;
+			} else {
+				ended = true;
+			}
+		}
+	}
+
+	long remaining = (long)(nextEventTime - micros());
+	return ended || remaining < 0 ? 0 : remaining;
+}
+
+
+/**
+ * Has the song ended?
+ *
+ * @return True if all song data has been played.
+ */
+bool CompactSong::songEnded() {
+	return ended;
+}
+
+
+/**
+ * Enable or disable looping of the song. Looping only applies to songs that have a loop point.
+ *
+ * @param enable - Loop the song when its end is reached.
+ */
+void CompactSong::setLoop(bool enable) {
+	loop = enable;
+}
+
+
+/**
+ * Get the chip type the song was converted for.
+ *
+ * @return One of OCS_CHIP_OPL2, OCS_CHIP_DUAL_OPL2, OCS_CHIP_OPL3 or OCS_CHIP_DUAL_OPL3.
+ */
+byte CompactSong::getChipType() {
+	return chipType;
+}
+
+
+/**
+ * Get the length of the song.
+ *
+ * @return The song length in 44.1 kHz samples.
+ */
+unsigned long CompactSong::getSongLength() {
+	return songLength;
+}
+
+
+/**
+ * Read the block of song data that holds the given file offset into the buffer.
+ *
+ * @param offset - File offset that must be available in the buffer.
+ * @return True if the offset is within the song data.
+ */
+bool CompactSong::fillBuffer(unsigned long offset) {
+	bufferOffset = offset - (offset % COMPACT_SONG_BUFFER_SIZE);
+	int numRead = reader(bufferOffset, buffer, COMPACT_SONG_BUFFER_SIZE);
+	bufferLength = numRead > 0 ? numRead : 0;
+	return offset - bufferOffset < bufferLength;
+}
+
+
+/**
+ * Read the next byte of song data. When the end of the data is reached the song ends.
+ *
+ * @return The next byte of song data or OCS_CMD_END if there is no more data.
+ */
+byte CompactSong::readByte() {
+	if (position - bufferOffset >= bufferLength && !fillBuffer(position)) {
+		ended = true;
+		return OCS_CMD_END;
+	}
+
+	return buffer[position ++ - bufferOffset];
+}
+
+
+/**
+ * Delay the next command by the given number of samples. One sample lasts 10000 / 441 us; the remainder of the
+ * division is carried over to the next wait so rounding errors never accumulate.
+ *
+ * @param samples - Number of 44.1 kHz samples to wait.
+ */
+void CompactSong::wait(unsigned long samples) {
+	while (samples > 0) {
+		unsigned long chunk = samples > 0xFFFF ? 0xFFFF : samples;
+		unsigned long time = chunk * 10000UL + sampleRemainder;
+		nextEventTime += time / 441;
+		sampleRemainder = time % 441;
+		samples -= chunk;
+	}
+}
+
+
+/**
+ * Write a register of the OPL. Writes to banks that are not available on the OPL instance are ignored.
+ *
+ * @param bank - Register bank; bit 0 selects the OPL3 high bank, bit 1 selects the second chip.
+ * @param reg - The register to write to.
+ * @param value - The value to write to the register.
+ */
+void CompactSong::write(byte bank, byte reg, byte value) {
+	if (bank > maxBank) {
+		return;
+	}
+
+	if (opl3 != NULL) {
+		opl3->write(bank, reg, value);
+	} else {
+		opl2->write(reg, value);
+	}
+}
@@ -0,0 +1,64 @@
+#include "OPL3.h"
+#include "CompactSongFormat.h"
+
+#ifndef COMPACT_SONG_H_
+	#define COMPACT_SONG_H_
+
+	// Songs are read in blocks of this size at offsets that are a multiple of the block size, so each read stays within
+	// a single sector of the SD card.
+	#if defined(__AVR__)
+		#define COMPACT_SONG_BUFFER_SIZE 128
+	#else
+		#define COMPACT_SONG_BUFFER_SIZE 512
+	#endif
+
+
+	/**
+	 * Callback used to read song data. It must read length bytes at the given offset of the song file into buffer and
+	 * return the number of bytes that were read.
+	 */
+	typedef int (*CompactSongReader)(unsigned long offset, byte *buffer, unsigned int length);
+
+
+	class CompactSong {
+		public:
+			CompactSong(OPL2* opl2Ref);
+			CompactSong(OPL3* opl3Ref);
+			bool load(CompactSongReader songReader);
+			void restart();
+			void play();
+			unsigned long update();
+			bool songEnded();
+			void setLoop(bool enable);
+			byte getChipType();
+			unsigned long getSongLength();
+
+		private:
+			bool fillBuffer(unsigned long offset);
+			byte readByte();
+			void wait(unsigned long samples);
+			void write(byte bank, byte reg, byte value);
+
+			OPL2* opl2 = NULL;
+			OPL3* opl3 = NULL;
+			CompactSongReader reader = NULL;
+			byte maxBank = 0;				// Highest register bank supported by the OPL instance.
+
+			byte chipType = OCS_CHIP_OPL2;	// Chip the song was converted for.
+			byte numWaits = 0;				// Number of entries in the wait table.
+			unsigned int waitTable[OCS_MAX_WAIT_TABLE];	// Number of samples of the most common long waits.
+			unsigned long dataOffset = 0;	// File offset of the first command.
+			unsigned long loopOffset = 0;	// File offset of the loop point or 0 if the song does not loop.
+			unsigned long songLength = 0;	// Song length in samples.
+			bool loop = false;
+			bool ended = true;
+
+			byte buffer[COMPACT_SONG_BUFFER_SIZE];
+			unsigned long bufferOffset = 0;	// File offset of the first byte in the buffer.
+			unsigned int bufferLength = 0;	// Number of valid bytes in the buffer.
+			unsigned long position = 0;		// File offset of the next byte to decode.
+
+			unsigned long nextEventTime = 0;	// Time in us at which the next command is due.
+			unsigned int sampleRemainder = 0;	// Fraction of a us carried over between waits.
+	};
+#endif
@@ -0,0 +1,46 @@
+/**
+ * Definition of the OPL Compact Song (OCS) format. OCS files are created offline from VGM, DRO and IMF files by the
+ * oplconvert tool and are played back by the CompactSong class. All multi byte values are little endian.
+ *
+ * Header (16 bytes):
+ *   0 - 2   Magic "OCS"
+ *   3       Format version
+ *   4       Chip type, one of OCS_CHIP_*
+ *   5       Number of entries in the wait table, at most OCS_MAX_WAIT_TABLE
+ *   6 - 7   Reserved
+ *   8 - 11  Offset of the loop point in the file or 0 if the song does not loop
+ *   12 - 15 Song length in samples
+ *
+ * The header is followed by the wait table, which holds the number of samples of the most common long waits of the
+ * song as 16 bit values, and then by the song data. All times are in 44.1 kHz samples.
+ *   0x00 - 0x3F  Register burst: bits 5-4 are the bank (bit 0 selects the OPL3 high bank, bit 1 the second chip) and
+ *                bits 3-0 hold the number of register / value pairs that follow minus 1.
+ *   0x40 - 0x7F  Wait 1 - 64 samples.
+ *   0x80         Wait, followed by the number of samples as a varint of 7 bits per byte where bit 7 is set on all but
+ *                the last byte.
+ *   0x81 - 0x90  Wait the number of samples of wait table entry 0 - 15.
+ *   0xFF         End of song data.
+ */
+
+#ifndef COMPACT_SONG_FORMAT_H_
+	#define COMPACT_SONG_FORMAT_H_
+
+	#define OCS_VERSION       2
+	#define OCS_HEADER_SIZE   16
+	#define OCS_SAMPLE_RATE   44100
+
+	#define OCS_CHIP_OPL2      0
+	#define OCS_CHIP_DUAL_OPL2 1
+	#define OCS_CHIP_OPL3      2
+	#define OCS_CHIP_DUAL_OPL3 3
+
+	#define OCS_CMD_BURST      0x00
+	#define OCS_CMD_WAIT_SHORT 0x40
+	#define OCS_CMD_WAIT       0x80
+	#define OCS_CMD_WAIT_TABLE 0x81
+	#define OCS_CMD_END        0xFF
+
+	#define OCS_MAX_BURST      16
+	#define OCS_MAX_SHORT_WAIT 64
+	#define OCS_MAX_WAIT_TABLE 16
+#endif
@@ -0,0 +1,227 @@
+/**
+ * Portamento for OPL channels. A channel that glides to a new note moves its pitch in equal steps of cents, so the
+ * glide sounds even over its whole range, and it changes blocks when it crosses an octave. Glides are stepped at a fixed
+ * control rate. Every step only writes the A0 and B0 registers whose value changes, so most steps cost a single
+ * register write.
+ *
+ * The glide speed is set per channel in cents per second. A channel with a speed of 0 jumps straight to new notes, so
+ * portamento can be switched on and off per channel, for example by MIDI controllers 5 and 65.
+ */
+
+#include "Glide.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+#endif
+
+
+#define CENTS_PER_NOTE 100
+#define POSITION_PER_NOTE (CENTS_PER_NOTE * 256L)
+
+
+/**
+ * Create a glide engine for the channels of an OPL2, OPL3 or OPL3Duo.
+ *
+ * @param opl2Ref - Reference to the OPL instance of which channels glide.
+ * @param controlRate - Number of glide steps per second.
+ */
+Glide::Glide(OPL2* opl2Ref, unsigned int controlRate) {
+	opl2 = opl2Ref;
+	this->controlRate = controlRate > 0 ? controlRate : GLIDE_CONTROL_RATE;
+	tickDuration = 1000000 / this->controlRate;
+
+	for (byte i = 0; i < GLIDE_MAX_CHANNELS; i ++) {
+		channels[i].position = 0;
+		channels[i].target = 0;
+		channels[i].rate = 0;
+	}
+}
+
+
+/**
+ * Set the glide speed of a channel. Notes that are started while the channel is already gliding use the new speed.
+ *
+ * @param channel - The channel to set the glide speed of.
+ * @param centsPerSecond - Glide speed in cents per second or 0 to jump to new notes without gliding.
+ */
+void Glide::setRate(byte channel, unsigned int centsPerSecond) {
+	if (channel < GLIDE_MAX_CHANNELS) {
+		channels[channel].rate = centsPerSecond;
+	}
+}
+
+
+/**
+ * Get the glide speed of a channel.
+ *
+ * @param channel - The channel to get the glide speed of.
+ * @return The glide speed in cents per second.
+ */
+unsigned int Glide::getRate(byte channel) {
+	return channel < GLIDE_MAX_CHANNELS ? channels[channel].rate : 0;
+}
+
+
+/**
+ * Glide from the current pitch of a channel to the given note. The key on state of the channel is not changed, so for
+ * a legato glide the note keeps playing and to glide into a new note the sketch keys the channel on itself.
+ *
+ * @param channel - The channel to glide.
+ * @param octave - Octave of the note [0, 7].
+ * @param note - The note to glide to, one of NOTE_*.
+ */
+void Glide::glideToNote(byte channel, byte octave, byte note) {
+	glideToPitch(channel, octave, opl2->getNoteFNumber(note));
+}
+
+
+/**
+ * Glide from the current pitch of a channel to the given block and F-number. When the glide speed of the channel is 0
+ * or the channel has no pitch yet then the channel jumps to the new pitch immediately. Invalid channels are ignored.
+ *
+ * @param channel - The channel to glide.
+ * @param block - Frequency block to glide to.
+ * @param fNumber - Frequency F-number to glide to.
+ */
+void Glide::glideToPitch(byte channel, byte block, short fNumber) {
+	if (channel >= GLIDE_MAX_CHANNELS) {
+		return;
+	}
+
+	short currentFNumber = opl2->getFNumber(channel);
+	if (channels[channel].rate == 0 || currentFNumber == 0 || fNumber == 0) {
+		stop(channel);
+		opl2->setPitch(channel, block, fNumber);
+		return;
+	}
+
+	// Continue a glide that is still running from where it is, otherwise start at the pitch the channel is playing.
+	GlideChannel& glide = channels[channel];
+	if (glide.position == glide.target) {
+		glide.position = getPosition(opl2->getBlock(channel), currentFNumber);
+	}
+	glide.target = getPosition(block, fNumber);
+}
+
+
+/**
+ * Is the given channel gliding?
+ *
+ * @param channel - The channel to check.
+ * @return True if the channel has not reached the end of its glide yet.
+ */
+bool Glide::isGliding(byte channel) {
+	return channel < GLIDE_MAX_CHANNELS && channels[channel].position != channels[channel].target;
+}
+
+
+/**
+ * Stop the glide of a channel at the pitch it has reached.
+ *
+ * @param channel - The channel to stop.
+ */
+void Glide::stop(byte channel) {
+	if (channel < GLIDE_MAX_CHANNELS) {
+		channels[channel].target = channels[channel].position;
+	}
+}
+
+
+/**
+ * Move all gliding channels one step closer to their target when a glide step is due. Steps are scheduled at a fixed
+ * rate and when update is called too late the missed steps are skipped.
+ *
+ * @return The number of us until the next glide step.
+ */
+unsigned long Glide::update() {
+	long remaining = (long)(nextTick - micros());
+	if (remaining > 0) {
+		return remaining;
+	}
+
+	for (byte i = 0; i < GLIDE_MAX_CHANNELS; i ++) {
+		GlideChannel& glide = channels[i];
+		if (glide.position != glide.target) {
+			unsigned long step = glide.rate * 256UL / controlRate;
+			step = step > 0 ? step : 1;
+			if (glide.position < glide.target) {
+				glide.position = glide.target - glide.position > step ? glide.position + step : glide.target;
+			} else {
+				glide.position = glide.position - glide.target > step ? glide.position - step : glide.target;
+			}
+			writePosition(i, glide.position);
+		}
+	}
+
+	nextTick += tickDuration;
+	unsigned long now = micros();
+	remaining = (long)(nextTick - now);
+	if (remaining < -(long)tickDuration) {
+		nextTick = now + tickDuration;
+		remaining = tickDuration;
+	}
+	return remaining > 0 ? remaining : 0;
+}
+
+
+/**
+ * Get the pitch of the given block and F-number in 1/256 cents above C in block 0. F-numbers between notes are
+ * interpolated linearly, which is accurate to a fraction of a cent.
+ *
+ * @param block - Frequency block.
+ * @param fNumber - Frequency F-number.
+ * @return The pitch.
+ */
+unsigned long Glide::getPosition(byte block, short fNumber) {
+	short octaveFNumber = opl2->getNoteFNumber(NOTE_C);
+
+	// Move the F-number into the octave of the note table.
+	while (fNumber < octaveFNumber && block > 0) {
+		fNumber <<= 1;
+		block --;
+	}
+	while (fNumber >= octaveFNumber * 2) {
+		fNumber >>= 1;
+		block ++;
+	}
+	if (fNumber < octaveFNumber) {
+		return 0;
+	}
+
+	byte note = NOTE_B;
+	while (fNumber < opl2->getNoteFNumber(note)) {
+		note --;
+	}
+	short low = opl2->getNoteFNumber(note);
+	short high = note < NOTE_B ? opl2->getNoteFNumber(note + 1) : octaveFNumber * 2;
+
+	return (block * NUM_NOTES + note) * POSITION_PER_NOTE + (fNumber - low) * POSITION_PER_NOTE / (high - low);
+}
+
+
+/**
+ * Write the block and F-number of the given pitch to a channel.
+ *
+ * @param channel - The channel to write.
+ * @param position - Pitch in 1/256 cents above C in block 0.
+ */
+void Glide::writePosition(byte channel, unsigned long position) {
+	unsigned int notes = position / POSITION_PER_NOTE;
+	byte block = notes / NUM_NOTES;
+	byte note = notes % NUM_NOTES;
+	long fraction = position - notes * POSITION_PER_NOTE;
+
+	short octaveFNumber = opl2->getNoteFNumber(NOTE_C);
+	short low = opl2->getNoteFNumber(note);
+	short high = note < NOTE_B ? opl2->getNoteFNumber(note + 1) : octaveFNumber * 2;
+	short fNumber = low + (high - low) * fraction / POSITION_PER_NOTE;
+
+	// Above block 7 the F-number is raised instead.
+	while (block > 7) {
+		fNumber = fNumber < 0x200 ? fNumber << 1 : 0x3FF;
+		block --;
+	}
+	opl2->setPitch(channel, block, fNumber);
+}
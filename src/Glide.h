@@ -0,0 +1,50 @@
+#include "OPL2.h"
+
+#ifndef GLIDE_H_
+	#define GLIDE_H_
+
+	// Number of channels that can glide, channels above this number always jump to their new pitch.
+	#if defined(__AVR__)
+		#define GLIDE_MAX_CHANNELS  18
+	#else
+		#define GLIDE_MAX_CHANNELS  36
+	#endif
+
+	#define GLIDE_CONTROL_RATE     100		// Default number of glide steps per second.
+	#define GLIDE_CENTS_PER_OCTAVE 1200
+
+
+	/**
+	 * Pitch of a gliding channel. Pitches are kept in 1/256 cents above C in block 0, so the glide is linear in cents and
+	 * crosses blocks without any special handling.
+	 */
+	typedef struct GlideChannel {
+		unsigned long position;			// Current pitch.
+		unsigned long target;			// Pitch at the end of the glide.
+		unsigned int rate;				// Glide speed in cents per second or 0 to jump to new notes.
+	} GlideChannel;
+
+
+	class Glide {
+		public:
+			Glide(OPL2* opl2Ref, unsigned int controlRate = GLIDE_CONTROL_RATE);
+			void setRate(byte channel, unsigned int centsPerSecond);
+			unsigned int getRate(byte channel);
+			void glideToNote(byte channel, byte octave, byte note);
+			void glideToPitch(byte channel, byte block, short fNumber);
+			bool isGliding(byte channel);
+			void stop(byte channel);
+			unsigned long update();
+
+		private:
+			unsigned long getPosition(byte block, short fNumber);
+			void writePosition(byte channel, unsigned long position);
+
+			OPL2* opl2 = NULL;
+			unsigned int controlRate = GLIDE_CONTROL_RATE;
+			unsigned long tickDuration = 1000000 / GLIDE_CONTROL_RATE;	// Duration of a glide step in us.
+			unsigned long nextTick = 0;									// Time in us of the next glide step.
+
+			GlideChannel channels[GLIDE_MAX_CHANNELS];
+	};
+#endif
@@ -0,0 +1,361 @@
+/**
+ * Instrument banks that are read at runtime from SD card or any other storage through a callback. The common OPL bank
+ * formats are supported:
+ *
+ *   SBI  - Sound Blaster instrument, holds a single instrument.
+ *   IBK  - Sound Blaster instrument bank, holds 128 instruments.
+ *   BNK  - AdLib instrument bank. Instruments are numbered in the order of their data records.
+ *   TMB  - Apogee Sound System timbre bank. Instruments 0 - 127 are melodic, 128 - 255 are the percussion notes.
+ *   OP2  - DMX GENMIDI.OP2 bank. Instruments 0 - 127 are melodic, 128 - 174 are percussion notes 35 - 81. Only the first
+ *          voice of double voice instruments is used.
+ *   WOPL - OPL3 Bank Editor bank. Each bank holds 128 instruments and the melodic banks come before the percussion
+ *          banks. Pseudo 4-OP instruments only use their first voice.
+ *
+ * The location of each instrument in the bank follows from the bank header, so no index is kept in RAM. Instruments
+ * are converted into the packed instrument format of instruments.h, or midi_instruments_4op.h for 4-OP instruments, the
+ * first time they are requested and are kept in a small cache of recently used instruments. This allows large banks to
+ * be used on boards with little RAM.
+ */
+
+#include "InstrumentBank.h"
+#include <string.h>
+
+
+#define BANK_MAX_RECORD_SIZE 62		// Largest part of an instrument record that is read.
+
+
+/**
+ * Create an instrument bank. Call open to read the header of a bank before requesting instruments.
+ */
+InstrumentBank::InstrumentBank() {
+	for (byte i = 0; i < BANK_CACHE_SIZE; i ++) {
+		cache[i].index = BANK_NO_INSTRUMENT;
+	}
+}
+
+
+/**
+ * Open an instrument bank. The header of the bank is read to find its instruments and the cache is cleared. Timbre
+ * banks have no signature, so their format must be given.
+ *
+ * @param bankReader - Callback that reads the bank file.
+ * @param bankFormat - Format of the bank, or BANK_FORMAT_AUTO to detect it from the signature of the bank.
+ * @return True if the bank holds instruments.
+ */
+bool InstrumentBank::open(InstrumentBankReader bankReader, byte bankFormat) {
+	reader = bankReader;
+	format = BANK_FORMAT_AUTO;
+	numInstruments = 0;
+	for (byte i = 0; i < BANK_CACHE_SIZE; i ++) {
+		cache[i].index = BANK_NO_INSTRUMENT;
+	}
+
+	byte header[20];
+	int numRead = reader(0, header, 20);
+	if (numRead < 0) {
+		return false;
+	}
+
+	if (bankFormat == BANK_FORMAT_AUTO) {
+		if (numRead >= 4 && header[0] == 'S' && header[1] == 'B' && header[2] == 'I' && header[3] == 0x1A) {
+			bankFormat = BANK_FORMAT_SBI;
+		} else if (numRead >= 4 && header[0] == 'I' && header[1] == 'B' && header[2] == 'K' && header[3] == 0x1A) {
+			bankFormat = BANK_FORMAT_IBK;
+		} else if (numRead >= 8 && memcmp(header + 2, "ADLIB-", 6) == 0) {
+			bankFormat = BANK_FORMAT_BNK;
+		} else if (numRead >= 8 && memcmp(header, "#OPL_II#", 8) == 0) {
+			bankFormat = BANK_FORMAT_OP2;
+		} else if (numRead >= 11 && memcmp(header, "WOPL3-BANK", 11) == 0) {
+			bankFormat = BANK_FORMAT_WOPL;
+		} else {
+			return false;
+		}
+	}
+
+	switch (bankFormat) {
+		case BANK_FORMAT_SBI:
+			numInstruments = 1;
+			instrumentOffset = 0x24;
+			recordSize = 16;
+			break;
+
+		case BANK_FORMAT_IBK:
+			numInstruments = 128;
+			instrumentOffset = 0x04;
+			recordSize = 16;
+			break;
+
+		case BANK_FORMAT_BNK:
+			if (numRead < 20) {
+				return false;
+			}
+			numInstruments = header[0x0A] + (header[0x0B] << 8);
+			instrumentOffset = header[0x10] + ((unsigned long)header[0x11] << 8) +
+				((unsigned long)header[0x12] << 16) + ((unsigned long)header[0x13] << 24);
+			recordSize = 30;
+			break;
+
+		case BANK_FORMAT_TMB:
+			numInstruments = 256;
+			instrumentOffset = 0;
+			recordSize = 13;
+			break;
+
+		case BANK_FORMAT_OP2:
+			numInstruments = 175;
+			instrumentOffset = 8;
+			recordSize = 36;
+			break;
+
+		case BANK_FORMAT_WOPL: {
+			// The version is little endian while the number of banks are big endian. Version 2 adds the names of the
+			// banks and version 3 adds key on and key off delays to each instrument.
+			if (numRead < 19) {
+				return false;
+			}
+			unsigned int version = header[11] + (header[12] << 8);
+			unsigned int numBanks = (header[13] << 8) + header[14] + (header[15] << 8) + header[16];
+			numInstruments = numBanks * 128;
+			instrumentOffset = 19 + (version >= 2 ? (unsigned long)numBanks * 34 : 0);
+			recordSize = version >= 3 ? 66 : 62;
+			break;
+		}
+
+		default:
+			return false;
+	}
+
+	format = bankFormat;
+	return numInstruments > 0;
+}
+
+
+/**
+ * Get the format of the bank.
+ *
+ * @return The BANK_FORMAT of the bank or BANK_FORMAT_AUTO if no bank is open.
+ */
+byte InstrumentBank::getFormat() {
+	return format;
+}
+
+
+/**
+ * Get the number of instruments in the bank.
+ */
+unsigned int InstrumentBank::getNumInstruments() {
+	return numInstruments;
+}
+
+
+/**
+ * Get an instrument of the bank in packed format. Use loadInstrument to turn it into an Instrument, or
+ * loadInstrument4OP if it is a 4-OP instrument. The data remains valid until BANK_CACHE_SIZE other instruments have
+ * been requested.
+ *
+ * @param index - The instrument number.
+ * @return Pointer to BANK_INSTRUMENT_SIZE bytes of packed instrument data in RAM, or NULL if the instrument cannot be
+ *         read.
+ */
+const byte *InstrumentBank::getInstrument(unsigned int index) {
+	InstrumentBankEntry *entry = getEntry(index);
+	return entry != NULL ? entry->data : NULL;
+}
+
+
+/**
+ * Is the given instrument a 4-OP instrument? Only WOPL banks hold 4-OP instruments.
+ *
+ * @param index - The instrument number.
+ * @return True if the instrument uses four operators.
+ */
+bool InstrumentBank::isInstrument4OP(unsigned int index) {
+	InstrumentBankEntry *entry = getEntry(index);
+	return entry != NULL && entry->is4OP;
+}
+
+
+/**
+ * Find an instrument in the cache, or read it from the bank into the least recently used cache entry.
+ *
+ * @param index - The instrument number.
+ * @return The cache entry of the instrument or NULL if the instrument cannot be read.
+ */
+InstrumentBankEntry *InstrumentBank::getEntry(unsigned int index) {
+	if (index >= numInstruments) {
+		return NULL;
+	}
+
+	accessCounter ++;
+	byte oldest = 0;
+	for (byte i = 0; i < BANK_CACHE_SIZE; i ++) {
+		if (cache[i].index == index) {
+			cache[i].lastUsed = accessCounter;
+			return &cache[i];
+		}
+
+		if (cache[oldest].index != BANK_NO_INSTRUMENT &&
+			(cache[i].index == BANK_NO_INSTRUMENT ||
+			(unsigned int)(accessCounter - cache[i].lastUsed) > (unsigned int)(accessCounter - cache[oldest].lastUsed))) {
+			oldest = i;
+		}
+	}
+
+	InstrumentBankEntry &entry = cache[oldest];
+	if (!readInstrument(index, entry)) {
+		entry.index = BANK_NO_INSTRUMENT;
+		return NULL;
+	}
+
+	entry.index = index;
+	entry.lastUsed = accessCounter;
+	return &entry;
+}
+
+
+/**
+ * Read an instrument record from the bank and convert it into packed format.
+ *
+ * @param index - The instrument number.
+ * @param entry - Cache entry that receives the instrument.
+ * @return True if the instrument was read.
+ */
+bool InstrumentBank::readInstrument(unsigned int index, InstrumentBankEntry &entry) {
+	byte record[BANK_MAX_RECORD_SIZE];
+	byte size = recordSize < BANK_MAX_RECORD_SIZE ? recordSize : BANK_MAX_RECORD_SIZE;
+	if (reader(instrumentOffset + (unsigned long)index * recordSize, record, size) != size) {
+		return false;
+	}
+
+	for (byte i = 0; i < BANK_INSTRUMENT_SIZE; i ++) {
+		entry.data[i] = 0x00;
+	}
+	entry.is4OP = false;
+
+	switch (format) {
+		case BANK_FORMAT_SBI:
+		case BANK_FORMAT_IBK:
+			convertSBI(record, entry.data);
+			break;
+
+		case BANK_FORMAT_TMB:
+			convertSBI(record, entry.data);
+			entry.data[0] = record[11];
+			break;
+
+		case BANK_FORMAT_BNK:
+			convertBNK(record, entry.data);
+			break;
+
+		case BANK_FORMAT_OP2:
+			convertOP2(record, entry.data);
+			break;
+
+		case BANK_FORMAT_WOPL:
+			entry.is4OP = (record[39] & 0x03) == 0x01;
+			convertWOPL(record, entry.data, entry.is4OP);
+			break;
+	}
+
+	return true;
+}
+
+
+/**
+ * Convert the Sound Blaster instrument format, where the modulator and carrier registers are interleaved. Timbre banks
+ * use the same layout for their first 11 bytes.
+ *
+ * @param record - The instrument record.
+ * @param data - Receives the packed instrument.
+ */
+void InstrumentBank::convertSBI(const byte *record, byte *data) {
+	data[1]  = record[0];
+	data[2]  = record[2];
+	data[3]  = record[4];
+	data[4]  = record[6];
+	data[5]  = record[10] & 0x0F;
+	data[6]  = record[1];
+	data[7]  = record[3];
+	data[8]  = record[5];
+	data[9]  = record[7];
+	data[10] = (record[8] & 0x07) + ((record[9] & 0x07) << 4);
+}
+
+
+/**
+ * Convert the AdLib instrument format, which stores each register field of an operator in a separate byte in the order
+ * key scale level, multiplier, feedback, attack, sustain level, sustain, decay, release, output level, tremolo, vibrato,
+ * key scale rate and connection.
+ *
+ * @param record - The instrument record.
+ * @param data - Receives the packed instrument.
+ */
+void InstrumentBank::convertBNK(const byte *record, byte *data) {
+	for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+		const byte *params = record + 2 + op * 13;
+
+		data[op * 5 + 1] =
+			(params[9] ? 0x80 : 0x00) +
+			(params[10] ? 0x40 : 0x00) +
+			(params[5] ? 0x20 : 0x00) +
+			(params[11] ? 0x10 : 0x00) +
+			(params[1] & 0x0F);
+		data[op * 5 + 2] = ((params[0] & 0x03) << 6) + (params[8] & 0x3F);
+		data[op * 5 + 3] = ((params[3] & 0x0F) << 4) + (params[6] & 0x0F);
+		data[op * 5 + 4] = ((params[4] & 0x0F) << 4) + (params[7] & 0x0F);
+	}
+
+	data[5] = ((record[4] & 0x07) << 1) + (record[14] ? 0x00 : 0x01);
+	data[10] = (record[28] & 0x07) + ((record[29] & 0x07) << 4);
+}
+
+
+/**
+ * Convert the first voice of a GENMIDI instrument. The note offset of the voice becomes the transpose of the
+ * instrument.
+ *
+ * @param record - The instrument record.
+ * @param data - Receives the packed instrument.
+ */
+void InstrumentBank::convertOP2(const byte *record, byte *data) {
+	const byte *voice = record + 4;
+
+	data[0]  = voice[14];
+	data[1]  = voice[0];
+	data[2]  = voice[4] + voice[5];
+	data[3]  = voice[1];
+	data[4]  = voice[2];
+	data[5]  = voice[6] & 0x0F;
+	data[6]  = voice[7];
+	data[7]  = voice[11] + voice[12];
+	data[8]  = voice[8];
+	data[9]  = voice[9];
+	data[10] = (voice[3] & 0x07) + ((voice[10] & 0x07) << 4);
+}
+
+
+/**
+ * Convert a WOPL instrument. The operators are stored as carrier and modulator of the first voice followed by carrier
+ * and modulator of the second voice, each as its values of registers 0x20, 0x40, 0x60, 0x80 and 0xE0.
+ *
+ * @param record - The instrument record.
+ * @param data - Receives the packed instrument.
+ * @param is4OP - Also convert the second voice into operators 3 and 4.
+ */
+void InstrumentBank::convertWOPL(const byte *record, byte *data, bool is4OP) {
+	for (byte voice = 0; voice < (is4OP ? 2 : 1); voice ++) {
+		const byte *carrier = record + 42 + voice * 10;
+		const byte *modulator = carrier + 5;
+		byte *packed = data + voice * 10;
+
+		for (byte i = 0; i < 4; i ++) {
+			packed[i + 1] = modulator[i];
+			packed[i + 6] = carrier[i];
+		}
+		packed[5] = record[40 + voice] & 0x0F;
+		packed[10] = (modulator[4] & 0x07) + ((carrier[4] & 0x07) << 4);
+	}
+
+	// The note offset is a big endian word of which the low byte is used.
+	data[0] = record[33];
+}
@@ -0,0 +1,70 @@
+#include "OPL2.h"
+
+#ifndef INSTRUMENT_BANK_H_
+	#define INSTRUMENT_BANK_H_
+
+	// Number of instruments that are kept in RAM. Instruments are read from the bank when they are not in the cache and
+	// replace the instrument that was used least recently.
+	#if defined(__AVR__)
+		#define BANK_CACHE_SIZE   4
+	#else
+		#define BANK_CACHE_SIZE  32
+	#endif
+
+	#define BANK_FORMAT_AUTO     0		// Detect the format from the signature of the bank.
+	#define BANK_FORMAT_SBI      1		// Sound Blaster instrument, a single instrument.
+	#define BANK_FORMAT_IBK      2		// Sound Blaster instrument bank, 128 instruments.
+	#define BANK_FORMAT_BNK      3		// AdLib instrument bank.
+	#define BANK_FORMAT_TMB      4		// Apogee Sound System timbre bank, 128 melodic and 128 percussion instruments.
+	#define BANK_FORMAT_OP2      5		// DMX GENMIDI.OP2 bank, 128 melodic and 47 percussion instruments.
+	#define BANK_FORMAT_WOPL     6		// OPL3 Bank Editor bank, 128 instruments per melodic and percussion bank.
+
+	#define BANK_INSTRUMENT_SIZE 21		// Size of a packed 4-OP instrument, see midi_instruments_4op.h.
+	#define BANK_NO_INSTRUMENT   0xFFFF
+
+
+	/**
+	 * Callback used to read the bank. It must read length bytes at the given offset of the bank file into buffer and
+	 * return the number of bytes that were read.
+	 */
+	typedef int (*InstrumentBankReader)(unsigned long offset, byte *buffer, unsigned int length);
+
+
+	/**
+	 * An instrument in the cache of the bank.
+	 */
+	typedef struct InstrumentBankEntry {
+		unsigned int index;				// Instrument number or BANK_NO_INSTRUMENT if the entry is empty.
+		unsigned int lastUsed;			// Access counter value when the instrument was last used.
+		bool is4OP;
+		byte data[BANK_INSTRUMENT_SIZE];
+	} InstrumentBankEntry;
+
+
+	class InstrumentBank {
+		public:
+			InstrumentBank();
+			bool open(InstrumentBankReader bankReader, byte bankFormat = BANK_FORMAT_AUTO);
+			byte getFormat();
+			unsigned int getNumInstruments();
+			const byte *getInstrument(unsigned int index);
+			bool isInstrument4OP(unsigned int index);
+
+		private:
+			InstrumentBankEntry *getEntry(unsigned int index);
+			bool readInstrument(unsigned int index, InstrumentBankEntry &entry);
+			void convertSBI(const byte *record, byte *data);
+			void convertBNK(const byte *record, byte *data);
+			void convertOP2(const byte *record, byte *data);
+			void convertWOPL(const byte *record, byte *data, bool is4OP);
+
+			InstrumentBankReader reader = NULL;
+			byte format = BANK_FORMAT_AUTO;
+			unsigned int numInstruments = 0;
+			unsigned long instrumentOffset = 0;		// File offset of the first instrument.
+			byte recordSize = 0;					// Size of an instrument in the bank.
+
+			InstrumentBankEntry cache[BANK_CACHE_SIZE];
+			unsigned int accessCounter = 0;
+	};
+#endif
@@ -0,0 +1,742 @@
+/**
+ * Player for the MUS music format of id Software's Doom engine games. MUS is a compact variant of MIDI with 16 channels,
+ * of which channel 16 plays percussion, and a fixed rate of 140 ticks per second. Its instruments are found in the
+ * GENMIDI.OP2 bank of the game, which holds 128 melodic and 47 percussion instruments. Each GENMIDI instrument has one
+ * or two voices, where a double voice instrument plays a second, slightly detuned 2-OP voice with each note.
+ *
+ * The GENMIDI instruments are converted into register images once when the song is loaded, so a program change or note
+ * only selects a slot of the instrument table and never reads the bank again. The MUS events are streamed through a
+ * callback in fixed size blocks.
+ *
+ * On an OPL2 the second voice of a double voice instrument is played on a second channel when one is free. On an OPL3
+ * both voices are played on the two channels of a 4-OP channel pair. When both voices are FM voices without detune they
+ * are combined into a single FM-AM 4-OP channel that is keyed with one register write, otherwise the pair is used as
+ * two 2-OP channels.
+ */
+
+#include "MUSPlayer.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+#endif
+
+
+#define GENMIDI_HEADER_SIZE         8
+#define GENMIDI_INSTRUMENT_SIZE    36
+#define GENMIDI_VOICE_SIZE         16
+#define GENMIDI_FIRST_PERCUSSION  128	// GENMIDI instrument of the first percussion note.
+#define MUS_FIRST_PERCUSSION_NOTE  35
+#define MUS_LAST_PERCUSSION_NOTE   81
+
+
+/**
+ * Create a MUS player for an OPL2.
+ *
+ * @param opl2Ref - Reference to the OPL2 instance used for playback.
+ */
+MUSPlayer::MUSPlayer(OPL2* opl2Ref) {
+	opl2 = opl2Ref;
+	numVoices = OPL2_NUM_CHANNELS;
+
+	for (byte i = 0; i < MUS_MAX_VOICES; i ++) {
+		voicePairs[i] = MUS_NO_VOICE;
+	}
+}
+
+
+/**
+ * Create a MUS player for an OPL3 or OPL3Duo. The 18 channels of the first OPL3 are used, of which channels 1 - 6 and
+ * 10 - 15 form the 4-OP channel pairs that play double voice instruments.
+ *
+ * @param opl3Ref - Reference to the OPL3 or OPL3Duo instance used for playback.
+ */
+MUSPlayer::MUSPlayer(OPL3* opl3Ref) {
+	opl2 = opl3Ref;
+	opl3 = opl3Ref;
+	numVoices = MUS_MAX_VOICES;
+
+	for (byte i = 0; i < MUS_MAX_VOICES; i ++) {
+		voicePairs[i] = MUS_NO_VOICE;
+	}
+	for (byte i = 0; i < OPL3_NUM_4OP_CHANNELS; i ++) {
+		voicePairs[opl3->get4OPControlChannel(i, 0)] = i;
+		voicePairs[opl3->get4OPControlChannel(i, 1)] = i;
+	}
+}
+
+
+/**
+ * Load a song and prepare it for playback. The GENMIDI instruments that are used by the song are read from the bank
+ * and converted into register images. The OPL instance must have been initialized by calling its begin function
+ * before loading a song.
+ *
+ * @param songReader - Callback that reads the MUS file.
+ * @param bankReader - Callback that reads the GENMIDI.OP2 file.
+ * @return True if the song is a valid MUS file and the bank a valid GENMIDI bank.
+ */
+bool MUSPlayer::load(MUSReader songReader, MUSReader bankReader) {
+	reader = songReader;
+	ended = true;
+
+	if (!fillBuffer(0) || bufferLength < 0x10) {
+		return false;
+	}
+
+	if (buffer[0] != 'M' || buffer[1] != 'U' || buffer[2] != 'S' || buffer[3] != 0x1A) {
+		return false;
+	}
+
+	scoreOffset = buffer[0x06] + (buffer[0x07] << 8);
+	unsigned int numSongInstruments = buffer[0x0C] + (buffer[0x0D] << 8);
+
+	byte signature[GENMIDI_HEADER_SIZE];
+	const char genmidiSignature[] = "#OPL_II#";
+	if (bankReader(0, signature, GENMIDI_HEADER_SIZE) != GENMIDI_HEADER_SIZE) {
+		return false;
+	}
+	for (byte i = 0; i < GENMIDI_HEADER_SIZE; i ++) {
+		if (signature[i] != genmidiSignature[i]) {
+			return false;
+		}
+	}
+
+	for (byte i = 0; i < GENMIDI_NUM_INSTRUMENTS; i ++) {
+		instrumentSlots[i] = MUS_NO_INSTRUMENT;
+	}
+	numInstruments = 0;
+
+	if (MUS_MAX_INSTRUMENTS >= GENMIDI_NUM_INSTRUMENTS) {
+		for (byte i = 0; i < GENMIDI_NUM_INSTRUMENTS; i ++) {
+			if (!loadInstrument(i, bankReader)) {
+				return false;
+			}
+		}
+	} else {
+		// The header of the song lists the instruments it uses, where percussion notes are counted from 135.
+		position = 0x10;
+		ended = false;
+		for (unsigned int i = 0; i < numSongInstruments && numInstruments < MUS_MAX_INSTRUMENTS; i ++) {
+			unsigned int index = readByte();
+			index += readByte() << 8;
+			index = index >= 135 ? index - 135 + GENMIDI_FIRST_PERCUSSION : index;
+
+			if (index < GENMIDI_NUM_INSTRUMENTS && instrumentSlots[index] == MUS_NO_INSTRUMENT) {
+				if (!loadInstrument(index, bankReader)) {
+					return false;
+				}
+			}
+		}
+		if (ended) {
+			return false;
+		}
+	}
+
+	if (opl3 != NULL) {
+		opl3->setOPL3Enabled(true);
+	}
+	opl2->setWaveFormSelect(true);
+	restart();
+	return true;
+}
+
+
+/**
+ * Restart the song from the beginning.
+ */
+void MUSPlayer::restart() {
+	silence();
+	if (opl3 != NULL) {
+		opl3->setAll4OPChannelsEnabled(false);
+	}
+
+	for (byte i = 0; i < MUS_NUM_CHANNELS; i ++) {
+		programs[i] = 0;
+		volumes[i] = 100;
+		noteVolumes[i] = 127;
+		pans[i] = 64;
+		bends[i] = 0;
+	}
+	for (byte i = 0; i < numVoices; i ++) {
+		voices[i].instrument = MUS_NO_INSTRUMENT;
+		voices[i].is4OP = false;
+		voices[i].startTime = 0;
+	}
+
+	position = scoreOffset;
+	noteCounter = 0;
+	ended = false;
+
+	nextEventTime = micros();
+	tickFraction = 0;
+}
+
+
+/**
+ * Play the loaded song until it ends. When looping is enabled this function does not return.
+ */
+void MUSPlayer::play() {
+	while (!ended) {
+		update();
+	}
+}
+
+
+/**
+ * Update the player to play the song in the background. All MUS events that are due are processed and the time until
+ * the next event is returned. If it is not yet time to process the next event this function exits immediately.
+ *
+ * @return The number of us until update should be called again.
+ */
+unsigned long MUSPlayer::update() {
+	while (!ended && (long)(micros() - nextEventTime) >= 0) {
+		unsigned long delay = processEvent();
+		if (!ended) {
+			wait(delay);
+		}
+	}
+
+	long remaining = (long)(nextEventTime - micros());
+	return ended || remaining < 0 ? 0 : remaining;
+}
+
+
+/**
+ * Has the song ended?
+ *
+ * @return True if the end of the song has been reached and looping is disabled.
+ */
+bool MUSPlayer::songEnded() {
+	return ended;
+}
+
+
+/**
+ * Enable or disable looping of the song.
+ *
+ * @param enable - Restart the song when its end is reached.
+ */
+void MUSPlayer::setLoop(bool enable) {
+	loop = enable;
+}
+
+
+/**
+ * Get the number of GENMIDI instruments that were loaded for the song.
+ *
+ * @return The number of instruments, at most MUS_MAX_INSTRUMENTS.
+ */
+byte MUSPlayer::getNumInstruments() {
+	return numInstruments;
+}
+
+
+/**
+ * Process the next MUS event. Events that are the last of a group are followed by the delay until the next event.
+ *
+ * @return The number of ticks until the next event.
+ */
+unsigned long MUSPlayer::processEvent() {
+	byte event = readByte();
+	byte channel = event & 0x0F;
+	byte data;
+
+	switch ((event >> 4) & 0x07) {
+		case 0:
+			noteOff(channel, readByte() & 0x7F);
+			break;
+
+		case 1:
+			data = readByte();
+			if (data & 0x80) {
+				noteVolumes[channel] = readByte() & 0x7F;
+			}
+			noteOn(channel, data & 0x7F, noteVolumes[channel]);
+			break;
+
+		case 2:
+			bends[channel] = (readByte() >> 1) - 64;
+			for (byte i = 0; i < numVoices; i ++) {
+				if (voices[i].isKeyOn && voices[i].channel == channel) {
+					setVoiceFrequency(i);
+				}
+			}
+			break;
+
+		case 3:
+			data = readByte();
+			if (data == 10 || data == 11) {
+				for (byte i = 0; i < numVoices; i ++) {
+					if (voices[i].isKeyOn && voices[i].channel == channel) {
+						releaseVoice(i);
+					}
+				}
+			}
+			break;
+
+		case 4:
+			data = readByte();
+			controlChange(channel, data, readByte() & 0x7F);
+			break;
+
+		case 6:
+			if (loop) {
+				restart();
+			} else {
+				silence();
+				ended = true;
+			}
+			return 0;
+	}
+
+	return event & 0x80 ? readVarLength() : 0;
+}
+
+
+/**
+ * Start a note. Notes on the percussion channel select the GENMIDI percussion instrument of the note.
+ *
+ * @param channel - MUS channel of the note.
+ * @param note - MUS note number.
+ * @param volume - Volume of the note [0, 127].
+ */
+void MUSPlayer::noteOn(byte channel, byte note, byte volume) {
+	byte index = programs[channel];
+	if (channel == MUS_PERCUSSION_CHANNEL) {
+		if (note < MUS_FIRST_PERCUSSION_NOTE || note > MUS_LAST_PERCUSSION_NOTE) {
+			return;
+		}
+		index = GENMIDI_FIRST_PERCUSSION + note - MUS_FIRST_PERCUSSION_NOTE;
+	}
+
+	byte slot = instrumentSlots[index];
+	if (slot == MUS_NO_INSTRUMENT) {
+		return;
+	}
+
+	MUSInstrument &instrument = instruments[slot];
+	bool isDoubleVoice = instrument.flags & GENMIDI_FLAG_DOUBLE_VOICE;
+	byte primary = MUS_NO_VOICE;
+	byte secondary = MUS_NO_VOICE;
+	bool is4OP = false;
+
+	if (isDoubleVoice && opl3 != NULL) {
+		primary = findFreeVoice(true);
+		if (primary != MUS_NO_VOICE) {
+			secondary = getPartner(primary);
+			is4OP = instrument.fineTune == 128 &&
+				instrument.voices[0][0] == instrument.voices[1][0] &&
+				!((instrument.voices[0][5] | instrument.voices[1][5]) & 0x01);
+		}
+	}
+
+	if (primary == MUS_NO_VOICE) {
+		primary = findFreeVoice(false);
+		if (primary == MUS_NO_VOICE) {
+			primary = findOldestVoice();
+			releaseVoice(primary);
+		}
+	}
+
+	voices[primary].volume = volume;
+	startVoice(primary, channel, note, slot, 0, is4OP);
+
+	// The second voice is only played when there is a free channel for it.
+	if (isDoubleVoice) {
+		if (secondary == MUS_NO_VOICE) {
+			secondary = findFreeVoice(false);
+		}
+		if (secondary != MUS_NO_VOICE) {
+			voices[secondary].volume = volume;
+			startVoice(secondary, channel, note, slot, 1, is4OP);
+		}
+	}
+}
+
+
+/**
+ * Release a note.
+ *
+ * @param channel - MUS channel of the note.
+ * @param note - MUS note number.
+ */
+void MUSPlayer::noteOff(byte channel, byte note) {
+	for (byte i = 0; i < numVoices; i ++) {
+		if (voices[i].isKeyOn && voices[i].channel == channel && voices[i].note == note) {
+			releaseVoice(i);
+		}
+	}
+}
+
+
+/**
+ * Process a MUS controller. Controller 0 is the program change.
+ *
+ * @param channel - MUS channel of the controller.
+ * @param control - Controller number.
+ * @param value - New value of the controller.
+ */
+void MUSPlayer::controlChange(byte channel, byte control, byte value) {
+	switch (control) {
+		case 0:
+			programs[channel] = value;
+			break;
+
+		case 3:
+			volumes[channel] = value;
+			for (byte i = 0; i < numVoices; i ++) {
+				if (voices[i].isKeyOn && voices[i].channel == channel) {
+					setVoiceVolume(i);
+				}
+			}
+			break;
+
+		case 4:
+			pans[channel] = value;
+			if (opl3 != NULL) {
+				byte panning = getPanning(channel);
+				for (byte i = 0; i < numVoices; i ++) {
+					if (voices[i].isKeyOn && voices[i].channel == channel) {
+						opl3->setPanning(i, panning & 0x10, panning & 0x20);
+					}
+				}
+			}
+			break;
+	}
+}
+
+
+/**
+ * Find a free voice. Single voices prefer channels that are not part of a 4-OP channel pair, so pairs remain available
+ * for double voice instruments.
+ *
+ * @param isPair - Find the first channel of a 4-OP channel pair of which both channels are free.
+ * @return The free voice or MUS_NO_VOICE if there is none.
+ */
+byte MUSPlayer::findFreeVoice(bool isPair) {
+	byte freeVoice = MUS_NO_VOICE;
+
+	for (byte i = 0; i < numVoices; i ++) {
+		if (voices[i].isKeyOn) {
+			continue;
+		}
+
+		byte partner = getPartner(i);
+		if (isPair) {
+			if (partner != MUS_NO_VOICE && opl3->get4OPControlChannel(voicePairs[i], 0) == i && !voices[partner].isKeyOn) {
+				return i;
+			}
+		} else if (partner == MUS_NO_VOICE) {
+			return i;
+		} else if (freeVoice == MUS_NO_VOICE) {
+			freeVoice = i;
+		}
+	}
+
+	return freeVoice;
+}
+
+
+/**
+ * Find the voice that has been playing the longest.
+ *
+ * @return The oldest voice.
+ */
+byte MUSPlayer::findOldestVoice() {
+	byte oldestVoice = 0;
+
+	for (byte i = 1; i < numVoices; i ++) {
+		if ((unsigned int)(noteCounter - voices[i].startTime) > (unsigned int)(noteCounter - voices[oldestVoice].startTime)) {
+			oldestVoice = i;
+		}
+	}
+
+	return oldestVoice;
+}
+
+
+/**
+ * Get the other channel of the 4-OP channel pair of a voice.
+ *
+ * @param voice - The voice to get the partner of.
+ * @return The other channel of the pair or MUS_NO_VOICE if the voice is not part of a 4-OP channel pair.
+ */
+byte MUSPlayer::getPartner(byte voice) {
+	byte pair = voicePairs[voice];
+	if (pair == MUS_NO_VOICE) {
+		return MUS_NO_VOICE;
+	}
+
+	byte first = opl3->get4OPControlChannel(pair, 0);
+	return voice == first ? opl3->get4OPControlChannel(pair, 1) : first;
+}
+
+
+/**
+ * Play one voice of an instrument on an OPL channel. The registers of the instrument are only written when the channel
+ * does not already have the same voice loaded. In 4-OP mode only the first channel of the pair is keyed on.
+ *
+ * @param voice - OPL channel to play the note on.
+ * @param channel - MUS channel of the note.
+ * @param note - MUS note number.
+ * @param slot - Instrument slot to play.
+ * @param layer - Voice of the instrument [0, 1].
+ * @param is4OP - Play both voices of the instrument as a 4-OP channel.
+ */
+void MUSPlayer::startVoice(byte voice, byte channel, byte note, byte slot, byte layer, bool is4OP) {
+	MUSVoice &musVoice = voices[voice];
+	const byte *data = instruments[slot].voices[layer];
+
+	if (opl3 != NULL && voicePairs[voice] != MUS_NO_VOICE && opl3->is4OPChannelEnabled(voicePairs[voice]) != is4OP) {
+		opl3->set4OPChannelEnabled(voicePairs[voice], is4OP);
+	}
+
+	if (musVoice.instrument != slot || musVoice.layer != layer) {
+		for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+			opl2->setOperatorRegister(0x20, voice, op, data[op * 5 + 1]);
+			opl2->setOperatorRegister(0x60, voice, op, data[op * 5 + 3]);
+			opl2->setOperatorRegister(0x80, voice, op, data[op * 5 + 4]);
+		}
+		opl2->setOperatorRegister(0xE0, voice, OPERATOR1, data[10] & 0x07);
+		opl2->setOperatorRegister(0xE0, voice, OPERATOR2, (data[10] >> 4) & 0x07);
+		musVoice.instrument = slot;
+		musVoice.layer = layer;
+	}
+
+	// The second channel of an FM-AM 4-OP channel sets the connection of the second pair of operators to AM.
+	byte connection = data[5] & 0x0F;
+	if (is4OP) {
+		connection = (connection & 0x0E) + layer;
+	}
+	if (opl3 != NULL) {
+		connection += getPanning(channel);
+	}
+	if (opl2->getChannelRegister(0xC0, voice) != connection) {
+		opl2->setChannelRegister(0xC0, voice, connection);
+	}
+
+	musVoice.channel = channel;
+	musVoice.note = note;
+	musVoice.is4OP = is4OP;
+	musVoice.isKeyOn = true;
+	musVoice.startTime = noteCounter ++;
+
+	setVoiceVolume(voice);
+	if (!is4OP || layer == 0) {
+		setVoiceFrequency(voice);
+	}
+}
+
+
+/**
+ * Release the note of a voice. Releasing either channel of a 4-OP channel pair releases both.
+ *
+ * @param voice - The voice to release.
+ */
+void MUSPlayer::releaseVoice(byte voice) {
+	if (voices[voice].is4OP) {
+		byte partner = getPartner(voice);
+		voices[partner].isKeyOn = false;
+		voice = opl3->get4OPControlChannel(voicePairs[voice], 0);
+	}
+
+	opl2->setChannelRegister(0xB0, voice, opl2->getChannelRegister(0xB0, voice) & 0x1F);
+	voices[voice].isKeyOn = false;
+}
+
+
+/**
+ * Write the output level of a voice for the note and channel volume. Only the carrier is scaled, unless the voice is
+ * an additive 2-OP voice.
+ *
+ * @param voice - The voice to set the volume of.
+ */
+void MUSPlayer::setVoiceVolume(byte voice) {
+	MUSVoice &musVoice = voices[voice];
+	const byte *data = instruments[musVoice.instrument].voices[musVoice.layer];
+	unsigned int volume = ((unsigned int)musVoice.volume * volumes[musVoice.channel]) / 127;
+
+	byte outputLevel = 63 - ((63 - (data[7] & 0x3F)) * volume) / 127;
+	opl2->setOperatorRegister(0x40, voice, OPERATOR2, (data[7] & 0xC0) + outputLevel);
+
+	if ((data[5] & 0x01) && !musVoice.is4OP) {
+		outputLevel = 63 - ((63 - (data[2] & 0x3F)) * volume) / 127;
+		opl2->setOperatorRegister(0x40, voice, OPERATOR1, (data[2] & 0xC0) + outputLevel);
+	} else {
+		opl2->setOperatorRegister(0x40, voice, OPERATOR1, data[2]);
+	}
+}
+
+
+/**
+ * Write the frequency and key on state of a voice. The note is offset by the note offset of the instrument voice, and
+ * the second voice of a double voice instrument is detuned by the fine tune of the instrument. Pitch bends reach two
+ * semitones up or down in steps of 1/32 semitone.
+ *
+ * @param voice - The voice to write the frequency of.
+ */
+void MUSPlayer::setVoiceFrequency(byte voice) {
+	MUSVoice &musVoice = voices[voice];
+	const MUSInstrument &instrument = instruments[musVoice.instrument];
+
+	int note = instrument.flags & GENMIDI_FLAG_FIXED_PITCH ? instrument.fixedNote : musVoice.note;
+	int pitch = (note + (signed char)instrument.voices[musVoice.layer][0]) * 32 + bends[musVoice.channel];
+	if (musVoice.layer == 1 && !musVoice.is4OP) {
+		pitch += instrument.fineTune / 2 - 64;
+	}
+	pitch = pitch < 0 ? 0 : pitch > 127 * 32 ? 127 * 32 : pitch;
+
+	note = pitch / 32;
+	byte step = pitch % 32;
+	int fNumber = opl2->getNoteFNumber(note % 12);
+	int nextFNumber = note % 12 == 11 ? opl2->getNoteFNumber(0) * 2 : opl2->getNoteFNumber(note % 12 + 1);
+	fNumber += ((nextFNumber - fNumber) * step) / 32;
+
+	// Notes below octave 0 of the OPL are played at half the frequency of octave 0.
+	byte block = note / 12;
+	if (block == 0) {
+		fNumber >>= 1;
+	} else {
+		block = block - 1 < NUM_OCTAVES ? block - 1 : NUM_OCTAVES;
+	}
+
+	byte keyOn = musVoice.isKeyOn ? 0x20 : 0x00;
+	opl2->setChannelRegister(0xA0, voice, fNumber & 0xFF);
+	opl2->setChannelRegister(0xB0, voice, keyOn + (block << 2) + ((fNumber >> 8) & 0x03));
+}
+
+
+/**
+ * Get the OPL3 output bits of a MUS channel for its pan controller.
+ *
+ * @param channel - MUS channel to get the panning of.
+ * @return The left (0x10) and right (0x20) output bits of register 0xC0.
+ */
+byte MUSPlayer::getPanning(byte channel) {
+	if (pans[channel] < 48) {
+		return 0x10;
+	} else if (pans[channel] > 80) {
+		return 0x20;
+	}
+	return 0x30;
+}
+
+
+/**
+ * Release all notes.
+ */
+void MUSPlayer::silence() {
+	for (byte i = 0; i < numVoices; i ++) {
+		opl2->setChannelRegister(0xB0, i, opl2->getChannelRegister(0xB0, i) & 0x1F);
+		voices[i].isKeyOn = false;
+	}
+}
+
+
+/**
+ * Read a GENMIDI instrument from the bank and convert its voices into the packed instrument format. GENMIDI stores
+ * the modulator and carrier registers of each voice in the order 0x20, 0x60, 0x80, 0xE0, key scale level and output
+ * level, with the feedback byte in between.
+ *
+ * @param index - GENMIDI instrument number.
+ * @param bankReader - Callback that reads the GENMIDI.OP2 file.
+ * @return True if the instrument was read.
+ */
+bool MUSPlayer::loadInstrument(byte index, MUSReader bankReader) {
+	byte data[GENMIDI_INSTRUMENT_SIZE];
+	unsigned long offset = GENMIDI_HEADER_SIZE + (unsigned long)index * GENMIDI_INSTRUMENT_SIZE;
+	if (bankReader(offset, data, GENMIDI_INSTRUMENT_SIZE) != GENMIDI_INSTRUMENT_SIZE) {
+		return false;
+	}
+
+	MUSInstrument &instrument = instruments[numInstruments];
+	instrument.flags = data[0];
+	instrument.fineTune = data[2];
+	instrument.fixedNote = data[3];
+
+	for (byte layer = 0; layer < 2; layer ++) {
+		const byte *voice = data + 4 + layer * GENMIDI_VOICE_SIZE;
+		byte *packed = instrument.voices[layer];
+
+		packed[0]  = voice[14];
+		packed[1]  = voice[0];
+		packed[2]  = voice[4] + voice[5];
+		packed[3]  = voice[1];
+		packed[4]  = voice[2];
+		packed[5]  = voice[6];
+		packed[6]  = voice[7];
+		packed[7]  = voice[11] + voice[12];
+		packed[8]  = voice[8];
+		packed[9]  = voice[9];
+		packed[10] = (voice[3] & 0x07) + ((voice[10] & 0x07) << 4);
+	}
+
+	instrumentSlots[index] = numInstruments ++;
+	return true;
+}
+
+
+/**
+ * Read the block of song data that holds the given file offset into the buffer.
+ *
+ * @param offset - File offset that must be available in the buffer.
+ * @return True if the offset is within the song data.
+ */
+bool MUSPlayer::fillBuffer(unsigned long offset) {
+	bufferOffset = offset - (offset % MUS_BUFFER_SIZE);
+	int numRead = reader(bufferOffset, buffer, MUS_BUFFER_SIZE);
+	bufferLength = numRead > 0 ? numRead : 0;
+	return offset - bufferOffset < bufferLength;
+}
+
+
+/**
+ * Read the next byte of song data. When the end of the data is reached the song ends.
+ *
+ * @return The next byte of song data or 0 if there is no more data.
+ */
+byte MUSPlayer::readByte() {
+	if (position - bufferOffset >= bufferLength && !fillBuffer(position)) {
+		ended = true;
+		return 0x00;
+	}
+
+	return buffer[position ++ - bufferOffset];
+}
+
+
+/**
+ * Read the variable length delay that follows the last event of a group.
+ *
+ * @return The delay in ticks.
+ */
+unsigned long MUSPlayer::readVarLength() {
+	unsigned long value = 0;
+	byte data;
+	byte numBytes = 0;
+
+	do {
+		data = readByte();
+		value = (value << 7) + (data & 0x7F);
+	} while ((data & 0x80) && ++ numBytes < 4);
+
+	return value;
+}
+
+
+/**
+ * Delay the next event by the given number of ticks. The remainder of the tick duration is carried over to the next
+ * wait so rounding errors never accumulate.
+ *
+ * @param ticks - Number of MUS ticks to wait.
+ */
+void MUSPlayer::wait(unsigned long ticks) {
+	while (ticks > 0) {
+		unsigned long chunk = ticks > 0xFFFF ? 0xFFFF : ticks;
+		unsigned long fraction = chunk * (1000000UL % MUS_TICKS_PER_SECOND) + tickFraction;
+		nextEventTime += chunk * (1000000UL / MUS_TICKS_PER_SECOND) + fraction / MUS_TICKS_PER_SECOND;
+		tickFraction = fraction % MUS_TICKS_PER_SECOND;
+		ticks -= chunk;
+	}
+}
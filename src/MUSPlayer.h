@@ -0,0 +1,124 @@
+#include "OPL3.h"
+
+#ifndef MUS_PLAYER_H_
+	#define MUS_PLAYER_H_
+
+	// Song and bank data is read in blocks of this size. The GENMIDI instruments used by a song are converted into
+	// register images when the song is loaded. When the whole bank fits it is converted completely.
+	#if defined(__AVR__)
+		#define MUS_BUFFER_SIZE      128
+		#define MUS_MAX_INSTRUMENTS   16
+	#else
+		#define MUS_BUFFER_SIZE      512
+		#define MUS_MAX_INSTRUMENTS  175
+	#endif
+
+	#define MUS_TICKS_PER_SECOND     140
+	#define MUS_NUM_CHANNELS          16
+	#define MUS_PERCUSSION_CHANNEL    15
+	#define MUS_MAX_VOICES            18
+	#define MUS_NO_VOICE            0xFF
+	#define MUS_NO_INSTRUMENT       0xFF
+
+	#define GENMIDI_NUM_INSTRUMENTS  175
+	#define GENMIDI_FLAG_FIXED_PITCH  0x01
+	#define GENMIDI_FLAG_DOUBLE_VOICE 0x04
+
+
+	/**
+	 * Callback used to read MUS or GENMIDI.OP2 data. It must read length bytes at the given offset of the file into
+	 * buffer and return the number of bytes that were read.
+	 */
+	typedef int (*MUSReader)(unsigned long offset, byte *buffer, unsigned int length);
+
+
+	/**
+	 * A GENMIDI instrument converted into two 2-OP instruments in the packed format of the instruments in
+	 * instruments.h. The transpose byte of each voice holds its note offset.
+	 */
+	typedef struct MUSInstrument {
+		byte flags;
+		byte fineTune;				// Detune of the second voice in 1/64 semitones, where 128 means no detune.
+		byte fixedNote;				// Note played by instruments with a fixed pitch.
+		byte voices[2][11];
+	} MUSInstrument;
+
+
+	/**
+	 * An OPL channel that is allocated to the notes of the MUS channels.
+	 */
+	typedef struct MUSVoice {
+		byte channel;				// MUS channel playing on this voice.
+		byte note;					// MUS note playing on this voice.
+		byte volume;				// Volume of the note.
+		byte instrument;			// Instrument slot loaded into the voice or MUS_NO_INSTRUMENT.
+		byte layer;					// Voice of the instrument that is loaded [0, 1].
+		bool is4OP;					// Voice plays both voices of the instrument as a 4-OP channel.
+		bool isKeyOn;
+		unsigned int startTime;		// Note counter value when the note was started, used to steal the oldest voice.
+	} MUSVoice;
+
+
+	class MUSPlayer {
+		public:
+			MUSPlayer(OPL2* opl2Ref);
+			MUSPlayer(OPL3* opl3Ref);
+			bool load(MUSReader songReader, MUSReader bankReader);
+			void restart();
+			void play();
+			unsigned long update();
+			bool songEnded();
+			void setLoop(bool enable);
+			byte getNumInstruments();
+
+		private:
+			unsigned long processEvent();
+			void noteOn(byte channel, byte note, byte volume);
+			void noteOff(byte channel, byte note);
+			void controlChange(byte channel, byte control, byte value);
+			byte findFreeVoice(bool isPair);
+			byte findOldestVoice();
+			byte getPartner(byte voice);
+			void startVoice(byte voice, byte channel, byte note, byte slot, byte layer, bool is4OP);
+			void releaseVoice(byte voice);
+			void setVoiceVolume(byte voice);
+			void setVoiceFrequency(byte voice);
+			byte getPanning(byte channel);
+			void silence();
+
+			bool loadInstrument(byte index, MUSReader bankReader);
+			bool fillBuffer(unsigned long offset);
+			byte readByte();
+			unsigned long readVarLength();
+			void wait(unsigned long ticks);
+
+			OPL2* opl2 = NULL;
+			OPL3* opl3 = NULL;
+			MUSReader reader = NULL;
+			byte numVoices = OPL2_NUM_CHANNELS;
+			byte voicePairs[MUS_MAX_VOICES];		// 4-OP channel of each voice or MUS_NO_VOICE.
+
+			unsigned long scoreOffset = 0;			// File offset of the MUS events.
+			byte instrumentSlots[GENMIDI_NUM_INSTRUMENTS];	// Slot of each GENMIDI instrument or MUS_NO_INSTRUMENT.
+			MUSInstrument instruments[MUS_MAX_INSTRUMENTS];
+			byte numInstruments = 0;
+			bool loop = false;
+			bool ended = true;
+
+			byte buffer[MUS_BUFFER_SIZE];
+			unsigned long bufferOffset = 0;		// File offset of the first byte in the buffer.
+			unsigned int bufferLength = 0;		// Number of valid bytes in the buffer.
+			unsigned long position = 0;			// File offset of the next byte to decode.
+
+			byte programs[MUS_NUM_CHANNELS];
+			byte volumes[MUS_NUM_CHANNELS];
+			byte noteVolumes[MUS_NUM_CHANNELS];	// Volume of the last note that was played on each channel.
+			byte pans[MUS_NUM_CHANNELS];
+			signed char bends[MUS_NUM_CHANNELS];	// Pitch bend in 1/32 semitones [-64, 63].
+			MUSVoice voices[MUS_MAX_VOICES];
+			unsigned int noteCounter = 0;
+
+			unsigned long nextEventTime = 0;	// Time in us at which the next event is due.
+			unsigned int tickFraction = 0;		// Fraction of a us carried over between events.
+	};
+#endif
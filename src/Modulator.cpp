@@ -0,0 +1,385 @@
+/**
+ * Software LFOs that modulate the pitch, output level and panning of OPL channels. The OPL only has a global vibrato
+ * and tremolo of two fixed depths, so the modulator adds LFOs of any rate and depth per channel. Each route connects an
+ * LFO to a target of a channel, where routes to the same target add up.
+ *
+ * All LFOs are updated at a fixed control rate from a sine table and integer phase accumulators, so the cost of
+ * modulation does not depend on how often update is called. Only registers whose value changes are written. The
+ * unmodulated values are read back from the shadow registers, so the sketch can keep playing notes and changing volume
+ * on a modulated channel as usual.
+ */
+
+#include "Modulator.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+#endif
+
+
+#define CENTS_PER_FREQUENCY_STEP 1731	// A change of one cent is a change of the F-number by 1 / 1731.
+
+
+/**
+ * Create a modulator for an OPL2.
+ *
+ * @param opl2Ref - Reference to the OPL2 instance of which channels are modulated.
+ * @param controlRate - Number of times per second the LFOs are updated.
+ */
+Modulator::Modulator(OPL2* opl2Ref, unsigned int controlRate) {
+	opl2 = opl2Ref;
+	this->controlRate = controlRate > 0 ? controlRate : MOD_CONTROL_RATE;
+	tickDuration = 1000000 / this->controlRate;
+
+	for (byte i = 0; i < MOD_MAX_CHANNELS; i ++) {
+		channels[i].channel = MOD_NO_CHANNEL;
+	}
+	for (byte i = 0; i < MOD_MAX_ROUTES; i ++) {
+		routes[i].slot = MOD_NO_CHANNEL;
+	}
+}
+
+
+/**
+ * Create a modulator for an OPL3 or OPL3Duo. Only on an OPL3 panning can be modulated.
+ *
+ * @param opl3Ref - Reference to the OPL3 or OPL3Duo instance of which channels are modulated.
+ * @param controlRate - Number of times per second the LFOs are updated.
+ */
+Modulator::Modulator(OPL3* opl3Ref, unsigned int controlRate) {
+	opl2 = opl3Ref;
+	opl3 = opl3Ref;
+	this->controlRate = controlRate > 0 ? controlRate : MOD_CONTROL_RATE;
+	tickDuration = 1000000 / this->controlRate;
+
+	for (byte i = 0; i < MOD_MAX_CHANNELS; i ++) {
+		channels[i].channel = MOD_NO_CHANNEL;
+	}
+	for (byte i = 0; i < MOD_MAX_ROUTES; i ++) {
+		routes[i].slot = MOD_NO_CHANNEL;
+	}
+}
+
+
+/**
+ * Route an LFO to a target of the given channel. For 4-OP channels pitch is modulated on the first channel of the pair
+ * and the level of the carrier on the second channel.
+ *
+ * @param channel - The 2-OP channel to modulate.
+ * @param target - What to modulate, one of MOD_TARGET_*.
+ * @param waveform - Waveform of the LFO, one of LFO_*.
+ * @param frequency - Frequency of the LFO in Hz, at most half the control rate.
+ * @param depth - Depth of the modulation in cents for pitch, in steps of 0.75 dB for levels and [0, 127] for panning.
+ * @return The route that was added or MOD_NO_ROUTE if there is no room for the route.
+ */
+byte Modulator::addRoute(byte channel, byte target, byte waveform, float frequency, int depth) {
+	if (target > MOD_TARGET_PANNING || (target == MOD_TARGET_PANNING && opl3 == NULL)) {
+		return MOD_NO_ROUTE;
+	}
+
+	byte route = MOD_NO_ROUTE;
+	for (byte i = 0; i < MOD_MAX_ROUTES && route == MOD_NO_ROUTE; i ++) {
+		if (routes[i].slot == MOD_NO_CHANNEL) {
+			route = i;
+		}
+	}
+
+	byte slot = getSlot(channel);
+	if (route == MOD_NO_ROUTE || slot == MOD_NO_CHANNEL) {
+		return MOD_NO_ROUTE;
+	}
+
+	routes[route].slot = slot;
+	routes[route].target = target;
+	routes[route].waveform = waveform;
+	routes[route].phase = 0;
+	routes[route].depth = depth;
+	setFrequency(route, frequency);
+	return route;
+}
+
+
+/**
+ * Change the depth of a route, for example when the modulation wheel moves.
+ *
+ * @param route - The route to change.
+ * @param depth - Depth of the modulation in units of the target of the route.
+ */
+void Modulator::setDepth(byte route, int depth) {
+	if (route < MOD_MAX_ROUTES) {
+		routes[route].depth = depth;
+	}
+}
+
+
+/**
+ * Change the frequency of the LFO of a route.
+ *
+ * @param route - The route to change.
+ * @param frequency - Frequency of the LFO in Hz, at most half the control rate.
+ */
+void Modulator::setFrequency(byte route, float frequency) {
+	if (route < MOD_MAX_ROUTES) {
+		float increment = frequency * 65536.0 / controlRate;
+		routes[route].increment = increment < 0.0 ? 0 : increment > 32768.0 ? 32768 : (unsigned int)increment;
+	}
+}
+
+
+/**
+ * Restart the LFOs of all routes of the given channel, so each new note starts its modulation at the same point.
+ *
+ * @param channel - The 2-OP channel of which to restart the LFOs.
+ */
+void Modulator::resetPhase(byte channel) {
+	for (byte i = 0; i < MOD_MAX_ROUTES; i ++) {
+		if (routes[i].slot != MOD_NO_CHANNEL && channels[routes[i].slot].channel == channel) {
+			routes[i].phase = 0;
+		}
+	}
+}
+
+
+/**
+ * Remove a route. When it was the last route of its channel the unmodulated values of the channel are restored.
+ *
+ * @param route - The route to remove.
+ */
+void Modulator::removeRoute(byte route) {
+	if (route >= MOD_MAX_ROUTES || routes[route].slot == MOD_NO_CHANNEL) {
+		return;
+	}
+
+	byte slot = routes[route].slot;
+	routes[route].slot = MOD_NO_CHANNEL;
+	for (byte i = 0; i < MOD_MAX_ROUTES; i ++) {
+		if (routes[i].slot == slot) {
+			return;
+		}
+	}
+
+	restoreChannel(channels[slot]);
+	channels[slot].channel = MOD_NO_CHANNEL;
+}
+
+
+/**
+ * Remove all routes of the given channel and restore its unmodulated values.
+ *
+ * @param channel - The 2-OP channel of which to remove the routes.
+ */
+void Modulator::removeRoutes(byte channel) {
+	for (byte i = 0; i < MOD_MAX_ROUTES; i ++) {
+		if (routes[i].slot != MOD_NO_CHANNEL && channels[routes[i].slot].channel == channel) {
+			removeRoute(i);
+		}
+	}
+}
+
+
+/**
+ * Update the LFOs and write the modulated registers when a control tick is due. Ticks are scheduled at a fixed rate.
+ * When update is called too late the missed ticks are skipped, so a single call never processes more than one tick.
+ *
+ * @return The number of us until the next control tick.
+ */
+unsigned long Modulator::update() {
+	long remaining = (long)(nextTick - micros());
+	if (remaining > 0) {
+		return remaining;
+	}
+
+	// Add up the LFOs that are routed to each target of each channel.
+	int offsets[MOD_MAX_CHANNELS][MOD_TARGET_PANNING + 1];
+	for (byte i = 0; i < MOD_MAX_CHANNELS; i ++) {
+		for (byte j = 0; j <= MOD_TARGET_PANNING; j ++) {
+			offsets[i][j] = 0;
+		}
+	}
+
+	for (byte i = 0; i < MOD_MAX_ROUTES; i ++) {
+		ModulationRoute& route = routes[i];
+		if (route.slot != MOD_NO_CHANNEL) {
+			long value = getLFOValue(route);
+			if (route.target == MOD_TARGET_LEVEL || route.target == MOD_TARGET_MODULATOR) {
+				offsets[route.slot][route.target] += (value + 127) * route.depth / 254;
+			} else {
+				offsets[route.slot][route.target] += value * route.depth / 127;
+			}
+			route.phase += route.increment;
+		}
+	}
+
+	for (byte i = 0; i < MOD_MAX_CHANNELS; i ++) {
+		if (channels[i].channel != MOD_NO_CHANNEL) {
+			modulateChannel(channels[i], offsets[i][MOD_TARGET_PITCH], offsets[i][MOD_TARGET_LEVEL],
+				offsets[i][MOD_TARGET_MODULATOR], offsets[i][MOD_TARGET_PANNING]);
+		}
+	}
+
+	nextTick += tickDuration;
+	unsigned long now = micros();
+	remaining = (long)(nextTick - now);
+	if (remaining < -(long)tickDuration) {
+		nextTick = now + tickDuration;
+		remaining = tickDuration;
+	}
+	return remaining > 0 ? remaining : 0;
+}
+
+
+/**
+ * Get the modulated channel slot of the given channel or take a free slot for it.
+ *
+ * @param channel - The 2-OP channel.
+ * @return Index of the slot or MOD_NO_CHANNEL if all slots are in use.
+ */
+byte Modulator::getSlot(byte channel) {
+	byte freeSlot = MOD_NO_CHANNEL;
+	for (byte i = 0; i < MOD_MAX_CHANNELS; i ++) {
+		if (channels[i].channel == channel) {
+			return i;
+		}
+		if (channels[i].channel == MOD_NO_CHANNEL && freeSlot == MOD_NO_CHANNEL) {
+			freeSlot = i;
+		}
+	}
+
+	if (freeSlot != MOD_NO_CHANNEL) {
+		ModulatedChannel& slot = channels[freeSlot];
+		slot.channel = channel;
+		slot.baseFrequency = slot.frequency = (opl2->getBlock(channel) << 10) + opl2->getFNumber(channel);
+		for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+			slot.baseLevels[op] = slot.levels[op] = opl2->getVolume(channel, op);
+		}
+		slot.basePanning = slot.panning = opl2->getChannelRegister(0xC0, channel) & 0x30;
+	}
+	return freeSlot;
+}
+
+
+/**
+ * Get the current value of the LFO of the given route.
+ *
+ * @param route - The route.
+ * @return Value of the LFO [-127, 127].
+ */
+int Modulator::getLFOValue(ModulationRoute& route) {
+	byte index = route.phase >> 8;
+
+	switch (route.waveform) {
+		case LFO_SINE: {
+			byte i = (index & 0x40) ? 63 - (index & 0x3F) : index & 0x3F;
+			#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+				int value = pgm_read_byte_near(lfoSineTable + i);
+			#else
+				int value = lfoSineTable[i];
+			#endif
+			return (index & 0x80) ? -value : value;
+		}
+
+		case LFO_TRIANGLE: {
+			index += 0x40;
+			return (index < 0x80 ? index : 0xFF - index) * 2 - 127;
+		}
+
+		case LFO_SQUARE:
+			return index < 0x80 ? 127 : -127;
+
+		case LFO_SAW_UP:
+			return index == 0 ? -127 : index - 128;
+
+		case LFO_SAW_DOWN:
+			return 127 - index;
+
+		default:
+			return 0;
+	}
+}
+
+
+/**
+ * Apply the modulation to a channel. When a register no longer holds the value that was last written by the modulator
+ * then the sketch has changed it and the new value is taken as the unmodulated value.
+ *
+ * @param channel - The channel to modulate.
+ * @param pitch - Detune in cents.
+ * @param level - Attenuation of the carrier(s).
+ * @param modulatorLevel - Attenuation of the modulator.
+ * @param panning - Panning [-127, 127] where values below -63 only play left and above 63 only play right.
+ */
+void Modulator::modulateChannel(ModulatedChannel& channel, int pitch, int level, int modulatorLevel, int panning) {
+	byte channelNum = channel.channel;
+
+	unsigned int frequency = (opl2->getBlock(channelNum) << 10) + opl2->getFNumber(channelNum);
+	if (frequency != channel.frequency) {
+		channel.baseFrequency = frequency;
+	}
+	long fNumber = channel.baseFrequency & 0x3FF;
+	fNumber += fNumber * pitch / CENTS_PER_FREQUENCY_STEP;
+	fNumber = fNumber < 0 ? 0 : fNumber > 0x3FF ? 0x3FF : fNumber;
+	channel.frequency = (channel.baseFrequency & 0x1C00) + fNumber;
+	if (channel.frequency != frequency) {
+		opl2->setPitch(channelNum, channel.frequency >> 10, channel.frequency & 0x3FF);
+	}
+
+	// Operator 1 is a carrier in AM mode and the modulator in FM mode.
+	int attenuation[2] = { opl2->getSynthMode(channelNum) ? level : modulatorLevel, level };
+	for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+		byte outputLevel = opl2->getVolume(channelNum, op);
+		if (outputLevel != channel.levels[op]) {
+			channel.baseLevels[op] = outputLevel;
+		}
+		int newLevel = channel.baseLevels[op] + attenuation[op];
+		channel.levels[op] = newLevel < 0 ? 0 : newLevel > 0x3F ? 0x3F : newLevel;
+		if (channel.levels[op] != outputLevel) {
+			opl2->setVolume(channelNum, op, channel.levels[op]);
+		}
+	}
+
+	if (opl3 != NULL) {
+		byte currentPanning = opl2->getChannelRegister(0xC0, channelNum) & 0x30;
+		if (currentPanning != channel.panning) {
+			channel.basePanning = currentPanning;
+		}
+		channel.panning = channel.basePanning;
+		if (panning < -63) {
+			channel.panning &= 0x10;
+		} else if (panning > 63) {
+			channel.panning &= 0x20;
+		}
+		if (channel.panning != currentPanning) {
+			opl3->setPanning(channelNum, channel.panning & 0x10, channel.panning & 0x20);
+		}
+	}
+}
+
+
+/**
+ * Write the unmodulated values of a channel back to the registers that still hold modulated values.
+ *
+ * @param channel - The channel to restore.
+ */
+void Modulator::restoreChannel(ModulatedChannel& channel) {
+	byte channelNum = channel.channel;
+
+	unsigned int frequency = (opl2->getBlock(channelNum) << 10) + opl2->getFNumber(channelNum);
+	if (frequency == channel.frequency && frequency != channel.baseFrequency) {
+		opl2->setPitch(channelNum, channel.baseFrequency >> 10, channel.baseFrequency & 0x3FF);
+	}
+
+	for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+		byte outputLevel = opl2->getVolume(channelNum, op);
+		if (outputLevel == channel.levels[op] && outputLevel != channel.baseLevels[op]) {
+			opl2->setVolume(channelNum, op, channel.baseLevels[op]);
+		}
+	}
+
+	if (opl3 != NULL) {
+		byte currentPanning = opl2->getChannelRegister(0xC0, channelNum) & 0x30;
+		if (currentPanning == channel.panning && currentPanning != channel.basePanning) {
+			opl3->setPanning(channelNum, channel.basePanning & 0x10, channel.basePanning & 0x20);
+		}
+	}
+}
@@ -0,0 +1,96 @@
+#include "OPL3.h"
+
+#ifndef MODULATOR_H_
+	#define MODULATOR_H_
+
+	// Number of modulation routes and of channels that can be modulated at the same time.
+	#if defined(__AVR__)
+		#define MOD_MAX_ROUTES    12
+		#define MOD_MAX_CHANNELS  12
+	#else
+		#define MOD_MAX_ROUTES    36
+		#define MOD_MAX_CHANNELS  36
+	#endif
+
+	#define MOD_CONTROL_RATE     100		// Default number of modulation updates per second.
+	#define MOD_NO_ROUTE        0xFF
+	#define MOD_NO_CHANNEL      0xFF
+
+	#define MOD_TARGET_PITCH       0		// Detune the channel by up to depth cents.
+	#define MOD_TARGET_LEVEL       1		// Attenuate the carrier(s) of the channel by up to depth steps of 0.75 dB.
+	#define MOD_TARGET_MODULATOR   2		// Attenuate the modulator of the channel by up to depth steps of 0.75 dB.
+	#define MOD_TARGET_PANNING     3		// Move the channel between the left and right speaker (OPL3 only).
+
+	#define LFO_SINE               0
+	#define LFO_TRIANGLE           1
+	#define LFO_SQUARE             2
+	#define LFO_SAW_UP             3
+	#define LFO_SAW_DOWN           4
+
+
+	/**
+	 * A channel that is modulated. The unmodulated values are taken from the shadow registers whenever they differ from
+	 * the value that was written by the modulator, so notes, volume and panning can be changed as usual while the
+	 * channel is being modulated.
+	 */
+	typedef struct ModulatedChannel {
+		byte channel;					// OPL channel or MOD_NO_CHANNEL when not in use.
+		unsigned int baseFrequency;		// Unmodulated block and F-number as (block << 10) + F-number.
+		unsigned int frequency;			// Block and F-number that were last written.
+		byte baseLevels[2];				// Unmodulated output level of each operator.
+		byte levels[2];					// Output level of each operator that was last written.
+		byte basePanning;				// Unmodulated panning bits of register C0.
+		byte panning;					// Panning bits that were last written.
+	} ModulatedChannel;
+
+
+	/**
+	 * Route of an LFO to a target of a channel. Routes to the same target of a channel are added up.
+	 */
+	typedef struct ModulationRoute {
+		byte slot;						// Modulated channel of the route.
+		byte target;					// One of MOD_TARGET_*.
+		byte waveform;					// One of LFO_*.
+		unsigned int phase;				// Phase of the LFO, a full cycle is 65536.
+		unsigned int increment;			// Phase increment per control tick.
+		int depth;						// Modulation depth in units of the target.
+	} ModulationRoute;
+
+
+	// First quarter of a sine wave in the range [0, 127].
+	const byte lfoSineTable[64] PROGMEM = {
+		  0,   3,   6,   9,  12,  16,  19,  22,  25,  28,  31,  34,  37,  40,  43,  46,
+		 49,  51,  54,  57,  60,  63,  65,  68,  71,  73,  76,  78,  81,  83,  85,  88,
+		 90,  92,  94,  96,  98, 100, 102, 104, 106, 107, 109, 111, 112, 113, 115, 116,
+		117, 118, 120, 121, 122, 122, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127
+	};
+
+
+	class Modulator {
+		public:
+			Modulator(OPL2* opl2Ref, unsigned int controlRate = MOD_CONTROL_RATE);
+			Modulator(OPL3* opl3Ref, unsigned int controlRate = MOD_CONTROL_RATE);
+			byte addRoute(byte channel, byte target, byte waveform, float frequency, int depth);
+			void setDepth(byte route, int depth);
+			void setFrequency(byte route, float frequency);
+			void resetPhase(byte channel);
+			void removeRoute(byte route);
+			void removeRoutes(byte channel);
+			unsigned long update();
+
+		private:
+			byte getSlot(byte channel);
+			int getLFOValue(ModulationRoute& route);
+			void modulateChannel(ModulatedChannel& channel, int pitch, int level, int modulatorLevel, int panning);
+			void restoreChannel(ModulatedChannel& channel);
+
+			OPL2* opl2 = NULL;
+			OPL3* opl3 = NULL;
+			unsigned int controlRate = MOD_CONTROL_RATE;
+			unsigned long tickDuration = 1000000 / MOD_CONTROL_RATE;	// Duration of a control tick in us.
+			unsigned long nextTick = 0;									// Time in us of the next control tick.
+
+			ModulatedChannel channels[MOD_MAX_CHANNELS];
+			ModulationRoute routes[MOD_MAX_ROUTES];
+	};
+#endif
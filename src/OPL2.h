@@ -124,6 +124,20 @@
 	};
 
 
+	/**
+	 * A table of instruments in PROGMEM where identical 2-OP voices are stored only once. These tables are generated
+	 * from the instrument headers by examples_pi/instrumenttables, see midi_instrument_tables.h.
+	 */
+	struct InstrumentTable {
+		const unsigned char *voices;		// Voices of 10 bytes: instrument data without the transpose.
+		const unsigned char *programs;		// Per program the transpose followed by the voice number of each 2-OP half.
+											// When NULL the voices are in program order and share the same transpose.
+		byte numPrograms;
+		byte voicesPerProgram;				// 1 for 2-OP instruments, 2 for 4-OP instruments.
+		byte transpose;						// Transpose of all programs when there is no program list.
+	};
+
+
 	class OPL2 {
 		public:
 			OPL2();
@@ -144,6 +158,7 @@
 			virtual byte getChannelRegisterOffset(byte baseRegister, byte channel);
 			virtual short getOperatorRegisterOffset(byte baseRegister, byte channel, byte operatorNum);
 			virtual void write(byte reg, byte data);
+			virtual void writeData(byte data);
 
 			virtual byte getNumChannels();
 
@@ -162,6 +177,7 @@
 			#else
 				Instrument loadInstrument(const unsigned char *instrument);
 			#endif
+			Instrument loadInstrument(const InstrumentTable &table, byte program);
 			Instrument getInstrument(byte channel);
 			void setInstrument(byte channel, Instrument instrument, float volume = 1.0);
 			void setDrumInstrument(Instrument instrument, byte drumType, float volume = 1.0);
@@ -206,6 +222,7 @@
 			void setRelease(byte channel, byte operatorNum, byte release);
 			void setFNumber(byte channel, short fNumber);
 			void setBlock(byte channel, byte block);
+			void setPitch(byte channel, byte block, short fNumber);
 			void setNoteSelect(bool enable);
 			void setKeyOn(byte channel, bool keyOn);
 			void setFeedback(byte channel, byte feedback);
@@ -220,6 +237,7 @@
 		protected:
 			template <typename T>
 			T clampValue(T value, T min, T max);
+			void readTableInstrument(const InstrumentTable &table, byte program, unsigned char *data, byte numVoices);
 
 			byte pinReset   = PIN_RESET;
 			byte pinAddress = PIN_ADDR;
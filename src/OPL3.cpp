@@ -232,6 +232,27 @@ void OPL3::write(byte bank, byte reg, byte value) {
 }
 
 
+/**
+ * Write a value to the register that was selected by the last call to write, without selecting the register and bank
+ * again. The OPL3 needs much less time after a data write than the OPL2, so this is a lot faster than OPL2::writeData.
+ * This does not update the internal shadow register!
+ *
+ * @param data - The value to write to the selected register.
+ */
+void OPL3::writeData(byte data) {
+	digitalWrite(pinAddress, HIGH);
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+		SPI.transfer(data);
+	#else
+		wiringPiSPIDataRW(SPI_CHANNEL, &data, 1);
+	#endif
+	digitalWrite(pinLatch, LOW);
+	delayMicroseconds(2);
+	digitalWrite(pinLatch, HIGH);
+	delayMicroseconds(2);
+}
+
+
 /**
  * Get the number of 2OP channels for this implementation.
  *
@@ -322,6 +343,30 @@ Instrument4OP OPL3::createInstrument4OP() {
 #endif
 
 
+/**
+ * Create a 4-OP instrument from a program of an instrument table. When the table holds 2-OP instruments the second sub
+ * instrument is left empty.
+ *
+ * @param table - The instrument table to load the instrument from.
+ * @param program - The program number of the instrument in the table.
+ * @return The 4-OP instrument or an empty instrument if the table has no such program.
+ */
+Instrument4OP OPL3::loadInstrument4OP(const InstrumentTable &table, byte program) {
+	if (program >= table.numPrograms) {
+		return createInstrument4OP();
+	}
+
+	unsigned char data[21];
+	readTableInstrument(table, program, data, 2);
+
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+		return loadInstrument4OP(data, INSTRUMENT_DATA_SRAM);
+	#else
+		return loadInstrument4OP(data);
+	#endif
+}
+
+
 /**
  * Create a new 4-operator instrument from the current settings of the four operators of the given 4-op channel.
  *
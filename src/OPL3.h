@@ -43,6 +43,7 @@
 			virtual void setOperatorRegister(byte baseRegister, byte channel, byte operatorNum, byte value);
 			virtual byte getChipRegisterOffset(short reg);
 			virtual void write(byte bank, byte reg, byte value);
+			virtual void writeData(byte data);
 
 			virtual byte getNumChannels();
 			virtual byte getNum4OPChannels();
@@ -54,6 +55,7 @@
 			#else
 				Instrument4OP loadInstrument4OP(const unsigned char *instrument);
 			#endif
+			Instrument4OP loadInstrument4OP(const InstrumentTable &table, byte program);
 			Instrument4OP getInstrument4OP(byte channel4OP);
 			void setInstrument4OP(byte channel4OP, Instrument4OP instrument, float volume = 1.0);
 
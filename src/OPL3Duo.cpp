@@ -148,7 +148,19 @@ byte OPL3Duo::getChipRegister(byte synthUnit, short reg) {
 
 
 /**
- * Write a given value to a chip wide register.
+ * Write a given value to a chip wide register of synth unit 0.
+ *
+ * @param reg - The 9-bit register to write to.
+ * @param value - The value to write to the register.
+ */
+void OPL3Duo::setChipRegister(short reg, byte value) {
+	setChipRegister(0, reg, value);
+}
+
+
+/**
+ * Write a given value to a chip wide register. When layering is enabled registers of synth unit 0 are also written to
+ * synth unit 1.
  *
  * @param synthUnit - The chip to address [0, 1]
  * @param reg - The 9-bit register to write to.
@@ -159,15 +171,22 @@ void OPL3Duo::setChipRegister(byte synthUnit, short reg, byte value) {
 	chipRegisters[(synthUnit * 5) + getChipRegisterOffset(reg)] = value;
 
 	byte bank = (synthUnit << 1) | ((reg >> 8) & 0x01);
-	write(bank, reg & 0xFF, value);
+	if (layering && synthUnit == 0) {
+		chipRegisters[5 + getChipRegisterOffset(reg)] = value;
+		writeLayered(bank, reg & 0xFF, value, value);
+	} else {
+		write(bank, reg & 0xFF, value);
+	}
 }
 
 
 /**
- * Write a given value to a channel based register.
+ * Write a given value to a channel based register. When layering is enabled the register of the layer on synth unit 1
+ * is written as well. The layer is detuned and a channel that plays on both speakers is split, so unit 0 plays on the
+ * left speaker and unit 1 on the right. The shadow registers of unit 0 keep the values as they were given.
  *
  * @param baseRegister - The base address of the register.
- * @param channel - The channel to address [0, 17]
+ * @param channel - The channel to address [0, 35]
  * @param value - The value to write to the register.
  */
 void OPL3Duo::setChannelRegister(byte baseRegister, byte channel, byte value) {
@@ -175,7 +194,40 @@ void OPL3Duo::setChannelRegister(byte baseRegister, byte channel, byte value) {
 
 	byte bank = (channel / CHANNELS_PER_BANK) & 0x03;
 	byte reg = baseRegister + (channel % CHANNELS_PER_BANK);
-	write(bank, reg, value);
+	if (!layering || channel >= OPL3_NUM_2OP_CHANNELS) {
+		write(bank, reg, value);
+		return;
+	}
+
+	// While layering only 18 channels are available, so shadow registers of the layer are addressed directly.
+	byte layerOffset = getChannelRegisterOffset(baseRegister, channel) + OPL3_NUM_2OP_CHANNELS * 3;
+	byte layerValue = value;
+	if (baseRegister == 0xC0 && (value & 0x30) == 0x30) {
+		value = value & 0xDF;
+		layerValue = layerValue & 0xEF;
+	} else if (baseRegister == 0xA0 || baseRegister == 0xB0) {
+		byte layerA0, layerB0;
+		getLayerFrequency(channel, layerA0, layerB0);
+		layerValue = baseRegister == 0xA0 ? layerA0 : layerB0;
+
+		// Detuning may carry into the other frequency register of the layer. Its F-number is set before the key on bit.
+		byte otherOffset = getChannelRegisterOffset(baseRegister ^ 0x10, channel) + OPL3_NUM_2OP_CHANNELS * 3;
+		byte otherValue = baseRegister == 0xA0 ? layerB0 : layerA0;
+		bool writeOther = channelRegisters[otherOffset] != otherValue;
+		channelRegisters[otherOffset] = otherValue;
+		if (writeOther && baseRegister == 0xB0) {
+			write(bank | 0x02, reg - 0x10, otherValue);
+		}
+		channelRegisters[layerOffset] = layerValue;
+		writeLayered(bank, reg, value, layerValue);
+		if (writeOther && baseRegister == 0xA0) {
+			write(bank | 0x02, reg + 0x10, otherValue);
+		}
+		return;
+	}
+
+	channelRegisters[layerOffset] = layerValue;
+	writeLayered(bank, reg, value, layerValue);
 }
 
 
@@ -183,7 +235,7 @@ void OPL3Duo::setChannelRegister(byte baseRegister, byte channel, byte value) {
  * Write a given value to an operator register for a channel.
  *
  * @param baseRegister - The base address of the register.
- * @param channel - The channel of the operator [0, 17]
+ * @param channel - The channel of the operator [0, 35]
  * @param op - The operator to change [0, 1].
  * @param value - The value to write to the operator's register.
  */
@@ -192,7 +244,12 @@ void OPL3Duo::setOperatorRegister(byte baseRegister, byte channel, byte operator
 
 	byte bank = (channel / CHANNELS_PER_BANK) & 0x03;
 	byte reg = baseRegister + getRegisterOffset(channel % CHANNELS_PER_BANK, operatorNum);
-	write(bank, reg, value);
+	if (layering && channel < OPL3_NUM_2OP_CHANNELS) {
+		operatorRegisters[getOperatorRegisterOffset(baseRegister, channel, operatorNum) + OPL3_NUM_2OP_CHANNELS * 10] = value;
+		writeLayered(bank, reg, value, value);
+	} else {
+		write(bank, reg, value);
+	}
 }
 
 
@@ -210,22 +267,69 @@ void OPL3Duo::write(byte bank, byte reg, byte value) {
 
 
 /**
- * Get the number of 2OP channels for this implementation.
+ * Write a register on both synth units at once. The register is selected on both units before the data is written, so
+ * each unit recovers from a write while the other unit is being written. This makes writing both units only a little
+ * slower than writing a single unit.
+ *
+ * @param bank - The bank (A1) of the register [0, 1].
+ * @param reg - The register to be changed.
+ * @param value - The value to write to the register of synth unit 0.
+ * @param layerValue - The value to write to the register of synth unit 1.
+ */
+void OPL3Duo::writeLayered(byte bank, byte reg, byte value, byte layerValue) {
+	byte data;
+
+	digitalWrite(pinAddress, LOW);
+	digitalWrite(pinBank, (bank & 0x01) ? HIGH : LOW);
+	for (byte unit = 0; unit < 2; unit ++) {
+		data = reg;
+		digitalWrite(pinUnit, unit == 1);
+		#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+			SPI.transfer(data);
+		#else
+			wiringPiSPIDataRW(SPI_CHANNEL, &data, 1);
+		#endif
+		digitalWrite(pinLatch, LOW);
+		delayMicroseconds(8);
+		digitalWrite(pinLatch, HIGH);
+	}
+
+	digitalWrite(pinAddress, HIGH);
+	for (byte unit = 0; unit < 2; unit ++) {
+		data = unit == 0 ? value : layerValue;
+		digitalWrite(pinUnit, unit == 1);
+		#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+			SPI.transfer(data);
+		#else
+			wiringPiSPIDataRW(SPI_CHANNEL, &data, 1);
+		#endif
+		digitalWrite(pinLatch, LOW);
+		delayMicroseconds(8);
+		digitalWrite(pinLatch, HIGH);
+	}
+	delayMicroseconds(8);
+}
+
+
+/**
+ * Get the number of 2OP channels for this implementation. When layering is enabled only the channels of synth unit 0
+ * can be used.
  *
  * @return The number of 2OP channels.
  */
 byte OPL3Duo::getNumChannels() {
-	return numChannels;
+	return layering ? OPL3_NUM_2OP_CHANNELS : numChannels;
 }
 
 
 /**
- * Get the number of 4OP channels for this implementation.
+ * Get the number of 4OP channels for this implementation. When layering is enabled only the channels of synth unit 0
+ * can be used.
  *
  * @return The number of 4OP channels.
  */
 byte OPL3Duo::getNum4OPChannels() {
-	return num4OPChannels;
+	return layering ? OPL3_NUM_4OP_CHANNELS : num4OPChannels;
 }
 
 
@@ -350,3 +454,95 @@ void OPL3Duo::setAll4OPChannelsEnabled(bool enable) {
 void OPL3Duo::setAll4OPChannelsEnabled(byte synthUnit, bool enable) {
 	setChipRegister(synthUnit, 0x0104, enable ? 0x3F : 0x00);
 }
+
+
+/**
+ * Enable or disable layering. When layering is enabled every channel of synth unit 0 plays a detuned copy of itself on
+ * the same channel of synth unit 1, so each voice sounds thicker. Voices that are panned to both speakers play on the
+ * left speaker from unit 0 and on the right speaker from unit 1, which gives a wide stereo chorus. The channels of
+ * synth unit 1 can not be used on their own while layering and only 18 channels are available.
+ *
+ * Every register write goes to both units at once, so layering costs very little extra time. Enabling layering copies
+ * all registers of unit 0 to unit 1. This can also be used to change the detune of the layers.
+ *
+ * @param enable - When set to true enables layering.
+ * @param detune - Detune of the layered voices in cents.
+ */
+void OPL3Duo::setLayering(bool enable, byte detune) {
+	layering = enable;
+	layerDetune = detune;
+
+	if (enable) {
+		const short layerChipRegisters[5] = { 0x105, 0x104, 0x01, 0x08, 0xBD };
+		for (byte i = 0; i < 5; i ++) {
+			setChipRegister(0, layerChipRegisters[i], getChipRegister(0, layerChipRegisters[i]));
+		}
+
+		const byte layerOperatorRegisters[5] = { 0x20, 0x40, 0x60, 0x80, 0xE0 };
+		for (byte i = 0; i < OPL3_NUM_2OP_CHANNELS; i ++) {
+			for (byte j = OPERATOR1; j <= OPERATOR2; j ++) {
+				for (byte k = 0; k < 5; k ++) {
+					setOperatorRegister(layerOperatorRegisters[k], i, j, getOperatorRegister(layerOperatorRegisters[k], i, j));
+				}
+			}
+			setChannelRegister(0xC0, i, getChannelRegister(0xC0, i));
+			setChannelRegister(0xA0, i, getChannelRegister(0xA0, i));
+			setChannelRegister(0xB0, i, getChannelRegister(0xB0, i));
+		}
+	} else {
+		// Silence the layers and restore the panning of the channels on unit 0.
+		for (byte i = 0; i < OPL3_NUM_2OP_CHANNELS; i ++) {
+			byte layerChannel = i + OPL3_NUM_2OP_CHANNELS;
+			setChannelRegister(0xB0, layerChannel, getChannelRegister(0xB0, layerChannel) & 0xDF);
+			setChannelRegister(0xC0, i, getChannelRegister(0xC0, i));
+		}
+	}
+}
+
+
+/**
+ * Is layering enabled?
+ *
+ * @return True if the channels of synth unit 0 are layered on synth unit 1.
+ */
+bool OPL3Duo::isLayering() {
+	return layering;
+}
+
+
+/**
+ * Get the detune of the layered voices.
+ *
+ * @return The detune in cents.
+ */
+byte OPL3Duo::getLayerDetune() {
+	return layerDetune;
+}
+
+
+/**
+ * Get the frequency registers of the layer of a channel. The F-number of the channel is raised by the layer detune.
+ * One cent is a change of the F-number by about 1 / 1731.
+ *
+ * @param channel - The channel on synth unit 0 [0, 17].
+ * @param valueA0 - Receives the value of the A0 register of the layer.
+ * @param valueB0 - Receives the value of the B0 register of the layer.
+ */
+void OPL3Duo::getLayerFrequency(byte channel, byte &valueA0, byte &valueB0) {
+	byte registerB0 = getChannelRegister(0xB0, channel);
+	byte block = (registerB0 >> 2) & 0x07;
+	short fNumber = ((registerB0 & 0x03) << 8) + getChannelRegister(0xA0, channel);
+
+	fNumber += (long)fNumber * layerDetune / 1731;
+	if (fNumber > 0x3FF) {
+		if (block < 7) {
+			fNumber >>= 1;
+			block ++;
+		} else {
+			fNumber = 0x3FF;
+		}
+	}
+
+	valueA0 = fNumber & 0xFF;
+	valueB0 = (registerB0 & 0xE0) + (block << 2) + (fNumber >> 8);
+}
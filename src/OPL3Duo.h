@@ -6,6 +6,7 @@
 	#define NUM_4OP_CHANNELS_PER_UNIT 6
 	#define OPL3DUO_NUM_2OP_CHANNELS 36
 	#define OPL3DUO_NUM_4OP_CHANNELS 12
+	#define OPL3DUO_LAYER_DETUNE 8		// Default detune of layered voices in cents.
 
 	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
 		#define PIN_UNIT 6
@@ -22,6 +23,7 @@
 			virtual void createShadowRegisters();
 
 			virtual byte getChipRegister(byte synthUnit, short reg);
+			virtual void setChipRegister(short reg, byte value);
 			virtual void setChipRegister(byte synthUnit, short reg, byte value);
 			virtual void setChannelRegister(byte baseRegister, byte channel, byte value);
 			virtual void setOperatorRegister(byte baseRegister, byte channel, byte op, byte value);
@@ -39,8 +41,17 @@
 			virtual void set4OPChannelEnabled(byte channel4OP, bool enable);
 			virtual void setAll4OPChannelsEnabled(bool enable);
 			void setAll4OPChannelsEnabled(byte synthUnit, bool enable);
+
+			void setLayering(bool enable, byte detune = OPL3DUO_LAYER_DETUNE);
+			bool isLayering();
+			byte getLayerDetune();
 		protected:
+			void writeLayered(byte bank, byte reg, byte value, byte layerValue);
+			void getLayerFrequency(byte channel, byte &valueA0, byte &valueB0);
+
 			byte pinUnit = PIN_UNIT;
+			bool layering = false;						// Channels of unit 0 are layered on unit 1.
+			byte layerDetune = OPL3DUO_LAYER_DETUNE;	// Detune of the layered voices in cents.
 
 			byte numChannels = OPL3DUO_NUM_2OP_CHANNELS;
 			byte num4OPChannels = OPL3DUO_NUM_4OP_CHANNELS;
@@ -0,0 +1,1193 @@
+/**
+ * Player for songs made with Reality Adlib Tracker. Both the original RAD v1 format and the RAD v2.1 format with 4-OP
+ * instruments and riffs are supported. Song data is played directly from memory or read through a callback from SD
+ * card or any other storage, so all the player needs to keep are the offsets of the instruments, patterns and riffs
+ * that are resolved once when the song is loaded. Pattern data is decoded one line at a time as the song plays.
+ *
+ * On AVR song offsets are 16 bit, so songs can be up to 64KB.
+ *
+ * On an OPL2 only the first two operators of each instrument are played. On an OPL3 each RAD channel uses a 4-OP channel
+ * pair, so 4-OP instruments are played as intended on channels 1 - 6. Channels 7 - 9 play 4-OP instruments on two
+ * separate 2-OP channels.
+ */
+
+#include "RADPlayer.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+#endif
+
+
+// F-number range of an octave used by pitch slides.
+#define RAD_FNUMBER_MIN 0x156
+#define RAD_FNUMBER_MAX 0x2AE
+
+#define RAD_TRACK           0xFF	// Channel given to playLineEntries when playing a line of a pattern.
+#define RAD_LAST_INSTRUMENT 0xFF	// Instrument of a v2 note that reuses the last instrument of the channel.
+
+
+// Carrier operators and connection bits of the two channels of each RAD algorithm.
+static const byte radCarriers[8]    = { 0x01, 0x03, 0x01, 0x09, 0x05, 0x0B, 0x0F, 0x00 };
+static const byte radConnectionA[8] = { 0, 0, 0, 1, 0, 1, 1, 0 };
+static const byte radConnectionB[8] = { 0, 1, 0, 0, 1, 1, 1, 0 };
+
+static const char radSignature[] = "RAD by REALiTY!!";
+
+
+/**
+ * Create a RAD player for an OPL2. Only the first two operators of each instrument are played.
+ *
+ * @param opl2Ref - Reference to the OPL2 instance used for playback.
+ */
+RADPlayer::RADPlayer(OPL2* opl2Ref) {
+	opl2 = opl2Ref;
+
+	for (byte i = 0; i < RAD_NUM_CHANNELS; i ++) {
+		channelA[i] = i;
+		channelB[i] = i;
+	}
+}
+
+
+/**
+ * Create a RAD player for an OPL3 or OPL3Duo. RAD channels 1 - 6 are played on 4-OP channel pairs 0 - 5.
+ *
+ * @param opl3Ref - Reference to the OPL3 or OPL3Duo instance used for playback.
+ */
+RADPlayer::RADPlayer(OPL3* opl3Ref) {
+	opl2 = opl3Ref;
+	opl3 = opl3Ref;
+
+	for (byte i = 0; i < RAD_NUM_CHANNELS; i ++) {
+		if (i < 6) {
+			channelA[i] = opl3->get4OPControlChannel(i, 0);
+			channelB[i] = opl3->get4OPControlChannel(i, 1);
+		} else {
+			channelA[i] = i;
+			channelB[i] = i + 9;
+		}
+	}
+}
+
+
+/**
+ * Release the offset tables of the loaded song.
+ */
+RADPlayer::~RADPlayer() {
+	freeSong();
+}
+
+
+/**
+ * Load a RAD song from memory and prepare it for playback. The offset tables of a song that was loaded before are
+ * released. The song data is not copied, so it must remain available while the song plays. The OPL instance must have
+ * been initialized by calling its begin function before loading a song.
+ *
+ * @param songData - Pointer to the contents of the RAD file.
+ * @param fromProgmem - On Arduino defines to read song data from PROGMEM (when true) or SRAM (default).
+ * @return True if the song data is a valid RAD v1 or v2.1 song.
+ */
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	bool RADPlayer::load(const unsigned char *songData, bool fromProgmem) {
+		isProgmem = fromProgmem;
+#else
+	bool RADPlayer::load(const unsigned char *songData) {
+#endif
+	song = songData;
+	reader = NULL;
+	return loadSong();
+}
+
+
+/**
+ * Load a RAD song that is read through a callback, for example from SD card, and prepare it for playback. Only the
+ * offsets of the instruments, patterns and riffs are kept in RAM and song data is read as it is played. The offset
+ * tables of a song that was loaded before are released. The OPL instance must have been initialized by calling its
+ * begin function before loading a song.
+ *
+ * @param songReader - Callback that reads song data.
+ * @return True if the song data is a valid RAD v1 or v2.1 song.
+ */
+bool RADPlayer::load(RADSongReader songReader) {
+	song = NULL;
+	reader = songReader;
+	bufferOffset = 0;
+	bufferLength = 0;
+	return loadSong();
+}
+
+
+/**
+ * Check the header of the song that was set by load and resolve the offsets of its instruments, patterns and riffs.
+ *
+ * @return True if the song data is a valid RAD v1 or v2.1 song.
+ */
+bool RADPlayer::loadSong() {
+	ended = true;
+	isReadError = false;
+	freeSong();
+
+	for (byte i = 0; i < 16; i ++) {
+		if (readByte(i) != radSignature[i]) {
+			return false;
+		}
+	}
+
+	version = readByte(0x10);
+	if (version != RAD_VERSION_1 && version != RAD_VERSION_2) {
+		return false;
+	}
+
+	byte flags = readByte(0x11);
+	initialSpeed = flags & 0x1F ? flags & 0x1F : 6;
+
+	// The song plays at 50Hz or 18.2Hz, v2 songs may also set a BPM where 125 BPM equals 50Hz.
+	unsigned int bpm = 125;
+	if (version == RAD_VERSION_2 && (flags & 0x20)) {
+		bpm = readByte(0x12) + (readByte(0x13) << 8);
+		bpm = bpm > 0 ? bpm : 125;
+	}
+	if (flags & 0x40) {
+		tickDuration = 54925;
+		tickRemainder = 0;
+	} else {
+		tickDuration = 2500000UL / bpm;
+		tickRemainder = 2500000UL % bpm;
+	}
+	tickDivisor = bpm;
+
+	// Count the instruments, patterns and riffs first, so the offset tables only take the memory they need.
+	if (!parseSong(false)) {
+		return false;
+	}
+	instruments = numInstruments ? new unsigned int[numInstruments] : NULL;
+	patterns = numPatterns ? new unsigned int[numPatterns] : NULL;
+	riffs = numRiffs ? new unsigned int[RAD_NUM_RIFFS * RAD_NUM_CHANNELS] : NULL;
+	for (byte i = 0; i < numInstruments; i ++) {
+		instruments[i] = RAD_NO_DATA;
+	}
+	for (byte i = 0; i < numPatterns; i ++) {
+		patterns[i] = RAD_NO_DATA;
+	}
+	for (byte i = 0; riffs != NULL && i < RAD_NUM_RIFFS * RAD_NUM_CHANNELS; i ++) {
+		riffs[i] = RAD_NO_DATA;
+	}
+	if (!parseSong(true)) {
+		freeSong();
+		return false;
+	}
+
+	if (opl3 != NULL) {
+		opl3->setOPL3Enabled(true);
+	}
+	opl2->setWaveFormSelect(true);
+	opl2->setPercussion(false);
+
+	restart();
+	return true;
+}
+
+
+/**
+ * Restart the song from the beginning.
+ */
+void RADPlayer::restart() {
+	for (byte i = 0; i < RAD_NUM_CHANNELS; i ++) {
+		RADChannel &channel = channels[i];
+		channel.instrument = 0;
+		channel.lastInstrument = 0;
+		channel.algorithm = 0;
+		channel.instrumentVolume = 64;
+		channel.volume = 64;
+		channel.detune = 0;
+		channel.riff = RAD_NO_DATA;
+		channel.riffSpeed = 0;
+		channel.isKeyOn = false;
+		channel.octave = 0;
+		channel.fNumber = 0;
+		channel.effect = RAD_EFFECT_NONE;
+		channel.param = 0;
+		channel.portamentoSpeed = 0;
+		channel.trackRiff.position = RAD_NO_DATA;
+		channel.instrumentRiff.position = RAD_NO_DATA;
+		for (byte op = 0; op < 4; op ++) {
+			channel.levels[op] = 0x00;
+		}
+
+		opl2->setChannelRegister(0xB0, channelB[i], 0x00);
+		if (opl3 != NULL) {
+			opl3->setChannelRegister(0xB0, channelA[i], 0x00);
+		}
+	}
+
+	if (opl3 != NULL) {
+		opl3->setAll4OPChannelsEnabled(false);
+	}
+
+	speed = initialSpeed;
+	speedCount = 0;
+	line = 0;
+	breakLine = RAD_NO_LINE;
+	order = 0xFF;
+	ended = false;
+	nextOrder();
+
+	tickFraction = 0;
+	nextTickTime = micros();
+	maxTickCpuTime = 0;
+}
+
+
+/**
+ * Play the loaded song until it ends. When looping is enabled this function does not return.
+ */
+void RADPlayer::play() {
+	while (!ended) {
+		update();
+	}
+}
+
+
+/**
+ * Update the player to play the song in the background. When a tick is due it is played and the time until the next
+ * tick is returned. If it is not yet time to play the next tick this function exits immediately. Ticks are scheduled
+ * relative to the previous tick, so the song tempo does not drift with the time spent in the sketch.
+ *
+ * @return The number of us until update should be called again.
+ */
+unsigned long RADPlayer::update() {
+	if (!ended && (long)(micros() - nextTickTime) >= 0) {
+		unsigned long startTime = micros();
+		tick();
+		tickCpuTime = micros() - startTime;
+		if (tickCpuTime > maxTickCpuTime) {
+			maxTickCpuTime = tickCpuTime;
+		}
+
+		nextTickTime += tickDuration;
+		tickFraction += tickRemainder;
+		if (tickFraction >= tickDivisor) {
+			nextTickTime ++;
+			tickFraction -= tickDivisor;
+		}
+	}
+
+	long remaining = (long)(nextTickTime - micros());
+	return ended || remaining < 0 ? 0 : remaining;
+}
+
+
+/**
+ * Has the song ended?
+ *
+ * @return True if the last order of the song has been played and looping is disabled.
+ */
+bool RADPlayer::songEnded() {
+	return ended;
+}
+
+
+/**
+ * Enable or disable looping of the song. When looping is enabled the song continues at the start of the song or at
+ * the order given by an order jump when its end is reached.
+ *
+ * @param enable - Loop the song when its end is reached.
+ */
+void RADPlayer::setLoop(bool enable) {
+	loop = enable;
+}
+
+
+/**
+ * Get the RAD version of the loaded song.
+ *
+ * @return RAD_VERSION_1 or RAD_VERSION_2.
+ */
+byte RADPlayer::getVersion() {
+	return version;
+}
+
+
+/**
+ * Get the duration of a single tick of the song.
+ *
+ * @return Tick duration in us.
+ */
+unsigned long RADPlayer::getTickDuration() {
+	return tickDuration;
+}
+
+
+/**
+ * Get the time spent playing the last tick. Together with the tick duration this shows how much of the CPU the player
+ * takes.
+ *
+ * @return The processing time of the last tick in us.
+ */
+unsigned long RADPlayer::getTickCpuTime() {
+	return tickCpuTime;
+}
+
+
+/**
+ * Get the longest time spent playing a single tick since the song was started.
+ *
+ * @return The maximum processing time of a tick in us.
+ */
+unsigned long RADPlayer::getMaxTickCpuTime() {
+	return maxTickCpuTime;
+}
+
+
+/**
+ * Walk through the song data to find the instruments, order list, patterns and riffs of the song.
+ *
+ * @param storeOffsets - When false only the number of instruments, patterns and riffs is counted. When true the
+ *                       offset tables are filled.
+ * @return True if the song data could be read.
+ */
+bool RADPlayer::parseSong(bool storeOffsets) {
+	byte flags = readByte(0x11);
+	unsigned int data = 0x12;
+	byte number;
+
+	if (version == RAD_VERSION_1) {
+		if (flags & 0x80) {
+			while (readByte(data ++) != 0x00 && !isReadError);
+		}
+
+		// Instruments are 11 bytes of register data.
+		while ((number = readByte(data ++)) != 0x00 && !isReadError) {
+			if (storeOffsets) {
+				instruments[number - 1] = data;
+			} else if (number > numInstruments) {
+				numInstruments = number;
+			}
+			data += 11;
+		}
+
+		numOrders = readByte(data ++);
+		orders = data;
+		data += numOrders;
+
+		// Patterns are given by a table of file offsets.
+		numPatterns = 32;
+		for (byte i = 0; storeOffsets && i < numPatterns; i ++) {
+			patterns[i] = readByte(data + i * 2) + (readByte(data + i * 2 + 1) << 8);
+		}
+	} else {
+		if (flags & 0x20) {
+			data += 2;
+		}
+		while (readByte(data ++) != 0x00 && !isReadError);
+
+		// Instruments have a name, settings, operator registers and an optional riff.
+		while ((number = readByte(data ++)) != 0x00 && !isReadError) {
+			data += readByte(data) + 1;
+			if (storeOffsets) {
+				instruments[number - 1] = data;
+			} else if (number > numInstruments) {
+				numInstruments = number;
+			}
+
+			byte algorithm = readByte(data);
+			data += (algorithm & 0x07) == 7 ? 7 : 24;
+			if (algorithm & 0x80) {
+				data += readByte(data) + (readByte(data + 1) << 8) + 2;
+			}
+		}
+
+		numOrders = readByte(data ++);
+		orders = data;
+		data += numOrders;
+
+		while ((number = readByte(data ++)) != 0xFF && !isReadError) {
+			if (storeOffsets) {
+				patterns[number] = data + 2;
+			} else if (number >= numPatterns) {
+				numPatterns = number + 1;
+			}
+			data += readByte(data) + (readByte(data + 1) << 8) + 2;
+		}
+
+		// Riffs are numbered 0 - 9 for each channel 1 - 9.
+		while ((number = readByte(data ++)) != 0xFF && !isReadError) {
+			byte riff = number >> 4;
+			byte channel = (number & 0x0F) - 1;
+			if (riff < RAD_NUM_RIFFS && channel < RAD_NUM_CHANNELS) {
+				if (storeOffsets) {
+					riffs[riff * RAD_NUM_CHANNELS + channel] = data + 2;
+				} else {
+					numRiffs ++;
+				}
+			}
+			data += readByte(data) + (readByte(data + 1) << 8) + 2;
+		}
+	}
+
+	return !isReadError;
+}
+
+
+/**
+ * Release the offset tables of the previously loaded song.
+ */
+void RADPlayer::freeSong() {
+	delete[] instruments;
+	delete[] patterns;
+	delete[] riffs;
+	instruments = NULL;
+	patterns = NULL;
+	riffs = NULL;
+	numInstruments = 0;
+	numPatterns = 0;
+	numRiffs = 0;
+	numOrders = 0;
+}
+
+
+/**
+ * Play a single tick of the song. Lines of the pattern and riffs are played when they are due, after which the
+ * continuous effects of all channels are updated.
+ */
+void RADPlayer::tick() {
+	// Instrument riffs run at their own speed.
+	for (byte i = 0; i < RAD_NUM_CHANNELS; i ++) {
+		RADRiff &riff = channels[i].instrumentRiff;
+		if (riff.position != RAD_NO_DATA && -- riff.speedCount == 0) {
+			riff.speedCount = riff.speed;
+			playRiffLine(i, riff);
+		}
+	}
+
+	if (speedCount == 0) {
+		playLine();
+	}
+
+	for (byte i = 0; i < RAD_NUM_CHANNELS; i ++) {
+		RADChannel &channel = channels[i];
+		switch (channel.effect) {
+			case RAD_EFFECT_PORTAMENTO_UP:
+				slide(i, channel.param, false);
+				break;
+
+			case RAD_EFFECT_PORTAMENTO_DOWN:
+				slide(i, -channel.param, false);
+				break;
+
+			case RAD_EFFECT_TONE_SLIDE:
+				toneSlide(i);
+				break;
+
+			case RAD_EFFECT_TONE_VOLUME_SLIDE:
+				toneSlide(i);
+				volumeSlide(i, channel.param);
+				break;
+
+			case RAD_EFFECT_VOLUME_SLIDE:
+				volumeSlide(i, channel.param);
+				break;
+		}
+	}
+
+	// Advance the song.
+	if (++ speedCount >= speed) {
+		speedCount = 0;
+		if (breakLine != RAD_NO_LINE) {
+			line = breakLine;
+			breakLine = RAD_NO_LINE;
+			nextOrder();
+		} else if (++ line >= RAD_NUM_LINES) {
+			line = 0;
+			nextOrder();
+		}
+	}
+}
+
+
+/**
+ * Play the current line of the pattern followed by the next line of any track riffs.
+ */
+void RADPlayer::playLine() {
+	for (byte i = 0; i < RAD_NUM_CHANNELS; i ++) {
+		channels[i].effect = RAD_EFFECT_NONE;
+	}
+
+	patternPosition = findLine(patternPosition, line);
+	if (patternPosition != RAD_NO_DATA && (readByte(patternPosition) & 0x3F) == line) {
+		patternPosition = playLineEntries(patternPosition, RAD_TRACK, 0);
+	}
+
+	for (byte i = 0; i < RAD_NUM_CHANNELS; i ++) {
+		if (channels[i].trackRiff.position != RAD_NO_DATA) {
+			playRiffLine(i, channels[i].trackRiff);
+		}
+	}
+}
+
+
+/**
+ * Move to the next order of the order list. The song ends when the end of the order list or an order jump is reached
+ * while looping is disabled.
+ */
+void RADPlayer::nextOrder() {
+	order ++;
+	if (order >= numOrders) {
+		if (!loop || numOrders == 0) {
+			ended = true;
+			return;
+		}
+		order = 0;
+	}
+
+	byte pattern = readByte(orders + order);
+	if (pattern & 0x80) {
+		if (!loop) {
+			ended = true;
+			return;
+		}
+		order = (pattern & 0x7F) < numOrders ? pattern & 0x7F : 0;
+		pattern = readByte(orders + order);
+	}
+
+	patternPosition = pattern < numPatterns ? patterns[pattern] : RAD_NO_DATA;
+}
+
+
+/**
+ * Skip all lines of pattern or riff data that come before the given line.
+ *
+ * @param data - Song offset of the next line of pattern or riff data.
+ * @param lineNum - Line number to find.
+ * @return Song offset of the given line or the first line after it. RAD_NO_DATA if there are no more lines.
+ */
+unsigned int RADPlayer::findLine(unsigned int data, byte lineNum) {
+	while (data != RAD_NO_DATA && (readByte(data) & 0x3F) < lineNum) {
+		bool isLastLine = readByte(data ++) & 0x80;
+
+		RADEntry entry;
+		do {
+			data = readEntry(data, entry);
+		} while (!entry.isLast);
+
+		data = isLastLine || isReadError ? RAD_NO_DATA : data;
+	}
+
+	return data;
+}
+
+
+/**
+ * Decode a single channel entry of a pattern or riff line.
+ *
+ * @param data - Song offset of the channel entry.
+ * @param entry - Decoded channel entry.
+ * @return Song offset of the data following the entry.
+ */
+unsigned int RADPlayer::readEntry(unsigned int data, RADEntry &entry) {
+	byte channelByte = readByte(data ++);
+	entry.channel = channelByte & 0x0F;
+	entry.isLast = (channelByte & 0x80) || isReadError;
+	entry.note = 0;
+	entry.octave = 0;
+	entry.instrument = 0;
+	entry.effect = RAD_EFFECT_NONE;
+	entry.param = 0;
+
+	if (version == RAD_VERSION_1) {
+		byte noteByte = readByte(data ++);
+		byte effectByte = readByte(data ++);
+		entry.note = noteByte & 0x0F;
+		entry.octave = (noteByte >> 4) & 0x07;
+		entry.instrument = ((noteByte & 0x80) >> 3) + (effectByte >> 4);
+		entry.effect = effectByte & 0x0F;
+		if (entry.effect != RAD_EFFECT_NONE) {
+			entry.param = readByte(data ++);
+		}
+	} else {
+		if (channelByte & 0x40) {
+			byte noteByte = readByte(data ++);
+			entry.note = noteByte & 0x0F;
+			entry.octave = (noteByte >> 4) & 0x07;
+			if (noteByte & 0x80) {
+				entry.instrument = RAD_LAST_INSTRUMENT;
+			}
+		}
+		if (channelByte & 0x20) {
+			entry.instrument = readByte(data ++);
+		}
+		if (channelByte & 0x10) {
+			entry.effect = readByte(data ++);
+			entry.param = readByte(data ++);
+		}
+	}
+
+	return data;
+}
+
+
+/**
+ * Play all channel entries of a line of pattern or riff data.
+ *
+ * @param data - Song offset of the line.
+ * @param channel - RAD channel that plays the entries of a riff or RAD_TRACK for a line of the pattern.
+ * @param transpose - Number of semitones to transpose the notes by.
+ * @return Song offset of the next line or RAD_NO_DATA if this was the last line.
+ */
+unsigned int RADPlayer::playLineEntries(unsigned int data, byte channel, signed char transpose) {
+	bool isLastLine = readByte(data ++) & 0x80;
+
+	RADEntry entry;
+	do {
+		data = readEntry(data, entry);
+		byte target = channel == RAD_TRACK ? entry.channel : channel;
+		if (target < RAD_NUM_CHANNELS) {
+			playEntry(target, entry, transpose, channel != RAD_TRACK);
+		}
+	} while (!entry.isLast);
+
+	return isLastLine || isReadError ? RAD_NO_DATA : data;
+}
+
+
+/**
+ * Play the note, instrument and effect of a channel entry.
+ *
+ * @param channelNum - RAD channel to play the entry on.
+ * @param entry - The channel entry.
+ * @param transpose - Number of semitones to transpose the note by.
+ * @param fromRiff - True if the entry is part of a riff.
+ */
+void RADPlayer::playEntry(byte channelNum, RADEntry &entry, signed char transpose, bool fromRiff) {
+	RADChannel &channel = channels[channelNum];
+
+	byte instrument = entry.instrument;
+	if (instrument == RAD_LAST_INSTRUMENT) {
+		instrument = channel.lastInstrument;
+	} else if (instrument != 0) {
+		channel.lastInstrument = instrument;
+	}
+
+	byte note = entry.note;
+	byte octave = entry.octave;
+	if (transpose != 0 && note >= 1 && note <= 12) {
+		int noteIndex = octave * 12 + note - 1 + transpose;
+		noteIndex = noteIndex < 0 ? 0 : noteIndex > 95 ? 95 : noteIndex;
+		octave = noteIndex / 12;
+		note = noteIndex % 12 + 1;
+	}
+
+	// Riffs are relative to C-3, so the note of a transposed riff sets the transposition.
+	signed char riffTranspose = 0;
+	if (note >= 1 && note <= 12) {
+		riffTranspose = (octave - 3) * 12 + note - 12;
+	}
+
+	// Track riffs play on this channel at the speed of the song.
+	if (!fromRiff && riffs != NULL && (entry.effect == RAD_EFFECT_RIFF || entry.effect == RAD_EFFECT_TRANSPOSE)) {
+		byte riff = entry.param / 10;
+		byte riffChannel = entry.param % 10;
+		if (riffChannel >= 1 && riffs[riff * RAD_NUM_CHANNELS + riffChannel - 1] != RAD_NO_DATA) {
+			unsigned int riffData = riffs[riff * RAD_NUM_CHANNELS + riffChannel - 1];
+			startRiff(channel.trackRiff, riffData, 0, entry.effect == RAD_EFFECT_TRANSPOSE ? riffTranspose : 0);
+			if (entry.effect == RAD_EFFECT_TRANSPOSE) {
+				return;
+			}
+		}
+	}
+
+	if (instrument != 0) {
+		loadInstrument(channelNum, instrument);
+	}
+
+	bool isToneSlide = entry.effect == RAD_EFFECT_TONE_SLIDE || entry.effect == RAD_EFFECT_TONE_VOLUME_SLIDE;
+	if (note == 0x0F) {
+		channel.isKeyOn = false;
+		setFrequency(channelNum);
+	} else if (note >= 1 && note <= 12) {
+		if (isToneSlide) {
+			channel.toneSlideOctave = octave;
+			channel.toneSlideFNumber = noteFNumbers[note - 1];
+		} else if (!fromRiff && channel.riff != RAD_NO_DATA && entry.effect != RAD_EFFECT_IGNORE) {
+			// Instruments with a riff play their riff instead of the note.
+			startRiff(channel.instrumentRiff, channel.riff, channel.riffSpeed ? channel.riffSpeed : speed, riffTranspose);
+			playRiffLine(channelNum, channel.instrumentRiff);
+		} else {
+			playNote(channelNum, note, octave);
+		}
+	}
+
+	switch (entry.effect) {
+		case RAD_EFFECT_PORTAMENTO_UP:
+		case RAD_EFFECT_PORTAMENTO_DOWN:
+		case RAD_EFFECT_TONE_VOLUME_SLIDE:
+		case RAD_EFFECT_VOLUME_SLIDE:
+			channel.effect = entry.effect;
+			channel.param = entry.param;
+			break;
+
+		case RAD_EFFECT_TONE_SLIDE:
+			channel.effect = entry.effect;
+			if (entry.param > 0) {
+				channel.portamentoSpeed = entry.param;
+			}
+			break;
+
+		case RAD_EFFECT_SET_VOLUME:
+			channel.volume = entry.param < 64 ? entry.param : 64;
+			setVolume(channelNum);
+			break;
+
+		case RAD_EFFECT_PATTERN_BREAK:
+			if (!fromRiff) {
+				breakLine = entry.param < RAD_NUM_LINES ? entry.param : 0;
+			}
+			break;
+
+		case RAD_EFFECT_SET_SPEED:
+			if (!fromRiff && entry.param > 0) {
+				speed = entry.param;
+			}
+			break;
+
+		case RAD_EFFECT_MULTIPLIER:
+			setMultiplier(channelNum, entry.param);
+			break;
+
+		case RAD_EFFECT_FEEDBACK:
+			setFeedback(channelNum, entry.param);
+			break;
+	}
+}
+
+
+/**
+ * Start playing a riff.
+ *
+ * @param riff - Riff playback position to start.
+ * @param data - Song offset of the riff data.
+ * @param speed - Number of ticks per line or 0 to play lines together with the lines of the pattern.
+ * @param transpose - Number of semitones to transpose the notes of the riff by.
+ */
+void RADPlayer::startRiff(RADRiff &riff, unsigned int data, byte speed, signed char transpose) {
+	riff.position = data;
+	riff.line = 0;
+	riff.speed = speed;
+	riff.speedCount = speed;
+	riff.transpose = transpose;
+}
+
+
+/**
+ * Play the next line of a riff. The riff stops after its last line.
+ *
+ * @param channel - RAD channel the riff is played on.
+ * @param riff - Playback position of the riff.
+ */
+void RADPlayer::playRiffLine(byte channel, RADRiff &riff) {
+	riff.position = findLine(riff.position, riff.line);
+	if (riff.position != RAD_NO_DATA && (readByte(riff.position) & 0x3F) == riff.line) {
+		riff.position = playLineEntries(riff.position, channel, riff.transpose);
+	}
+
+	if (++ riff.line >= RAD_NUM_LINES) {
+		riff.position = RAD_NO_DATA;
+	}
+}
+
+
+/**
+ * Set the instrument of a channel. MIDI instruments of v2 songs are not played, so they silence the channel.
+ *
+ * @param channelNum - RAD channel to set the instrument of.
+ * @param instrumentNum - Number of the instrument in the song.
+ */
+void RADPlayer::loadInstrument(byte channelNum, byte instrumentNum) {
+	RADInstrument instrument;
+	if (!readInstrument(instrumentNum, instrument)) {
+		return;
+	}
+
+	RADChannel &channel = channels[channelNum];
+	if (instrument.algorithm == 7) {
+		channel.isKeyOn = false;
+		setFrequency(channelNum);
+		channel.instrument = instrumentNum;
+		channel.algorithm = 7;
+		channel.riff = RAD_NO_DATA;
+		return;
+	}
+
+	// Channel A is not used by 2-OP instruments, so it only needs to be silenced when it was used by the previous one.
+	bool useChannelA = opl3 != NULL && (channel.algorithm >= 2 || instrument.algorithm >= 2);
+	if (useChannelA && instrument.algorithm < 2) {
+		opl3->setChannelRegister(0xB0, channelA[channelNum], opl3->getChannelRegister(0xB0, channelA[channelNum]) & 0x1F);
+	}
+
+	channel.instrument = instrumentNum;
+	channel.algorithm = instrument.algorithm;
+	channel.instrumentVolume = instrument.volume;
+	channel.volume = 64;
+	channel.detune = instrument.detune;
+	channel.riff = instrument.riff;
+	channel.riffSpeed = instrument.riffSpeed;
+
+	byte numOperators = useChannelA ? 4 : 2;
+	for (byte op = 0; op < numOperators; op ++) {
+		channel.levels[op] = instrument.operators[op][1];
+		writeOperator(channelNum, op, 0x20, instrument.operators[op][0]);
+		writeOperator(channelNum, op, 0x60, instrument.operators[op][2]);
+		writeOperator(channelNum, op, 0x80, instrument.operators[op][3]);
+		writeOperator(channelNum, op, 0xE0, instrument.operators[op][4]);
+	}
+
+	byte algorithm = instrument.algorithm;
+	if (opl3 != NULL) {
+		if (useChannelA && channelNum < 6) {
+			opl3->set4OPChannelEnabled(channelNum, algorithm >= 2 && algorithm <= 5);
+		}
+		opl3->setChannelRegister(0xC0, channelB[channelNum],
+			((instrument.panning[0] ^ 0x03) << 4) + (instrument.feedback[0] << 1) + radConnectionB[algorithm]);
+		if (useChannelA) {
+			opl3->setChannelRegister(0xC0, channelA[channelNum],
+				((instrument.panning[1] ^ 0x03) << 4) + (instrument.feedback[1] << 1) + radConnectionA[algorithm]);
+		}
+	} else {
+		opl2->setChannelRegister(0xC0, channelB[channelNum], (instrument.feedback[0] << 1) + radConnectionB[algorithm]);
+	}
+
+	setVolume(channelNum);
+}
+
+
+/**
+ * Read the settings of an instrument from the song data. Instruments of v1 songs are converted to 2-OP v2 instruments.
+ *
+ * @param instrumentNum - Number of the instrument in the song.
+ * @param instrument - The instrument settings.
+ * @return True if the instrument exists. Only the algorithm is set for MIDI instruments.
+ */
+bool RADPlayer::readInstrument(byte instrumentNum, RADInstrument &instrument) {
+	if (instrumentNum == 0 || instrumentNum > numInstruments || instruments[instrumentNum - 1] == RAD_NO_DATA) {
+		return false;
+	}
+	unsigned int data = instruments[instrumentNum - 1];
+
+	if (version == RAD_VERSION_1) {
+		// Registers are interleaved for carrier and modulator, followed by the connection and both wave forms.
+		byte connection = readByte(data + 8);
+		instrument.algorithm = connection & 0x01;
+		instrument.feedback[0] = (connection >> 1) & 0x07;
+		instrument.panning[0] = 0;
+		instrument.volume = 64;
+		instrument.detune = 0;
+		instrument.riffSpeed = 0;
+		instrument.riff = RAD_NO_DATA;
+		for (byte op = 0; op < 2; op ++) {
+			for (byte i = 0; i < 4; i ++) {
+				instrument.operators[op][i] = readByte(data + i * 2 + op);
+			}
+			instrument.operators[op][4] = readByte(data + 9 + op);
+		}
+	} else {
+		byte algorithm = readByte(data);
+		instrument.algorithm = algorithm & 0x07;
+		if (instrument.algorithm == 7) {
+			return true;
+		}
+
+		instrument.panning[0] = (algorithm >> 3) & 0x03;
+		instrument.panning[1] = (algorithm >> 5) & 0x03;
+		byte feedback = readByte(data + 1);
+		instrument.feedback[0] = feedback & 0x07;
+		instrument.feedback[1] = (feedback >> 4) & 0x07;
+		byte riffSettings = readByte(data + 2);
+		instrument.detune = riffSettings >> 4;
+		instrument.riffSpeed = riffSettings & 0x0F;
+		instrument.volume = readByte(data + 3) < 64 ? readByte(data + 3) : 64;
+		for (byte op = 0; op < 4; op ++) {
+			for (byte i = 0; i < 5; i ++) {
+				instrument.operators[op][i] = readByte(data + 4 + op * 5 + i);
+			}
+		}
+		instrument.riff = algorithm & 0x80 ? data + 26 : RAD_NO_DATA;
+	}
+
+	// Silence the operators that 2-OP instruments do not use.
+	if (instrument.algorithm < 2) {
+		instrument.feedback[1] = instrument.feedback[0];
+		instrument.panning[1] = instrument.panning[0];
+		for (byte op = 2; op < 4; op ++) {
+			for (byte i = 0; i < 5; i ++) {
+				instrument.operators[op][i] = i == 1 ? 0x3F : 0x00;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * Start a note on a channel.
+ *
+ * @param channelNum - RAD channel to play the note on.
+ * @param note - Note 1 - 12 (C# to C).
+ * @param octave - Octave of the note.
+ */
+void RADPlayer::playNote(byte channelNum, byte note, byte octave) {
+	RADChannel &channel = channels[channelNum];
+	if (channel.algorithm == 7) {
+		return;
+	}
+
+	channel.octave = octave;
+	channel.fNumber = noteFNumbers[note - 1];
+
+	// Retrigger the note if it is still playing.
+	if (channel.isKeyOn) {
+		channel.isKeyOn = false;
+		setFrequency(channelNum);
+	}
+	channel.isKeyOn = true;
+	setFrequency(channelNum);
+}
+
+
+/**
+ * Write the frequency and key on state of a channel. For 4-OP instruments only the first channel of the 4-OP pair is
+ * written and for 2-OP instruments only the second. When an instrument uses both channels as 2-OP channels they are
+ * detuned against each other by the detune setting of the instrument.
+ *
+ * @param channelNum - RAD channel to write the frequency of.
+ */
+void RADPlayer::setFrequency(byte channelNum) {
+	RADChannel &channel = channels[channelNum];
+	bool is4OP = opl3 != NULL && channelNum < 6 && channel.algorithm >= 2 && channel.algorithm <= 5;
+	byte keyOn = channel.isKeyOn ? 0x20 : 0x00;
+
+	if (opl3 != NULL && channel.algorithm >= 2) {
+		unsigned int fNumber = channel.fNumber + (is4OP ? 0 : (channel.detune + 1) >> 1);
+		writeFrequency(channelA[channelNum], fNumber & 0xFF, keyOn + (channel.octave << 2) + ((fNumber >> 8) & 0x03));
+	}
+
+	if (!is4OP) {
+		unsigned int fNumber = channel.fNumber - (opl3 != NULL ? channel.detune >> 1 : 0);
+		writeFrequency(channelB[channelNum], fNumber & 0xFF, keyOn + (channel.octave << 2) + ((fNumber >> 8) & 0x03));
+	}
+}
+
+
+/**
+ * Write registers A0 and B0 of an OPL channel. Each register is only written when its value changes, so the steps of a
+ * slide mostly cost a single register write.
+ *
+ * @param oplChannel - OPL channel to write.
+ * @param valueA0 - Low byte of the F-number.
+ * @param valueB0 - Key on, octave and high bits of the F-number.
+ */
+void RADPlayer::writeFrequency(byte oplChannel, byte valueA0, byte valueB0) {
+	if (opl2->getChannelRegister(0xA0, oplChannel) != valueA0) {
+		opl2->setChannelRegister(0xA0, oplChannel, valueA0);
+	}
+	if (opl2->getChannelRegister(0xB0, oplChannel) != valueB0) {
+		opl2->setChannelRegister(0xB0, oplChannel, valueB0);
+	}
+}
+
+
+/**
+ * Write the output levels of the carriers of a channel for the instrument and channel volume.
+ *
+ * @param channelNum - RAD channel to set the volume of.
+ */
+void RADPlayer::setVolume(byte channelNum) {
+	RADChannel &channel = channels[channelNum];
+	byte volume = (channel.instrumentVolume * channel.volume) >> 6;
+	byte numOperators = opl3 != NULL && channel.algorithm >= 2 ? 4 : 2;
+
+	for (byte op = 0; op < numOperators; op ++) {
+		byte level = channel.levels[op];
+		if (radCarriers[channel.algorithm] & (0x01 << op)) {
+			byte attenuation = 0x3F - (((0x3F - (level & 0x3F)) * volume) >> 6);
+			level = (level & 0xC0) + attenuation;
+		}
+		writeOperator(channelNum, op, 0x40, level);
+	}
+}
+
+
+/**
+ * Slide the pitch of a channel. The F-number wraps into the next or previous octave at the ends of its range.
+ *
+ * @param channelNum - RAD channel to slide.
+ * @param amount - Number of F-number steps to slide by.
+ * @param toneSlide - When true the slide stops at the destination of the tone slide of the channel.
+ */
+void RADPlayer::slide(byte channelNum, int amount, bool toneSlide) {
+	RADChannel &channel = channels[channelNum];
+	int fNumber = channel.fNumber + amount;
+	byte octave = channel.octave;
+
+	if (fNumber < RAD_FNUMBER_MIN) {
+		if (octave > 0) {
+			octave --;
+			fNumber += RAD_FNUMBER_MAX - RAD_FNUMBER_MIN;
+		} else {
+			fNumber = RAD_FNUMBER_MIN;
+		}
+	} else if (fNumber > RAD_FNUMBER_MAX) {
+		if (octave < 7) {
+			octave ++;
+			fNumber -= RAD_FNUMBER_MAX - RAD_FNUMBER_MIN;
+		} else {
+			fNumber = RAD_FNUMBER_MAX;
+		}
+	}
+
+	if (toneSlide) {
+		unsigned int position = (octave << 10) + fNumber;
+		unsigned int destination = (channel.toneSlideOctave << 10) + channel.toneSlideFNumber;
+		if ((amount > 0 && position >= destination) || (amount < 0 && position <= destination)) {
+			octave = channel.toneSlideOctave;
+			fNumber = channel.toneSlideFNumber;
+		}
+	}
+
+	channel.octave = octave;
+	channel.fNumber = fNumber;
+	setFrequency(channelNum);
+}
+
+
+/**
+ * Slide the pitch of a channel toward the destination of its tone slide.
+ *
+ * @param channelNum - RAD channel to slide.
+ */
+void RADPlayer::toneSlide(byte channelNum) {
+	RADChannel &channel = channels[channelNum];
+	unsigned int position = (channel.octave << 10) + channel.fNumber;
+	unsigned int destination = (channel.toneSlideOctave << 10) + channel.toneSlideFNumber;
+
+	if (position < destination) {
+		slide(channelNum, channel.portamentoSpeed, true);
+	} else if (position > destination) {
+		slide(channelNum, -channel.portamentoSpeed, true);
+	}
+}
+
+
+/**
+ * Slide the volume of a channel. Parameters 1 - 49 lower the volume and 51 - 99 raise the volume by the parameter - 50.
+ *
+ * @param channelNum - RAD channel to slide the volume of.
+ * @param param - Volume slide parameter.
+ */
+void RADPlayer::volumeSlide(byte channelNum, byte param) {
+	RADChannel &channel = channels[channelNum];
+
+	if (param > 0 && param < 50) {
+		channel.volume = channel.volume > param ? channel.volume - param : 0;
+	} else if (param > 50 && param < 100) {
+		channel.volume = channel.volume + param - 50 < 64 ? channel.volume + param - 50 : 64;
+	}
+
+	setVolume(channelNum);
+}
+
+
+/**
+ * Set the frequency multiplier of an operator of a channel.
+ *
+ * @param channelNum - RAD channel to change.
+ * @param param - Operator number 1 - 4 times 10 plus the frequency multiplier.
+ */
+void RADPlayer::setMultiplier(byte channelNum, byte param) {
+	byte op = param / 10;
+	if (op < 1 || op > (opl3 != NULL ? 4 : 2)) {
+		return;
+	}
+
+	byte channel = op <= 2 ? channelB[channelNum] : channelA[channelNum];
+	byte operatorNum = op & 0x01 ? CARRIER : MODULATOR;
+	byte value = opl2->getOperatorRegister(0x20, channel, operatorNum) & 0xF0;
+	opl2->setOperatorRegister(0x20, channel, operatorNum, value + param % 10);
+}
+
+
+/**
+ * Set the feedback of one of the channels of a RAD channel.
+ *
+ * @param channelNum - RAD channel to change.
+ * @param param - Feedback index 0 - 1 times 10 plus the feedback value.
+ */
+void RADPlayer::setFeedback(byte channelNum, byte param) {
+	if (param / 10 > 1 || (opl3 == NULL && param / 10 > 0)) {
+		return;
+	}
+
+	byte channel = param / 10 == 0 ? channelB[channelNum] : channelA[channelNum];
+	byte value = opl2->getChannelRegister(0xC0, channel) & 0xF1;
+	opl2->setChannelRegister(0xC0, channel, value + ((param % 10) & 0x07) * 2);
+}
+
+
+/**
+ * Write a register of one of the four operators of a RAD channel. Operators 1 and 2 are the carrier and modulator of
+ * channel B, operators 3 and 4 are the carrier and modulator of channel A. Operators 3 and 4 are only written on an OPL3.
+ *
+ * @param channelNum - RAD channel.
+ * @param op - Operator 0 - 3.
+ * @param reg - Base register of the operator.
+ * @param value - The value to write to the register.
+ */
+void RADPlayer::writeOperator(byte channelNum, byte op, byte reg, byte value) {
+	if (op < 2) {
+		opl2->setOperatorRegister(reg, channelB[channelNum], op == 0 ? CARRIER : MODULATOR, value);
+	} else if (opl3 != NULL) {
+		opl2->setOperatorRegister(reg, channelA[channelNum], op == 2 ? CARRIER : MODULATOR, value);
+	}
+}
+
+
+/**
+ * Read a byte of song data from SRAM, on Arduino from PROGMEM, or through the reader. When the reader cannot read the
+ * byte the song ends.
+ *
+ * @param offset - Song offset of the byte to read.
+ * @return The byte of song data or 0 if it cannot be read.
+ */
+byte RADPlayer::readByte(unsigned int offset) {
+	if (reader != NULL) {
+		if (offset - bufferOffset >= bufferLength && !fillBuffer(offset)) {
+			isReadError = true;
+			ended = true;
+			return 0x00;
+		}
+		return buffer[offset - bufferOffset];
+	}
+
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+		if (isProgmem) {
+			return pgm_read_byte_near(song + offset);
+		}
+	#endif
+	return song[offset];
+}
+
+
+/**
+ * Read the block of song data that holds the given song offset into the buffer.
+ *
+ * @param offset - Song offset that must be available in the buffer.
+ * @return True if the offset is within the song data.
+ */
+bool RADPlayer::fillBuffer(unsigned int offset) {
+	bufferOffset = offset - (offset % RAD_BUFFER_SIZE);
+	int numRead = reader(bufferOffset, buffer, RAD_BUFFER_SIZE);
+	bufferLength = numRead > 0 ? numRead : 0;
+	return offset - bufferOffset < bufferLength;
+}
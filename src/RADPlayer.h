@@ -0,0 +1,218 @@
+#include "OPL3.h"
+
+#ifndef RAD_PLAYER_H_
+	#define RAD_PLAYER_H_
+
+	#define RAD_VERSION_1 0x10
+	#define RAD_VERSION_2 0x21
+
+	#define RAD_NUM_CHANNELS     9
+	#define RAD_NUM_LINES       64
+	#define RAD_NUM_RIFFS       10
+	#define RAD_NO_LINE       0xFF
+	#define RAD_NO_DATA          0		// Song offset of data that is not there, the song starts with its signature.
+
+	// Songs that are played through a reader are read in blocks of this size. SD libraries keep the current sector in
+	// RAM, so small blocks are enough to avoid reading the card for every byte.
+	#if defined(__AVR__)
+		#define RAD_BUFFER_SIZE  32
+	#else
+		#define RAD_BUFFER_SIZE 128
+	#endif
+
+
+	/**
+	 * Callback used to read song data. It must read length bytes at the given offset of the RAD file into buffer and
+	 * return the number of bytes that were read.
+	 */
+	typedef int (*RADSongReader)(unsigned long offset, byte *buffer, unsigned int length);
+
+	// Effects, numbered after the characters 0-9 and A-Z used in the tracker.
+	#define RAD_EFFECT_NONE                0
+	#define RAD_EFFECT_PORTAMENTO_UP       1
+	#define RAD_EFFECT_PORTAMENTO_DOWN     2
+	#define RAD_EFFECT_TONE_SLIDE          3
+	#define RAD_EFFECT_TONE_VOLUME_SLIDE   5
+	#define RAD_EFFECT_VOLUME_SLIDE       10
+	#define RAD_EFFECT_SET_VOLUME         12
+	#define RAD_EFFECT_PATTERN_BREAK      13
+	#define RAD_EFFECT_SET_SPEED          15
+	#define RAD_EFFECT_IGNORE             18
+	#define RAD_EFFECT_MULTIPLIER         22
+	#define RAD_EFFECT_RIFF               27
+	#define RAD_EFFECT_TRANSPOSE          29
+	#define RAD_EFFECT_FEEDBACK           30
+
+
+	/**
+	 * A single decoded channel entry of a pattern or riff line.
+	 */
+	typedef struct RADEntry {
+		byte channel;
+		bool isLast;				// Last channel entry of the line.
+		byte note;					// Note 1 - 12, 15 for key off or 0 if there is no note.
+		byte octave;
+		byte instrument;			// Instrument number or 0 if there is no instrument.
+		byte effect;
+		byte param;
+	} RADEntry;
+
+
+	/**
+	 * Playback position within a riff. Riffs are short patterns for a single channel that are started by an instrument or
+	 * by the riff effects of a track.
+	 */
+	typedef struct RADRiff {
+		unsigned int position;		// Song offset of the next line or RAD_NO_DATA if the riff is not playing.
+		byte line;					// Line number of the next line to play.
+		byte speed;					// Number of ticks per line.
+		byte speedCount;			// Ticks left until the next line.
+		signed char transpose;		// Number of semitones the notes of the riff are transposed by.
+	} RADRiff;
+
+
+	/**
+	 * Playback state of a RAD channel.
+	 */
+	typedef struct RADChannel {
+		byte instrument;			// Current instrument number.
+		byte lastInstrument;		// Last instrument set by the track, used by v2 notes without instrument.
+		byte algorithm;
+		byte instrumentVolume;		// Volume of the instrument [0, 64].
+		byte volume;				// Channel volume [0, 64].
+		byte levels[4];				// Key scale level and output level registers of the instrument's operators.
+		signed char detune;
+		unsigned int riff;			// Song offset of the riff of the instrument or RAD_NO_DATA.
+		byte riffSpeed;
+		bool isKeyOn;
+
+		byte octave;
+		unsigned int fNumber;
+
+		byte effect;				// Continuous effect on this channel.
+		byte param;
+		byte portamentoSpeed;
+		byte toneSlideOctave;		// Destination of the tone slide.
+		unsigned int toneSlideFNumber;
+
+		RADRiff trackRiff;
+		RADRiff instrumentRiff;
+	} RADChannel;
+
+
+	/**
+	 * Instrument settings that are shared between v1 and v2 instruments.
+	 */
+	typedef struct RADInstrument {
+		byte algorithm;				// 0 - 6 for FM instruments, 7 for MIDI instruments that are not played.
+		byte panning[2];
+		byte feedback[2];
+		signed char detune;
+		byte riffSpeed;
+		byte volume;
+		byte operators[4][5];		// Registers 0x20, 0x40, 0x60, 0x80 and 0xE0 of the four operators.
+		unsigned int riff;			// Song offset of the riff of the instrument or RAD_NO_DATA.
+	} RADInstrument;
+
+
+	class RADPlayer {
+		public:
+			RADPlayer(OPL2* opl2Ref);
+			RADPlayer(OPL3* opl3Ref);
+			~RADPlayer();
+			#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+				bool load(const unsigned char *songData, bool fromProgmem = false);
+			#else
+				bool load(const unsigned char *songData);
+			#endif
+			bool load(RADSongReader songReader);
+			void restart();
+			void play();
+			unsigned long update();
+			bool songEnded();
+			void setLoop(bool enable);
+			byte getVersion();
+			unsigned long getTickDuration();
+			unsigned long getTickCpuTime();
+			unsigned long getMaxTickCpuTime();
+
+		private:
+			bool loadSong();
+			bool parseSong(bool storeOffsets);
+			void freeSong();
+			void tick();
+			void playLine();
+			void nextOrder();
+			unsigned int findLine(unsigned int data, byte lineNum);
+			unsigned int readEntry(unsigned int data, RADEntry &entry);
+			unsigned int playLineEntries(unsigned int data, byte channel, signed char transpose);
+			void playEntry(byte channelNum, RADEntry &entry, signed char transpose, bool fromRiff);
+			void startRiff(RADRiff &riff, unsigned int data, byte speed, signed char transpose);
+			void playRiffLine(byte channel, RADRiff &riff);
+			void loadInstrument(byte channelNum, byte instrumentNum);
+			bool readInstrument(byte instrumentNum, RADInstrument &instrument);
+			void playNote(byte channelNum, byte note, byte octave);
+			void setFrequency(byte channelNum);
+			void writeFrequency(byte oplChannel, byte valueA0, byte valueB0);
+			void setVolume(byte channelNum);
+			void slide(byte channelNum, int amount, bool toneSlide);
+			void toneSlide(byte channelNum);
+			void volumeSlide(byte channelNum, byte param);
+			void setMultiplier(byte channelNum, byte param);
+			void setFeedback(byte channelNum, byte param);
+			void writeOperator(byte channelNum, byte op, byte reg, byte value);
+			byte readByte(unsigned int offset);
+			bool fillBuffer(unsigned int offset);
+
+			OPL2* opl2 = NULL;
+			OPL3* opl3 = NULL;
+			byte channelA[RAD_NUM_CHANNELS];	// OPL3 channel holding operators 3 and 4 of a RAD channel.
+			byte channelB[RAD_NUM_CHANNELS];	// OPL channel holding operators 1 and 2 of a RAD channel.
+
+			const unsigned char *song = NULL;
+			bool isProgmem = false;
+			RADSongReader reader = NULL;	// Reader of the song or NULL if the song is in memory.
+			bool isReadError = false;
+
+			byte buffer[RAD_BUFFER_SIZE];
+			unsigned int bufferOffset = 0;	// Song offset of the first byte in the buffer.
+			unsigned int bufferLength = 0;	// Number of valid bytes in the buffer.
+
+			byte version = 0;
+			byte initialSpeed = 6;
+			unsigned long tickDuration = 20000;	// Duration of a tick in us.
+			unsigned int tickRemainder = 0;		// Fraction of a us of each tick in 1 / tickDivisor us.
+			unsigned int tickDivisor = 125;
+
+			// Offsets into the song data that are resolved when the song is loaded.
+			unsigned int orders = RAD_NO_DATA;
+			byte numOrders = 0;
+			unsigned int *patterns = NULL;
+			byte numPatterns = 0;
+			unsigned int *instruments = NULL;
+			byte numInstruments = 0;
+			unsigned int *riffs = NULL;			// Riff offsets by riff number * RAD_NUM_CHANNELS + channel.
+			byte numRiffs = 0;
+
+			RADChannel channels[RAD_NUM_CHANNELS];
+			unsigned int patternPosition = RAD_NO_DATA;	// Next line of the current pattern or RAD_NO_DATA.
+			byte order = 0;
+			byte line = 0;
+			byte speed = 6;
+			byte speedCount = 0;
+			byte breakLine = RAD_NO_LINE;
+			bool loop = false;
+			bool ended = true;
+
+			unsigned long nextTickTime = 0;	// Time in us at which the next tick is due.
+			unsigned int tickFraction = 0;	// Fraction of a us carried over between ticks.
+			unsigned long tickCpuTime = 0;
+			unsigned long maxTickCpuTime = 0;
+
+			// F-numbers of the notes C# to C that RAD uses within an octave.
+			const unsigned int noteFNumbers[12] = {
+				0x16B, 0x181, 0x198, 0x1B0, 0x1CA, 0x1E5,
+				0x202, 0x220, 0x241, 0x263, 0x287, 0x2AE
+			};
+	};
+#endif
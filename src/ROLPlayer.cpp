@@ -0,0 +1,769 @@
+/**
+ * Player for AdLib Visual Composer songs (ROL). A ROL file holds a separate list of notes, instrument changes, volume
+ * changes and pitch changes for each of its 11 voices, while the instruments themselves are stored by name in an
+ * external AdLib instrument bank (BNK).
+ *
+ * When a song is loaded every instrument name it uses is looked up once in the bank. The names in a BNK file are sorted
+ * alphabetically, so this is a binary search on the name table of the bank that reads only a few records regardless of
+ * the size of the bank. The instruments that were found are kept in RAM in a small hash table indexed by name, which
+ * makes an instrument change during playback a constant time lookup that never touches the bank again.
+ *
+ * During playback the player keeps a cursor into each event list of each voice together with the tick of its next
+ * event, so a tick only reads the song data of the events that are due.
+ */
+
+#include "ROLPlayer.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+#endif
+
+
+#define ROL_TEMPO_OFFSET         0xC9	// File offset of the number of tempo events.
+#define ROL_SECTION_PADDING        15	// Unused bytes in front of each section of a voice.
+#define ROL_NOTE_OFFSET            12	// ROL note number of the lowest C.
+#define ROL_INSTRUMENT_EVENT_SIZE  14
+#define ROL_FLOAT_EVENT_SIZE        6
+
+#define BNK_NAME_RECORD_SIZE       12
+#define BNK_DATA_RECORD_SIZE       30
+#define BNK_OPERATOR_SIZE          13
+
+static const byte rolDrumBits[NUM_DRUM_SOUNDS] = {
+	DRUM_BITS_BASS, DRUM_BITS_SNARE, DRUM_BITS_TOM, DRUM_BITS_CYMBAL, DRUM_BITS_HI_HAT
+};
+
+
+/**
+ * Create a ROL player.
+ *
+ * @param opl2Ref - Reference to the OPL2 instance used for playback.
+ */
+ROLPlayer::ROLPlayer(OPL2* opl2Ref) {
+	opl2 = opl2Ref;
+}
+
+
+/**
+ * Load a song and prepare it for playback. All instruments used by the song are read from the instrument bank and
+ * converted into the packed instrument format of the library, after which the bank is no longer needed. Instruments
+ * that are not in the bank are ignored. The OPL2 must have been initialized by calling its begin function before
+ * loading a song.
+ *
+ * @param songReader - Callback that reads the ROL file.
+ * @param bankReader - Callback that reads the BNK file.
+ * @return True if the song is a valid ROL file and the bank a valid BNK file.
+ */
+bool ROLPlayer::load(ROLReader songReader, ROLReader bankReader) {
+	this->songReader = songReader;
+	this->bankReader = bankReader;
+	reader = songReader;
+	bufferReader = NULL;
+	ended = false;
+
+	position = 0x00;
+	unsigned int majorVersion = readWord();
+	unsigned int minorVersion = readWord();
+	if (ended || majorVersion != 0 || minorVersion != 4) {
+		ended = true;
+		return false;
+	}
+
+	position = 0x2C;
+	ticksPerBeat = readWord();
+	position = 0x35;
+	isPercussive = readByte() == 0;
+	position = 0xC5;
+	basicTempo = readFloat();
+
+	// Find the instrument list of each voice. The length of the note list is only known by adding up the durations of
+	// its notes.
+	unsigned int numTempoEvents = readWord();
+	position += (unsigned long)numTempoEvents * ROL_FLOAT_EVENT_SIZE;
+	lastNoteTime = 0;
+	for (byte i = 0; i < ROL_NUM_VOICES && !ended; i ++) {
+		ROLVoice &voice = voices[i];
+		position += ROL_SECTION_PADDING;
+		voice.lastNoteTime = readWord();
+		for (unsigned int time = 0; time < voice.lastNoteTime && !ended; ) {
+			readWord();
+			time += readWord();
+		}
+
+		position += ROL_SECTION_PADDING;
+		voice.instrumentOffset = position;
+		unsigned long numEvents = readWord();
+		position += numEvents * ROL_INSTRUMENT_EVENT_SIZE + ROL_SECTION_PADDING;
+		numEvents = readWord();
+		position += numEvents * ROL_FLOAT_EVENT_SIZE + ROL_SECTION_PADDING;
+		numEvents = readWord();
+		position += numEvents * ROL_FLOAT_EVENT_SIZE;
+
+		if (i < (isPercussive ? ROL_NUM_VOICES : OPL2_NUM_CHANNELS) && voice.lastNoteTime > lastNoteTime) {
+			lastNoteTime = voice.lastNoteTime;
+		}
+	}
+
+	if (ended || ticksPerBeat == 0 || !loadInstruments()) {
+		ended = true;
+		return false;
+	}
+
+	opl2->setWaveFormSelect(true);
+	restart();
+	return true;
+}
+
+
+/**
+ * Restart the song from the beginning.
+ */
+void ROLPlayer::restart() {
+	silence();
+	opl2->setPercussion(isPercussive);
+
+	position = ROL_TEMPO_OFFSET;
+	unsigned int numTempoEvents = readWord();
+	initEventList(tempos, ROL_TEMPO_OFFSET + 2, numTempoEvents);
+	setTempo(1.0);
+
+	// The sections of a voice follow each other, so only the offset of the instrument list of each voice is needed to
+	// find all of its event lists.
+	unsigned long offset = ROL_TEMPO_OFFSET + 2 + (unsigned long)numTempoEvents * ROL_FLOAT_EVENT_SIZE;
+	for (byte i = 0; i < ROL_NUM_VOICES; i ++) {
+		ROLVoice &voice = voices[i];
+		voice.notes.offset = offset + ROL_SECTION_PADDING + 2;
+		voice.notes.nextTime = 0;
+		voice.instrument = ROL_NO_INSTRUMENT;
+		voice.note = 0;
+		voice.volume = 127;
+		voice.pitch = 0;
+
+		position = voice.instrumentOffset;
+		unsigned int numEvents = readWord();
+		initEventList(voice.instruments, voice.instrumentOffset + 2, numEvents);
+		offset = voice.instrumentOffset + 2 + (unsigned long)numEvents * ROL_INSTRUMENT_EVENT_SIZE + ROL_SECTION_PADDING;
+
+		position = offset;
+		numEvents = readWord();
+		initEventList(voice.volumes, offset + 2, numEvents);
+		offset += 2 + (unsigned long)numEvents * ROL_FLOAT_EVENT_SIZE + ROL_SECTION_PADDING;
+
+		position = offset;
+		numEvents = readWord();
+		initEventList(voice.pitches, offset + 2, numEvents);
+		offset += 2 + (unsigned long)numEvents * ROL_FLOAT_EVENT_SIZE;
+	}
+
+	songTime = 0;
+	ended = false;
+	nextTickTime = micros();
+}
+
+
+/**
+ * Play the loaded song until it ends. When looping is enabled this function does not return.
+ */
+void ROLPlayer::play() {
+	while (!ended) {
+		update();
+	}
+}
+
+
+/**
+ * Update the player to play the song in the background. All ticks that are due are processed and the time until the
+ * next tick is returned. If it is not yet time to process the next tick this function exits immediately.
+ *
+ * @return The number of us until update should be called again.
+ */
+unsigned long ROLPlayer::update() {
+	while (!ended && (long)(micros() - nextTickTime) >= 0) {
+		tick();
+		nextTickTime += tickDuration;
+	}
+
+	long remaining = (long)(nextTickTime - micros());
+	return ended || remaining < 0 ? 0 : remaining;
+}
+
+
+/**
+ * Has the song ended?
+ *
+ * @return True if the end of the song has been reached and looping is disabled.
+ */
+bool ROLPlayer::songEnded() {
+	return ended;
+}
+
+
+/**
+ * Enable or disable looping of the song.
+ *
+ * @param enable - Restart the song when its end is reached.
+ */
+void ROLPlayer::setLoop(bool enable) {
+	loop = enable;
+}
+
+
+/**
+ * Get the number of instruments of the song that were found in the instrument bank.
+ *
+ * @return The number of instruments, at most ROL_MAX_INSTRUMENTS.
+ */
+byte ROLPlayer::getNumInstruments() {
+	return numInstruments;
+}
+
+
+/**
+ * Process all events that are due at the current tick of the song. Only event lists that have an event at this tick
+ * are read.
+ */
+void ROLPlayer::tick() {
+	while (tempos.numEvents > 0 && tempos.nextTime <= songTime) {
+		position = tempos.offset;
+		setTempo(readFloat());
+		nextEvent(tempos);
+	}
+
+	byte numVoices = isPercussive ? ROL_NUM_VOICES : OPL2_NUM_CHANNELS;
+	for (byte i = 0; i < numVoices; i ++) {
+		ROLVoice &voice = voices[i];
+
+		while (voice.instruments.numEvents > 0 && voice.instruments.nextTime <= songTime) {
+			char name[ROL_NAME_LENGTH];
+			position = voice.instruments.offset;
+			readName(name);
+			position += 3;
+
+			byte slot = findInstrument(name);
+			if (slot != ROL_NO_INSTRUMENT && instruments[slot].nameHash != 0) {
+				voice.instrument = slot;
+				setInstrument(i);
+			}
+			nextEvent(voice.instruments);
+		}
+
+		while (voice.volumes.numEvents > 0 && voice.volumes.nextTime <= songTime) {
+			position = voice.volumes.offset;
+			float volume = readFloat();
+			voice.volume = volume <= 0.0 ? 0 : volume >= 1.0 ? 127 : (byte)(volume * 127.0);
+			setVolume(i);
+			nextEvent(voice.volumes);
+		}
+
+		while (voice.pitches.numEvents > 0 && voice.pitches.nextTime <= songTime) {
+			position = voice.pitches.offset;
+			float pitch = readFloat();
+			voice.pitch = pitch <= 0.0 ? -100 : pitch >= 2.0 ? 100 : (signed char)((pitch - 1.0) * 100.0);
+			if (voice.note != 0 && (!isPercussive || i < ROL_NUM_MELODIC_VOICES)) {
+				writeFrequency(i);
+			}
+			nextEvent(voice.pitches);
+		}
+
+		// Notes follow each other without gaps, so a note only starts when the previous note ends. Notes without a
+		// duration are skipped.
+		if (voice.notes.nextTime == songTime) {
+			byte previousNote = voice.note;
+			voice.note = 0;
+			position = voice.notes.offset;
+			while (voice.notes.nextTime == songTime && songTime < voice.lastNoteTime && !ended) {
+				voice.note = readWord();
+				voice.notes.nextTime += readWord();
+			}
+			voice.notes.offset = position;
+
+			if (voice.note != 0 || previousNote != 0) {
+				playNote(i);
+			}
+		}
+	}
+
+	if (ended || songTime >= lastNoteTime) {
+		if (loop) {
+			restart();
+		} else {
+			silence();
+			ended = true;
+		}
+		return;
+	}
+
+	songTime ++;
+}
+
+
+/**
+ * Point an event list to its first event.
+ *
+ * @param list - The event list to initialize.
+ * @param offset - File offset of the first event.
+ * @param numEvents - Number of events in the list.
+ */
+void ROLPlayer::initEventList(ROLEventList &list, unsigned long offset, unsigned int numEvents) {
+	position = offset;
+	list.numEvents = numEvents;
+	list.nextTime = numEvents > 0 ? readWord() : 0;
+	list.offset = position;
+}
+
+
+/**
+ * Move an event list to its next event after the data of the current event has been read.
+ *
+ * @param list - The event list to advance.
+ */
+void ROLPlayer::nextEvent(ROLEventList &list) {
+	if (-- list.numEvents > 0) {
+		list.nextTime = readWord();
+	}
+	list.offset = position;
+}
+
+
+/**
+ * Start the current note of a voice after releasing the previous one. In percussive mode voices 7 - 11 play the bass
+ * drum, snare drum, tom tom, cymbal and hi-hat.
+ *
+ * @param voiceNum - The voice to play the note of.
+ */
+void ROLPlayer::playNote(byte voiceNum) {
+	ROLVoice &voice = voices[voiceNum];
+
+	if (isPercussive && voiceNum >= ROL_NUM_MELODIC_VOICES) {
+		byte drum = voiceNum - ROL_NUM_MELODIC_VOICES;
+		if (voice.note >= ROL_NOTE_OFFSET) {
+			byte note = voice.note - ROL_NOTE_OFFSET;
+			opl2->playDrum(drum, note / 12, note % 12);
+		} else {
+			opl2->setDrums(opl2->getDrums() & ~rolDrumBits[drum]);
+		}
+		return;
+	}
+
+	opl2->setChannelRegister(0xB0, voiceNum, opl2->getChannelRegister(0xB0, voiceNum) & 0x1F);
+	if (voice.note != 0) {
+		writeFrequency(voiceNum);
+	}
+}
+
+
+/**
+ * Load the current instrument of a voice into its channel or drum.
+ *
+ * @param voiceNum - The voice to set the instrument of.
+ */
+void ROLPlayer::setInstrument(byte voiceNum) {
+	const byte *data = instruments[voices[voiceNum].instrument].data;
+
+	if (isPercussive && voiceNum >= ROL_NUM_MELODIC_VOICES) {
+		setVolume(voiceNum);
+		return;
+	}
+
+	for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+		opl2->setOperatorRegister(0x20, voiceNum, op, data[op * 5 + 1]);
+		opl2->setOperatorRegister(0x40, voiceNum, op, data[op * 5 + 2]);
+		opl2->setOperatorRegister(0x60, voiceNum, op, data[op * 5 + 3]);
+		opl2->setOperatorRegister(0x80, voiceNum, op, data[op * 5 + 4]);
+	}
+	opl2->setOperatorRegister(0xE0, voiceNum, OPERATOR1, data[10] & 0x07);
+	opl2->setOperatorRegister(0xE0, voiceNum, OPERATOR2, (data[10] >> 4) & 0x07);
+	opl2->setChannelRegister(0xC0, voiceNum, data[5] & 0x0F);
+	setVolume(voiceNum);
+}
+
+
+/**
+ * Apply the volume of a voice to the output level of its carrier. Drums are scaled by reloading their instrument.
+ *
+ * @param voiceNum - The voice to set the volume of.
+ */
+void ROLPlayer::setVolume(byte voiceNum) {
+	ROLVoice &voice = voices[voiceNum];
+	if (voice.instrument == ROL_NO_INSTRUMENT) {
+		return;
+	}
+
+	const byte *data = instruments[voice.instrument].data;
+	if (isPercussive && voiceNum >= ROL_NUM_MELODIC_VOICES) {
+		#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+			Instrument instrument = opl2->loadInstrument(data, INSTRUMENT_DATA_SRAM);
+		#else
+			Instrument instrument = opl2->loadInstrument(data);
+		#endif
+		opl2->setDrumInstrument(instrument, voiceNum - ROL_NUM_MELODIC_VOICES, voice.volume / 127.0);
+		return;
+	}
+
+	byte outputLevel = 63 - ((63 - (data[7] & 0x3F)) * voice.volume) / 127;
+	opl2->setOperatorRegister(0x40, voiceNum, OPERATOR2, (data[7] & 0xC0) + outputLevel);
+}
+
+
+/**
+ * Write the frequency of the current note of a melodic voice and key it on. The pitch bend of the voice moves the frequency towards
+ * the neighbouring semitone.
+ *
+ * @param voiceNum - The voice to write the frequency of.
+ */
+void ROLPlayer::writeFrequency(byte voiceNum) {
+	ROLVoice &voice = voices[voiceNum];
+	byte note = voice.note > ROL_NOTE_OFFSET ? voice.note - ROL_NOTE_OFFSET : 0;
+	byte octave = note / 12 < NUM_OCTAVES ? note / 12 : NUM_OCTAVES;
+	note = note % 12;
+
+	int fNumber = opl2->getNoteFNumber(note);
+	if (voice.pitch > 0) {
+		int target = note == 11 ? opl2->getNoteFNumber(0) * 2 : opl2->getNoteFNumber(note + 1);
+		fNumber += ((target - fNumber) * voice.pitch) / 100;
+	} else if (voice.pitch < 0) {
+		int target = note == 0 ? opl2->getNoteFNumber(11) / 2 : opl2->getNoteFNumber(note - 1);
+		fNumber -= ((target - fNumber) * voice.pitch) / 100;
+	}
+
+	opl2->setChannelRegister(0xA0, voiceNum, fNumber & 0xFF);
+	opl2->setChannelRegister(0xB0, voiceNum, 0x20 + (octave << 2) + ((fNumber >> 8) & 0x03));
+}
+
+
+/**
+ * Set the duration of a tick from the basic tempo of the song and the given tempo multiplier.
+ *
+ * @param multiplier - Tempo multiplier of a tempo event.
+ */
+void ROLPlayer::setTempo(float multiplier) {
+	float ticksPerMinute = basicTempo * multiplier * ticksPerBeat;
+	tickDuration = ticksPerMinute > 1.0 ? (unsigned long)(60000000.0 / ticksPerMinute) : 60000000UL;
+}
+
+
+/**
+ * Release all notes and drums.
+ */
+void ROLPlayer::silence() {
+	for (byte i = 0; i < OPL2_NUM_CHANNELS; i ++) {
+		opl2->setChannelRegister(0xB0, i, opl2->getChannelRegister(0xB0, i) & 0x1F);
+	}
+	opl2->setDrums(false, false, false, false, false);
+}
+
+
+/**
+ * Look up all instruments used by the song in the instrument bank and put them into the instrument table.
+ *
+ * @return True if the instrument bank is valid.
+ */
+bool ROLPlayer::loadInstruments() {
+	for (byte i = 0; i < ROL_MAX_INSTRUMENTS; i ++) {
+		instruments[i].nameHash = 0;
+	}
+	numInstruments = 0;
+
+	// Check the signature of the bank.
+	reader = bankReader;
+	position = 0x02;
+	const char signature[] = "ADLIB-";
+	for (byte i = 0; i < 6; i ++) {
+		if (readByte() != signature[i]) {
+			ended = true;
+		}
+	}
+	reader = songReader;
+	if (ended) {
+		return false;
+	}
+
+	for (byte i = 0; i < ROL_NUM_VOICES; i ++) {
+		position = voices[i].instrumentOffset;
+		unsigned int numEvents = readWord();
+
+		for (unsigned int j = 0; j < numEvents && numInstruments < ROL_MAX_INSTRUMENTS; j ++) {
+			char name[ROL_NAME_LENGTH];
+			position += 2;
+			readName(name);
+			position += 3;
+
+			byte slot = findInstrument(name);
+			if (instruments[slot].nameHash == 0) {
+				unsigned long songPosition = position;
+				if (findBankInstrument(name, instruments[slot].data)) {
+					instruments[slot].nameHash = hashName(name);
+					for (byte k = 0; k < ROL_NAME_LENGTH; k ++) {
+						instruments[slot].name[k] = name[k];
+					}
+					numInstruments ++;
+				}
+				position = songPosition;
+			}
+		}
+	}
+
+	return !ended;
+}
+
+
+/**
+ * Find an instrument in the instrument bank by binary search on its alphabetically sorted list of names. Only the number
+ * of used records given in the header is searched, the records after them are free space of the bank. Records that are
+ * marked as unused are deleted instruments and are never returned.
+ *
+ * @param name - Name of the instrument to find.
+ * @param data - Receives the instrument in packed format.
+ * @return True if the instrument was found.
+ */
+bool ROLPlayer::findBankInstrument(const char *name, byte *data) {
+	reader = bankReader;
+	position = 0x08;
+	unsigned int numUsed = readWord();
+	unsigned int numRecords = readWord();
+	unsigned long namesOffset = readDWord();
+	unsigned long dataOffset = readDWord();
+
+	bool isFound = false;
+	unsigned int first = 0;
+	unsigned int last = numUsed < numRecords ? numUsed : numRecords;
+	while (first < last && !ended) {
+		unsigned int middle = first + (last - first) / 2;
+		int compare = compareBankName(namesOffset + (unsigned long)middle * BNK_NAME_RECORD_SIZE, name);
+		if (compare == 0) {
+			position = namesOffset + (unsigned long)middle * BNK_NAME_RECORD_SIZE;
+			unsigned int index = readWord();
+			if (readByte() != 0) {
+				readBankInstrument(dataOffset + (unsigned long)index * BNK_DATA_RECORD_SIZE, data);
+				isFound = true;
+			}
+			break;
+		} else if (compare < 0) {
+			first = middle + 1;
+		} else {
+			last = middle;
+		}
+	}
+
+	reader = songReader;
+	return isFound;
+}
+
+
+/**
+ * Compare the name of a name record of the instrument bank with the given name. Names are compared without regard to
+ * case.
+ *
+ * @param offset - File offset of the name record.
+ * @param name - Name to compare with.
+ * @return Less than zero if the record comes before the name, zero if they are equal or greater than zero if the
+ *         record comes after the name.
+ */
+int ROLPlayer::compareBankName(unsigned long offset, const char *name) {
+	char recordName[ROL_NAME_LENGTH];
+	position = offset + 3;
+	readName(recordName);
+
+	for (byte i = 0; i < ROL_NAME_LENGTH; i ++) {
+		char a = recordName[i] >= 'a' && recordName[i] <= 'z' ? recordName[i] - 0x20 : recordName[i];
+		char b = name[i] >= 'a' && name[i] <= 'z' ? name[i] - 0x20 : name[i];
+		if (a != b || a == 0) {
+			return a - b;
+		}
+	}
+
+	return 0;
+}
+
+
+/**
+ * Read an instrument data record of the instrument bank and convert it into packed format. The AdLib format stores
+ * each register field in a separate byte. Single operator drum instruments only define the first operator, which is
+ * copied to the second operator for the drums that are played by the carrier.
+ *
+ * @param offset - File offset of the instrument data record.
+ * @param data - Receives the instrument in packed format.
+ */
+void ROLPlayer::readBankInstrument(unsigned long offset, byte *data) {
+	position = offset;
+	bool isDrum = readByte() != 0;
+	byte voiceNum = readByte();
+
+	byte feedback = 0;
+	bool isFrequencyModulation = true;
+	for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+		byte params[BNK_OPERATOR_SIZE];
+		for (byte i = 0; i < BNK_OPERATOR_SIZE; i ++) {
+			params[i] = readByte();
+		}
+
+		data[op * 5 + 1] =
+			(params[9] ? 0x80 : 0x00) +
+			(params[10] ? 0x40 : 0x00) +
+			(params[5] ? 0x20 : 0x00) +
+			(params[11] ? 0x10 : 0x00) +
+			(params[1] & 0x0F);
+		data[op * 5 + 2] = ((params[0] & 0x03) << 6) + (params[8] & 0x3F);
+		data[op * 5 + 3] = ((params[3] & 0x0F) << 4) + (params[6] & 0x0F);
+		data[op * 5 + 4] = ((params[4] & 0x0F) << 4) + (params[7] & 0x0F);
+
+		if (op == OPERATOR1) {
+			feedback = params[2] & 0x07;
+			isFrequencyModulation = params[12] != 0;
+		}
+	}
+
+	data[0] = 0x00;
+	data[5] = (feedback << 1) + (isFrequencyModulation ? 0x00 : 0x01);
+	data[10] = readByte() & 0x07;
+	data[10] += (readByte() & 0x07) << 4;
+
+	if (isDrum && voiceNum > 6) {
+		for (byte i = 1; i < 5; i ++) {
+			data[i + 5] = data[i];
+		}
+		data[10] = (data[10] & 0x0F) + (data[10] << 4);
+	}
+}
+
+
+/**
+ * Find the slot of an instrument in the instrument table. Slots are probed linearly starting at the slot of the hash of
+ * the name. The names are only compared when their hashes are equal.
+ *
+ * @param name - Name of the instrument.
+ * @return The slot holding the instrument, the empty slot where it belongs if it is not in the table or
+ *         ROL_NO_INSTRUMENT if the table is full.
+ */
+byte ROLPlayer::findInstrument(const char *name) {
+	unsigned int nameHash = hashName(name);
+	byte slot = nameHash % ROL_MAX_INSTRUMENTS;
+	for (byte i = 0; i < ROL_MAX_INSTRUMENTS; i ++) {
+		if (instruments[slot].nameHash == 0 ||
+			(instruments[slot].nameHash == nameHash && isSameName(instruments[slot].name, name))) {
+			return slot;
+		}
+		slot = (slot + 1) % ROL_MAX_INSTRUMENTS;
+	}
+
+	return ROL_NO_INSTRUMENT;
+}
+
+
+/**
+ * Compare two instrument names without regard to case.
+ *
+ * @param nameA - The first name.
+ * @param nameB - The second name.
+ * @return True if both names are the same.
+ */
+bool ROLPlayer::isSameName(const char *nameA, const char *nameB) {
+	for (byte i = 0; i < ROL_NAME_LENGTH; i ++) {
+		char a = nameA[i] >= 'a' && nameA[i] <= 'z' ? nameA[i] - 0x20 : nameA[i];
+		char b = nameB[i] >= 'a' && nameB[i] <= 'z' ? nameB[i] - 0x20 : nameB[i];
+		if (a != b) {
+			return false;
+		} else if (a == 0) {
+			break;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * Calculate the 16 bit hash of an instrument name without regard to case. The hash is never zero, which marks an empty
+ * slot in the instrument table.
+ *
+ * @param name - The instrument name.
+ * @return The hash of the name.
+ */
+unsigned int ROLPlayer::hashName(const char *name) {
+	unsigned int hash = 5381;
+	for (byte i = 0; i < ROL_NAME_LENGTH && name[i] != 0; i ++) {
+		char c = name[i] >= 'a' && name[i] <= 'z' ? name[i] - 0x20 : name[i];
+		hash = (((hash << 5) + hash) ^ (byte)c) & 0xFFFF;
+	}
+
+	return hash != 0 ? hash : 1;
+}
+
+
+/**
+ * Read a zero terminated instrument name of at most 8 characters.
+ *
+ * @param name - Receives the name.
+ */
+void ROLPlayer::readName(char *name) {
+	for (byte i = 0; i < ROL_NAME_LENGTH; i ++) {
+		name[i] = readByte();
+	}
+	name[ROL_NAME_LENGTH - 1] = 0;
+}
+
+
+/**
+ * Read the block of data of the current file that holds the given file offset into the buffer.
+ *
+ * @param offset - File offset that must be available in the buffer.
+ * @return True if the offset is within the file.
+ */
+bool ROLPlayer::fillBuffer(unsigned long offset) {
+	bufferReader = reader;
+	bufferOffset = offset - (offset % ROL_BUFFER_SIZE);
+	int numRead = reader(bufferOffset, buffer, ROL_BUFFER_SIZE);
+	bufferLength = numRead > 0 ? numRead : 0;
+	return offset - bufferOffset < bufferLength;
+}
+
+
+/**
+ * Read the next byte of the current file. When the end of the file is reached the song ends.
+ *
+ * @return The next byte or 0 if there is no more data.
+ */
+byte ROLPlayer::readByte() {
+	if ((bufferReader != reader || position - bufferOffset >= bufferLength) && !fillBuffer(position)) {
+		ended = true;
+		return 0x00;
+	}
+
+	return buffer[position ++ - bufferOffset];
+}
+
+
+/**
+ * Read a little endian 16 bit word.
+ */
+unsigned int ROLPlayer::readWord() {
+	unsigned int value = readByte();
+	return value + (readByte() << 8);
+}
+
+
+/**
+ * Read a little endian 32 bit double word.
+ */
+unsigned long ROLPlayer::readDWord() {
+	unsigned long value = readWord();
+	return value + ((unsigned long)readWord() << 16);
+}
+
+
+/**
+ * Read a little endian 32 bit IEEE float.
+ */
+float ROLPlayer::readFloat() {
+	union {
+		byte bytes[4];
+		float value;
+	} data;
+
+	for (byte i = 0; i < 4; i ++) {
+		data.bytes[i] = readByte();
+	}
+	return data.value;
+}
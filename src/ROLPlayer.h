@@ -0,0 +1,130 @@
+#include "OPL2.h"
+
+#ifndef ROL_PLAYER_H_
+	#define ROL_PLAYER_H_
+
+	// Song and bank data is read in blocks of this size. The instruments used by a song are kept in RAM in the 11 byte
+	// packed format of the instruments in instruments.h.
+	#if defined(__AVR__)
+		#define ROL_BUFFER_SIZE      128
+		#define ROL_MAX_INSTRUMENTS   16
+	#else
+		#define ROL_BUFFER_SIZE      512
+		#define ROL_MAX_INSTRUMENTS   64
+	#endif
+
+	#define ROL_NUM_VOICES        11
+	#define ROL_NUM_MELODIC_VOICES 6	// Number of melodic voices in percussive mode.
+	#define ROL_NAME_LENGTH        9
+	#define ROL_NO_INSTRUMENT   0xFF
+
+
+	/**
+	 * Callback used to read ROL or BNK data. It must read length bytes at the given offset of the file into buffer and
+	 * return the number of bytes that were read.
+	 */
+	typedef int (*ROLReader)(unsigned long offset, byte *buffer, unsigned int length);
+
+
+	/**
+	 * Position in one of the event lists of a song.
+	 */
+	typedef struct ROLEventList {
+		unsigned long offset;		// File offset of the next event.
+		unsigned int numEvents;		// Number of events left in the list.
+		unsigned int nextTime;		// Tick at which the next event is due.
+	} ROLEventList;
+
+
+	/**
+	 * Playback state of a ROL voice. Each voice has its own list of notes, instrument changes, volume changes and pitch
+	 * changes.
+	 */
+	typedef struct ROLVoice {
+		ROLEventList notes;
+		ROLEventList instruments;
+		ROLEventList volumes;
+		ROLEventList pitches;
+		unsigned long instrumentOffset;	// File offset of the instrument list of the voice.
+		unsigned int lastNoteTime;		// Tick at which the last note of the voice ends.
+		byte instrument;				// Slot of the current instrument or ROL_NO_INSTRUMENT.
+		byte note;						// Current ROL note number or 0 if the voice is silent.
+		byte volume;					// Volume [0, 127].
+		signed char pitch;				// Pitch bend in percent of a semitone [-100, 100].
+	} ROLVoice;
+
+
+	/**
+	 * An instrument used by the song. Instruments are looked up by the hash of their name, and the name itself tells
+	 * instruments apart of which the names have the same hash.
+	 */
+	typedef struct ROLInstrument {
+		unsigned int nameHash;
+		char name[ROL_NAME_LENGTH];
+		byte data[11];
+	} ROLInstrument;
+
+
+	class ROLPlayer {
+		public:
+			ROLPlayer(OPL2* opl2Ref);
+			bool load(ROLReader songReader, ROLReader bankReader);
+			void restart();
+			void play();
+			unsigned long update();
+			bool songEnded();
+			void setLoop(bool enable);
+			byte getNumInstruments();
+
+		private:
+			void tick();
+			void initEventList(ROLEventList &list, unsigned long offset, unsigned int numEvents);
+			void nextEvent(ROLEventList &list);
+			void playNote(byte voiceNum);
+			void setInstrument(byte voiceNum);
+			void setVolume(byte voiceNum);
+			void writeFrequency(byte voiceNum);
+			void setTempo(float multiplier);
+			void silence();
+
+			bool loadInstruments();
+			bool findBankInstrument(const char *name, byte *data);
+			int compareBankName(unsigned long offset, const char *name);
+			void readBankInstrument(unsigned long offset, byte *data);
+			byte findInstrument(const char *name);
+			bool isSameName(const char *nameA, const char *nameB);
+			unsigned int hashName(const char *name);
+			void readName(char *name);
+
+			bool fillBuffer(unsigned long offset);
+			byte readByte();
+			unsigned int readWord();
+			unsigned long readDWord();
+			float readFloat();
+
+			OPL2* opl2 = NULL;
+			ROLReader songReader = NULL;
+			ROLReader bankReader = NULL;
+			ROLReader reader = NULL;			// File that is currently being read.
+			bool isPercussive = false;
+			unsigned int ticksPerBeat = 0;
+			float basicTempo = 120.0;
+			unsigned int lastNoteTime = 0;		// Tick at which the song ends.
+			ROLInstrument instruments[ROL_MAX_INSTRUMENTS];
+			byte numInstruments = 0;
+			bool loop = false;
+			bool ended = true;
+
+			ROLReader bufferReader = NULL;		// File that is currently held in the buffer.
+			byte buffer[ROL_BUFFER_SIZE];
+			unsigned long bufferOffset = 0;		// File offset of the first byte in the buffer.
+			unsigned int bufferLength = 0;		// Number of valid bytes in the buffer.
+			unsigned long position = 0;			// File offset of the next byte to decode.
+
+			ROLEventList tempos;
+			ROLVoice voices[ROL_NUM_VOICES];
+			unsigned int songTime = 0;			// Current tick of the song.
+			unsigned long tickDuration = 0;		// Duration of a tick in us at the current tempo.
+			unsigned long nextTickTime = 0;		// Time in us at which the next tick is due.
+	};
+#endif
@@ -0,0 +1,285 @@
+/**
+ * Rhythm engine for the percussion mode of the OPL. In percussion mode the snare and hi-hat share channel 7 and the tom
+ * and cymbal share channel 8, and each hit with playDrum rewrites the pitch of the channel and writes register BD twice.
+ * The rhythm engine collects all drum hits of a tick and plays them together with a single write of register BD, so
+ * drums that are hit together also sound together.
+ *
+ * When both drums of a shared channel are hit in the same tick only one pitch can be used, which is decided by the
+ * pitch policy. Drum instruments are only written to the OPL when a drum is hit after its instrument has changed, so a
+ * sketch or player can set the instrument before every hit without extra register writes. Drums are released after a
+ * short gate time, again with a single write for all drums that are due.
+ */
+
+#include "Rhythm.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+	#include <string.h>
+#endif
+
+
+/**
+ * Create a rhythm engine for the percussion mode of an OPL2, OPL3 or OPL3Duo.
+ *
+ * @param opl2Ref - Reference to the OPL instance that plays the drums.
+ */
+Rhythm::Rhythm(OPL2* opl2Ref) {
+	opl2 = opl2Ref;
+
+	for (byte i = 0; i < NUM_DRUM_SOUNDS; i ++) {
+		memset(&drums[i].instrument, 0, sizeof(Instrument));
+		drums[i].volume = 1.0;
+		drums[i].instrumentChanged = false;
+		drums[i].block = 0;
+		drums[i].fNumber = 0;
+		drums[i].order = 0;
+		drums[i].releaseTime = 0;
+	}
+}
+
+
+/**
+ * Enable percussion mode and silence all drums. Channels 6, 7 and 8 can not be used for melodic voices anymore.
+ */
+void Rhythm::begin() {
+	for (byte i = 0; i < RHYTHM_NUM_CHANNELS; i ++) {
+		opl2->setKeyOn(RHYTHM_FIRST_CHANNEL + i, false);
+	}
+	opl2->setChipRegister(0xBD, (opl2->getChipRegister(0xBD) & 0xC0) | 0x20);
+
+	triggers = 0;
+	numTriggers = 0;
+}
+
+
+/**
+ * Set the instrument of a drum. The instrument is written to the OPL when the drum is hit next, and only when it
+ * differs from the instrument that was set before.
+ *
+ * @param drum - The drum to set the instrument of, one of DRUM_*.
+ * @param instrument - The instrument to set.
+ * @param volume - Optional volume of the drum [0.0, 1.0].
+ */
+void Rhythm::setInstrument(byte drum, Instrument instrument, float volume) {
+	if (drum >= NUM_DRUM_SOUNDS) {
+		return;
+	}
+
+	RhythmDrum& rhythmDrum = drums[drum];
+	if (volume != rhythmDrum.volume || memcmp(&instrument, &rhythmDrum.instrument, sizeof(Instrument)) != 0) {
+		rhythmDrum.instrument = instrument;
+		rhythmDrum.volume = volume;
+		rhythmDrum.instrumentChanged = true;
+	}
+}
+
+
+/**
+ * Set the policy that decides the pitch of a channel when both drums that share it are hit in the same tick.
+ *
+ * @param policy - One of RHYTHM_PITCH_*.
+ */
+void Rhythm::setPitchPolicy(byte policy) {
+	pitchPolicy = policy <= RHYTHM_PITCH_HOLD ? policy : RHYTHM_PITCH_TONAL;
+}
+
+
+/**
+ * Get the policy that decides the pitch of a channel that is shared by two drums.
+ *
+ * @return One of RHYTHM_PITCH_*.
+ */
+byte Rhythm::getPitchPolicy() {
+	return pitchPolicy;
+}
+
+
+/**
+ * Set the time after which drums are released by update.
+ *
+ * @param gateTime - Time in ms that drums are held or 0 to hold drums until they are hit again or released.
+ */
+void Rhythm::setGateTime(unsigned int gateTime) {
+	this->gateTime = gateTime;
+}
+
+
+/**
+ * Get the time after which drums are released by update.
+ *
+ * @return The time in ms that drums are held.
+ */
+unsigned int Rhythm::getGateTime() {
+	return gateTime;
+}
+
+
+/**
+ * Hit a drum at the note that is stored in the transpose byte of its instrument. When the instrument has no note the
+ * drum plays at the pitch its channel already has.
+ *
+ * @param drum - The drum to hit, one of DRUM_*.
+ */
+void Rhythm::trigger(byte drum) {
+	if (drum >= NUM_DRUM_SOUNDS) {
+		return;
+	}
+
+	byte note = drums[drum].instrument.transpose;
+	if (note > 0) {
+		trigger(drum, note / NUM_NOTES, note % NUM_NOTES);
+	} else {
+		drums[drum].fNumber = 0;
+		drums[drum].order = ++ numTriggers;
+		triggers |= drumBits[drum];
+	}
+}
+
+
+/**
+ * Hit a drum at the given note. The drum sounds when the hits of this tick are flushed by flush or update.
+ *
+ * @param drum - The drum to hit, one of DRUM_*.
+ * @param octave - Octave of the note [0, 7].
+ * @param note - The note to play, one of NOTE_*.
+ */
+void Rhythm::trigger(byte drum, byte octave, byte note) {
+	if (drum >= NUM_DRUM_SOUNDS) {
+		return;
+	}
+
+	drums[drum].block = octave < NUM_OCTAVES ? octave : NUM_OCTAVES;
+	drums[drum].fNumber = opl2->getNoteFNumber(note % NUM_NOTES);
+	drums[drum].order = ++ numTriggers;
+	triggers |= drumBits[drum];
+}
+
+
+/**
+ * Release a drum immediately.
+ *
+ * @param drum - The drum to release, one of DRUM_*.
+ */
+void Rhythm::release(byte drum) {
+	if (drum < NUM_DRUM_SOUNDS && (opl2->getChipRegister(0xBD) & drumBits[drum])) {
+		opl2->setChipRegister(0xBD, opl2->getChipRegister(0xBD) & ~drumBits[drum]);
+	}
+}
+
+
+/**
+ * Play all drums that were hit since the last flush.
+ */
+void Rhythm::flush() {
+	writeDrums(0);
+}
+
+
+/**
+ * Play all drums that were hit since the last call and release the drums of which the gate time has passed. Drums that
+ * are played and released are written together.
+ *
+ * @return The number of us until the next drum is released, the gate time when no drums are held or RHYTHM_NO_RELEASE
+ *         when the gate time is 0.
+ */
+unsigned long Rhythm::update() {
+	unsigned long now = micros();
+	unsigned long next = gateTime > 0 ? gateTime * 1000UL : RHYTHM_NO_RELEASE;
+	byte keyedDrums = opl2->getChipRegister(0xBD) & 0x1F;
+	byte releases = 0;
+
+	if (gateTime > 0) {
+		for (byte i = 0; i < NUM_DRUM_SOUNDS; i ++) {
+			if (keyedDrums & drumBits[i]) {
+				long remaining = (long)(drums[i].releaseTime - now);
+				if (remaining <= 0) {
+					releases |= drumBits[i];
+				} else if ((unsigned long)remaining < next) {
+					next = remaining;
+				}
+			}
+		}
+	}
+
+	writeDrums(releases);
+	return next;
+}
+
+
+/**
+ * Write the drums that were hit and released to the OPL. Register BD is written once, unless a drum is hit while it is
+ * still held. Such a drum has to be released first to sound again.
+ *
+ * @param releases - Drum bits of the drums to release.
+ */
+void Rhythm::writeDrums(byte releases) {
+	byte value = opl2->getChipRegister(0xBD);
+	byte keyed = value & ~releases;
+
+	if (triggers != 0) {
+		for (byte i = 0; i < NUM_DRUM_SOUNDS; i ++) {
+			if ((triggers & drumBits[i]) && drums[i].instrumentChanged) {
+				opl2->setDrumInstrument(drums[i].instrument, i, drums[i].volume);
+				drums[i].instrumentChanged = false;
+			}
+		}
+
+		for (byte i = 0; i < RHYTHM_NUM_CHANNELS; i ++) {
+			writePitch(i, keyed & 0x1F);
+		}
+
+		if (keyed & triggers) {
+			keyed &= ~triggers;
+			value = keyed;
+			opl2->setChipRegister(0xBD, value);
+		}
+
+		unsigned long releaseTime = micros() + gateTime * 1000UL;
+		for (byte i = 0; i < NUM_DRUM_SOUNDS; i ++) {
+			if (triggers & drumBits[i]) {
+				drums[i].releaseTime = releaseTime;
+			}
+		}
+	}
+
+	if ((keyed | triggers) != value) {
+		opl2->setChipRegister(0xBD, keyed | triggers);
+	}
+	triggers = 0;
+	numTriggers = 0;
+}
+
+
+/**
+ * Set the pitch of a drum channel for the drums that are hit. When both drums of a shared channel are hit the pitch
+ * policy decides which drum sets the pitch.
+ *
+ * @param index - Index of the drum channel [0, 2].
+ * @param keyedDrums - Drum bits of the drums that stay held.
+ */
+void Rhythm::writePitch(byte index, byte keyedDrums) {
+	byte tonalDrum = channelDrums[index][0];
+	byte noiseDrum = channelDrums[index][1];
+	bool tonalHit = triggers & drumBits[tonalDrum];
+	bool noiseHit = triggers & drumBits[noiseDrum];
+
+	byte drum;
+	if (tonalHit && noiseHit) {
+		bool noiseLast = drums[noiseDrum].order > drums[tonalDrum].order;
+		drum = pitchPolicy == RHYTHM_PITCH_LAST && noiseLast ? noiseDrum : tonalDrum;
+	} else if (tonalHit || noiseHit) {
+		drum = tonalHit ? tonalDrum : noiseDrum;
+		byte partner = tonalHit ? noiseDrum : tonalDrum;
+		if (pitchPolicy == RHYTHM_PITCH_HOLD && (keyedDrums & drumBits[partner])) {
+			return;
+		}
+	} else {
+		return;
+	}
+
+	if (drums[drum].fNumber != 0) {
+		opl2->setPitch(RHYTHM_FIRST_CHANNEL + index, drums[drum].block, drums[drum].fNumber);
+	}
+}
@@ -0,0 +1,69 @@
+#include "OPL2.h"
+
+#ifndef RHYTHM_H_
+	#define RHYTHM_H_
+
+	#define RHYTHM_GATE_TIME      50		// Default time in ms before a drum is released.
+	#define RHYTHM_NUM_CHANNELS    3		// Channels 6, 7 and 8 are used by the drums.
+	#define RHYTHM_FIRST_CHANNEL   6
+	#define RHYTHM_NO_RELEASE      0xFFFFFFFF	// Returned by update when drums are held until they are released.
+
+	// Policies that decide the pitch of a channel that is shared by two drums.
+	#define RHYTHM_PITCH_LAST      0		// The drum that was triggered last sets the pitch.
+	#define RHYTHM_PITCH_TONAL     1		// The snare and tom set the pitch over the hi-hat and cymbal.
+	#define RHYTHM_PITCH_HOLD      2		// Like tonal, but a drum that is still sounding keeps its pitch.
+
+
+	/**
+	 * Instrument and pitch of a drum. Instruments are only written to the OPL when the drum is triggered, so setting the
+	 * same instrument again costs nothing.
+	 */
+	typedef struct RhythmDrum {
+		Instrument instrument;
+		float volume;
+		bool instrumentChanged;			// The instrument must be written before the next hit.
+		byte block;						// Block of the next hit.
+		short fNumber;					// F-number of the next hit.
+		byte order;						// Order in which the drum was triggered in the current tick.
+		unsigned long releaseTime;		// Time in us at which the drum is released.
+	} RhythmDrum;
+
+
+	class Rhythm {
+		public:
+			Rhythm(OPL2* opl2Ref);
+			void begin();
+			void setInstrument(byte drum, Instrument instrument, float volume = 1.0);
+			void setPitchPolicy(byte policy);
+			byte getPitchPolicy();
+			void setGateTime(unsigned int gateTime);
+			unsigned int getGateTime();
+			void trigger(byte drum);
+			void trigger(byte drum, byte octave, byte note);
+			void release(byte drum);
+			void flush();
+			unsigned long update();
+
+		private:
+			void writeDrums(byte releases);
+			void writePitch(byte index, byte keyedDrums);
+
+			OPL2* opl2 = NULL;
+			byte pitchPolicy = RHYTHM_PITCH_TONAL;
+			unsigned int gateTime = RHYTHM_GATE_TIME;
+			byte triggers = 0;					// Drum bits that are triggered by the next flush.
+			byte numTriggers = 0;				// Number of triggers since the last flush.
+
+			RhythmDrum drums[NUM_DRUM_SOUNDS];
+
+			// The tonal drum of each drum channel first, followed by the noise drum that shares the channel.
+			const byte channelDrums[RHYTHM_NUM_CHANNELS][2] = {
+				{ DRUM_BASS,  DRUM_BASS   },
+				{ DRUM_SNARE, DRUM_HI_HAT },
+				{ DRUM_TOM,   DRUM_CYMBAL }
+			};
+			const byte drumBits[NUM_DRUM_SOUNDS] = {
+				DRUM_BITS_BASS, DRUM_BITS_SNARE, DRUM_BITS_TOM, DRUM_BITS_CYMBAL, DRUM_BITS_HI_HAT
+			};
+	};
+#endif
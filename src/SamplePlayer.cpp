@@ -0,0 +1,392 @@
+/**
+ * Plays 8-bit digitized samples on an OPL channel. The carrier of the channel plays a very low sine that is frozen at
+ * its peak by setting the F-number to 0, so the channel outputs a constant level. Changing the output level of the
+ * carrier then changes the output of the channel like a DAC. Each sample is converted into an output level through a
+ * lookup table, so the amplitude follows the sample linearly.
+ *
+ * Every sample takes one register write. After the output level register has been selected once each sample only
+ * needs the data part of a register write, which is about four times faster on the OPL2. Samples are played from timer
+ * 2 on AVR boards, for which the sketch must add SAMPLEPLAYER_TIMER_ISR, and from a thread on the Raspberry Pi. On other
+ * boards they are played by update. Samples are streamed through two buffers, where one buffer is played while update
+ * fills the other.
+ */
+
+#include "SamplePlayer.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+	#include <time.h>
+#endif
+
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+	// Prescaler of timer 2 for each clock select value 1 - 7.
+	static const unsigned int timerPrescalers[7] = { 1, 8, 32, 64, 128, 256, 1024 };
+#endif
+
+
+/**
+ * Create a sample player that plays samples on the given channel.
+ *
+ * @param opl2Ref - Reference to the OPL2, OPL3 or OPL3Duo instance to play samples on.
+ * @param channel - The channel that plays the samples.
+ */
+SamplePlayer::SamplePlayer(OPL2* opl2Ref, byte channel) {
+	opl2 = opl2Ref;
+	this->channel = channel;
+
+	for (byte i = 0; i < 2; i ++) {
+		bufferLengths[i] = 0;
+		bufferFull[i] = false;
+	}
+}
+
+
+/**
+ * Set up the channel to output a constant level. The carrier is keyed on with a 5 Hz sine and stopped when it reaches
+ * its peak, so this takes about 50 ms. Call begin once after the OPL has been initialized and again when the channel
+ * has been used for something else.
+ */
+void SamplePlayer::begin() {
+	stop();
+	opl2->setKeyOn(channel, false);
+
+	for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+		opl2->setTremolo(channel, op, false);
+		opl2->setVibrato(channel, op, false);
+		opl2->setMaintainSustain(channel, op, true);
+		opl2->setEnvelopeScaling(channel, op, false);
+		opl2->setMultiplier(channel, op, 1);
+		opl2->setScalingLevel(channel, op, 0);
+		opl2->setAttack(channel, op, 0x0F);
+		opl2->setDecay(channel, op, 0);
+		opl2->setSustain(channel, op, 0);
+		opl2->setRelease(channel, op, 0);
+		opl2->setWaveForm(channel, op, 0);
+	}
+	opl2->setFeedback(channel, 0);
+	opl2->setSynthMode(channel, 0);
+	opl2->setVolume(channel, MODULATOR, 0x3F);
+
+	// Start the carrier at the level of silence, so the output rises to the middle of its range.
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+		opl2->setVolume(channel, CARRIER, pgm_read_byte_near(sampleLevels + SAMPLE_SILENCE));
+	#else
+		opl2->setVolume(channel, CARRIER, sampleLevels[SAMPLE_SILENCE]);
+	#endif
+
+	opl2->setBlock(channel, 0);
+	opl2->setFNumber(channel, SAMPLE_DC_FNUMBER);
+	opl2->setKeyOn(channel, true);
+	delay(SAMPLE_DC_DELAY);
+	opl2->setFNumber(channel, 0);
+}
+
+
+/**
+ * Start playing samples. The first two buffers are filled before playback starts. While samples play in the background
+ * the sketch must not use the OPL or other devices on the SPI bus and should call update to stream the next samples. The
+ * sample reader may use the SPI bus, for example to read from an SD card, because samples are held while it runs.
+ *
+ * @param sampleReader - Callback that reads unsigned 8-bit samples.
+ * @param length - The number of samples to play.
+ * @param sampleRate - The number of samples per second.
+ * @return True if playback has started.
+ */
+bool SamplePlayer::play(SampleReader sampleReader, unsigned long length, unsigned int sampleRate) {
+	stop();
+	if (sampleReader == NULL || length == 0 || sampleRate == 0) {
+		return false;
+	}
+
+	reader = sampleReader;
+	this->length = length;
+	readOffset = 0;
+	endOfData = false;
+	bufferFull[0] = bufferFull[1] = false;
+	playBuffer = 0;
+	playIndex = 0;
+	position = 0;
+	underruns = 0;
+	ticks = 0;
+
+	fillBuffer(0);
+	fillBuffer(1);
+	if (!bufferFull[0]) {
+		return false;
+	}
+
+	// Select the output level register of the carrier, so each sample only takes a data write.
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+		opl2->setVolume(channel, CARRIER, pgm_read_byte_near(sampleLevels + SAMPLE_SILENCE));
+	#else
+		opl2->setVolume(channel, CARRIER, sampleLevels[SAMPLE_SILENCE]);
+	#endif
+
+	playing = true;
+	startTime = micros();
+
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+		this->sampleRate = sampleRate;
+		if (pthread_create(&thread, NULL, playbackThread, this) != 0) {
+			playing = false;
+			return false;
+		}
+		threadStarted = true;
+	#elif defined(__AVR__)
+		// Use the smallest prescaler for which the timer can count a whole sample period.
+		unsigned long counts = F_CPU / sampleRate;
+		byte clockSelect = 0;
+		while (clockSelect < 6 && counts / timerPrescalers[clockSelect] > 256) {
+			clockSelect ++;
+		}
+		unsigned int top = counts / timerPrescalers[clockSelect];
+		top = top < 2 ? 2 : top > 256 ? 256 : top;
+		this->sampleRate = F_CPU / ((unsigned long)timerPrescalers[clockSelect] * top);
+
+		noInterrupts();
+		TCCR2A = _BV(WGM21);				// Clear timer on compare match.
+		TCCR2B = clockSelect + 1;
+		OCR2A = top - 1;
+		TCNT2 = 0;
+		TIFR2 = _BV(OCF2A);
+		TIMSK2 |= _BV(OCIE2A);
+		interrupts();
+	#else
+		this->sampleRate = sampleRate;
+	#endif
+
+	return true;
+}
+
+
+/**
+ * Stop playing samples and return the output to the level of silence.
+ */
+void SamplePlayer::stop() {
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+		playing = false;
+		if (threadStarted) {
+			pthread_join(thread, NULL);
+			threadStarted = false;
+		}
+	#elif defined(__AVR__)
+		TIMSK2 &= ~_BV(OCIE2A);
+	#endif
+
+	if (playing) {
+		playing = false;
+		writeSample(SAMPLE_SILENCE);
+	}
+}
+
+
+/**
+ * Are samples being played?
+ *
+ * @return True until all samples have been played or playback is stopped.
+ */
+bool SamplePlayer::isPlaying() {
+	return playing;
+}
+
+
+/**
+ * Fill the buffers that have been played with the next samples. On boards without a timer for the player this also
+ * plays the samples that are due, so call update as often as possible while samples play.
+ */
+void SamplePlayer::update() {
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && !defined(__AVR__)
+		runPlayback();
+	#endif
+
+	// The buffer that is being played is filled first when it ran empty.
+	byte first = playBuffer;
+	if (!bufferFull[first]) {
+		fillBuffer(first);
+	}
+	if (!bufferFull[first ^ 1]) {
+		fillBuffer(first ^ 1);
+	}
+}
+
+
+/**
+ * Get the number of samples that have been played.
+ *
+ * @return Number of samples played since playback started.
+ */
+unsigned long SamplePlayer::getPosition() {
+	#if defined(__AVR__)
+		noInterrupts();
+		unsigned long samples = position;
+		interrupts();
+		return samples;
+	#else
+		return position;
+	#endif
+}
+
+
+/**
+ * Get the sample rate of playback. On AVR boards this is the closest rate the timer can make to the requested rate.
+ *
+ * @return The number of samples per second.
+ */
+unsigned long SamplePlayer::getSampleRate() {
+	return sampleRate;
+}
+
+
+/**
+ * Get the number of sample periods in which no sample could be played because update did not fill a buffer in time.
+ *
+ * @return The number of underruns since playback started.
+ */
+unsigned int SamplePlayer::getUnderruns() {
+	return underruns;
+}
+
+
+/**
+ * Output a sample. This only writes the data of the output level register, so the register must have been selected by
+ * the last register write.
+ *
+ * @param sample - Unsigned 8-bit sample.
+ */
+void SamplePlayer::writeSample(byte sample) {
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+		opl2->writeData(pgm_read_byte_near(sampleLevels + sample));
+	#else
+		opl2->writeData(sampleLevels[sample]);
+	#endif
+}
+
+
+/**
+ * Play the next sample from the buffers. This is called once per sample period by the timer interrupt, thread or
+ * update. When the buffer to play is not filled yet the previous sample is held.
+ *
+ * @return True while there are samples left to play.
+ */
+bool SamplePlayer::playSample() {
+	if (!playing) {
+		return false;
+	}
+
+	byte buffer = playBuffer;
+	if (!bufferFull[buffer]) {
+		if (endOfData) {
+			playing = false;
+			writeSample(SAMPLE_SILENCE);
+			return false;
+		}
+		underruns ++;
+		return true;
+	}
+
+	writeSample(buffers[buffer][playIndex]);
+	position ++;
+	if (++ playIndex >= bufferLengths[buffer]) {
+		playIndex = 0;
+		bufferFull[buffer] = false;
+		playBuffer = buffer ^ 1;
+	}
+	return true;
+}
+
+
+/**
+ * Play all samples that are due according to the sample rate. When playback falls behind by more than a buffer the
+ * missed sample periods are skipped.
+ *
+ * @return The number of us until the next sample is due.
+ */
+unsigned long SamplePlayer::runPlayback() {
+	while (playing) {
+		unsigned long dueTime = startTime + (unsigned long)((unsigned long long)ticks * 1000000 / sampleRate);
+		long wait = (long)(dueTime - micros());
+		if (wait > 0) {
+			return wait;
+		}
+
+		if (-wait > (long)(SAMPLE_BUFFER_SIZE * 1000000ULL / sampleRate)) {
+			startTime = micros();
+			ticks = 0;
+		}
+		playSample();
+		ticks ++;
+	}
+	return 0;
+}
+
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+	/**
+	 * Play the next sample from the timer 2 compare interrupt that is added to the sketch with SAMPLEPLAYER_TIMER_ISR.
+	 * The interrupt disables itself when the last sample has been played.
+	 */
+	void SamplePlayer::runTimer() {
+		if (!playSample()) {
+			TIMSK2 &= ~_BV(OCIE2A);
+		}
+	}
+#endif
+
+
+/**
+ * Read the next samples into a buffer. When there are no samples left the buffer stays empty and playback ends after
+ * the other buffer has been played. On AVR boards the reader usually reads from an SD card on the same SPI bus as the
+ * OPL, so the timer interrupt is held off while the reader runs and the current sample is held a little longer.
+ *
+ * @param index - The buffer to fill [0, 1].
+ */
+void SamplePlayer::fillBuffer(byte index) {
+	if (readOffset >= length) {
+		endOfData = true;
+		return;
+	}
+
+	unsigned long remaining = length - readOffset;
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+		byte timerMask = TIMSK2 & _BV(OCIE2A);
+		TIMSK2 &= ~_BV(OCIE2A);
+		int samples = reader(readOffset, buffers[index], remaining < SAMPLE_BUFFER_SIZE ? remaining : SAMPLE_BUFFER_SIZE);
+		TIMSK2 |= timerMask;
+	#else
+		int samples = reader(readOffset, buffers[index], remaining < SAMPLE_BUFFER_SIZE ? remaining : SAMPLE_BUFFER_SIZE);
+	#endif
+	if (samples <= 0) {
+		endOfData = true;
+		return;
+	}
+
+	readOffset += samples;
+	bufferLengths[index] = samples;
+	bufferFull[index] = true;
+}
+
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+	/**
+	 * Thread that plays the samples. It sleeps until shortly before the next sample is due and waits the last part
+	 * actively, because sleeping is not accurate enough for sample periods of less than 100 us.
+	 *
+	 * @param player - The SamplePlayer that plays the samples.
+	 */
+	void* SamplePlayer::playbackThread(void* player) {
+		SamplePlayer* samplePlayer = (SamplePlayer*)player;
+
+		while (samplePlayer->playing) {
+			unsigned long wait = samplePlayer->runPlayback();
+			if (wait > 200) {
+				struct timespec sleepTime = { 0, (long)(wait - 100) * 1000 };
+				nanosleep(&sleepTime, NULL);
+			}
+		}
+
+		return NULL;
+	}
+#endif
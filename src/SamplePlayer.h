@@ -0,0 +1,107 @@
+#include "OPL2.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+	#include <pthread.h>
+#endif
+
+#ifndef SAMPLE_PLAYER_H_
+	#define SAMPLE_PLAYER_H_
+
+	// Samples are streamed through two buffers of this size. One buffer is played while the other is filled by update.
+	#if defined(__AVR__)
+		#define SAMPLE_BUFFER_SIZE   128
+	#else
+		#define SAMPLE_BUFFER_SIZE  1024
+	#endif
+
+	// The carrier plays a 5 Hz sine that is stopped at its peak after a quarter period to get a constant output.
+	#define SAMPLE_DC_FNUMBER    105
+	#define SAMPLE_DC_DELAY       50		// Quarter period of the sine in ms.
+	#define SAMPLE_SILENCE      0x80		// Sample that is output when no sample is playing.
+
+	// On AVR boards samples are played from timer 2. The library does not claim the timer itself, so tone() keeps
+	// working. A sketch that plays samples adds SAMPLEPLAYER_TIMER_ISR(samplePlayer) once, outside of any function. On
+	// other boards this adds nothing.
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+		#define SAMPLEPLAYER_TIMER_ISR(player) ISR(TIMER2_COMPA_vect) { (player).runTimer(); }
+	#else
+		#define SAMPLEPLAYER_TIMER_ISR(player)
+	#endif
+
+
+	/**
+	 * Callback used to read samples. It must read length unsigned 8-bit samples at the given offset into buffer and
+	 * return the number of samples that were read.
+	 */
+	typedef int (*SampleReader)(unsigned long offset, byte *buffer, unsigned int length);
+
+
+	// Output level of the carrier for each unsigned 8-bit sample, so the amplitude of the output follows the sample
+	// linearly. Each output level step attenuates the output by 0.75 dB.
+	const byte sampleLevels[256] PROGMEM = {
+		63, 63, 56, 51, 48, 46, 43, 42, 40, 39, 38, 36, 35, 34, 34, 33,
+		32, 31, 31, 30, 29, 29, 28, 28, 27, 27, 26, 26, 26, 25, 25, 24,
+		24, 24, 23, 23, 23, 22, 22, 22, 21, 21, 21, 21, 20, 20, 20, 20,
+		19, 19, 19, 19, 18, 18, 18, 18, 18, 17, 17, 17, 17, 17, 16, 16,
+		16, 16, 16, 15, 15, 15, 15, 15, 15, 14, 14, 14, 14, 14, 14, 14,
+		13, 13, 13, 13, 13, 13, 13, 12, 12, 12, 12, 12, 12, 12, 12, 11,
+		11, 11, 11, 11, 11, 11, 11, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+		10,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  8,  8,  8,  8,  8,
+		 8,  8,  8,  8,  8,  8,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+		 7,  7,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  5,
+		 5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  4,  4,  4,
+		 4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  3,  3,  3,
+		 3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  2,  2,
+		 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+		 2,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+		 1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+	};
+
+
+	class SamplePlayer {
+		public:
+			SamplePlayer(OPL2* opl2Ref, byte channel = 0);
+			void begin();
+			bool play(SampleReader sampleReader, unsigned long length, unsigned int sampleRate);
+			void stop();
+			bool isPlaying();
+			void update();
+			unsigned long getPosition();
+			unsigned long getSampleRate();
+			unsigned int getUnderruns();
+			void writeSample(byte sample);
+			bool playSample();
+			unsigned long runPlayback();
+			#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+				void runTimer();
+			#endif
+
+		private:
+			void fillBuffer(byte index);
+
+			OPL2* opl2 = NULL;
+			byte channel = 0;
+			SampleReader reader = NULL;
+			unsigned long length = 0;				// Number of samples to play.
+			unsigned long readOffset = 0;			// Offset of the next sample to read into a buffer.
+			unsigned long sampleRate = 0;			// Sample rate that is actually achieved by the timer.
+
+			byte buffers[2][SAMPLE_BUFFER_SIZE];
+			unsigned int bufferLengths[2];			// Number of samples in each buffer.
+			volatile bool bufferFull[2];			// Buffer is filled and waiting to be played.
+			volatile bool endOfData = false;		// All samples have been read into the buffers.
+			volatile byte playBuffer = 0;			// Buffer that is being played.
+			volatile unsigned int playIndex = 0;	// Next sample to play from the play buffer.
+			volatile unsigned long position = 0;	// Number of samples played.
+			volatile unsigned int underruns = 0;	// Number of samples that were late because no buffer was filled.
+			volatile bool playing = false;
+			unsigned long startTime = 0;			// Time in us at which playback started.
+			unsigned long ticks = 0;				// Number of sample periods since playback started.
+
+			#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+				static void* playbackThread(void* player);
+				pthread_t thread;
+				bool threadStarted = false;
+			#endif
+	};
+#endif
@@ -1,13 +1,63 @@
 #include "TuneParser.h"
 
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+	#include <Arduino.h>
+#else
+	#include <wiringPi.h>
+	#include <time.h>
+#endif
+
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+	#define TP_TIMER_US_PER_COUNT (64000000UL / F_CPU)		// Timer 1 runs at the CPU clock / 64.
+#endif
+
 
 /**
- * TuneParser constructor.
+ * Create a TuneParser that plays 2-OP instruments on an OPL2. The sketch must include midi_instruments.h.
  *
- * @param opl3Ref - Reference to the OPL3Duo instance used for playback.
+ * @param opl2Ref - Reference to the OPL2 instance used for playback.
  */
-TuneParser::TuneParser(OPL3Duo* opl3Ref) {
+TuneParser::TuneParser(OPL2* opl2Ref) {
+	opl2 = opl2Ref;
+	is4OP = false;
+	initChannels();
+}
+
+
+/**
+ * Create a TuneParser that plays on an OPL3 or OPL3 Duo. By default 4-OP instruments are played and the sketch must
+ * include midi_instruments_4op.h. Otherwise all 2-OP channels are used and the sketch must include midi_instruments.h.
+ *
+ * @param opl3Ref - Reference to the OPL3 or OPL3Duo instance used for playback.
+ * @param use4OP - Play 4-OP instruments.
+ */
+TuneParser::TuneParser(OPL3* opl3Ref, bool use4OP) {
+	opl2 = opl3Ref;
 	opl3 = opl3Ref;
+	is4OP = use4OP;
+	initChannels();
+}
+
+
+/**
+ * Initialize the channel administration.
+ */
+void TuneParser::initChannels() {
+	numChannels = is4OP ? opl3->getNum4OPChannels() : opl2->getNumChannels();
+	if (numChannels > TP_MAX_CHANNELS) {
+		numChannels = TP_MAX_CHANNELS;
+	}
+
+	for (byte i = 0; i < TP_MAX_CHANNELS; i ++) {
+		channels[i].tuneId = TP_NO_TUNE;
+		channels[i].reservedBy = TP_NO_TUNE;
+		channels[i].program = TP_NO_PROGRAM;
+		channels[i].savedState = TP_NO_STATE;
+	}
+	for (byte i = 0; i < TP_NUM_SAVED_STATES; i ++) {
+		savedStates[i].tuneId = TP_NO_TUNE;
+	}
 }
 
 
@@ -15,9 +65,16 @@ TuneParser::TuneParser(OPL3Duo* opl3Ref) {
  * Initialize the TuneParser.
  */
 void TuneParser::begin() {
-	opl3->begin();
-	opl3->setOPL3Enabled(true);
-	opl3->setAll4OPChannelsEnabled(true);
+	opl2->begin();
+	if (opl3 != NULL) {
+		opl3->setOPL3Enabled(true);
+		opl3->setAll4OPChannelsEnabled(is4OP);
+	}
+
+	// The chip has been reset, so instruments need to be loaded again.
+	for (byte i = 0; i < TP_MAX_CHANNELS; i ++) {
+		channels[i].program = TP_NO_PROGRAM;
+	}
 }
 
 
@@ -28,8 +85,7 @@ void TuneParser::begin() {
  */
 void TuneParser::play(const char* voice0) {
 	const char* voices[6] = { voice0, NULL, NULL, NULL, NULL, NULL };
-	Tune tune = createTune(voices, 1);
-	playTune(tune);
+	playVoices(voices, 1);
 }
 
 
@@ -41,8 +97,7 @@ void TuneParser::play(const char* voice0) {
  */
 void TuneParser::play(const char* voice0, const char* voice1) {
 	const char* voices[6] = { voice0, voice1, NULL, NULL, NULL, NULL };
-	Tune tune = createTune(voices, 2);
-	playTune(tune);
+	playVoices(voices, 2);
 }
 
 
@@ -55,8 +110,7 @@ void TuneParser::play(const char* voice0, const char* voice1) {
  */
 void TuneParser::play(const char* voice0, const char* voice1, const char* voice2) {
 	const char* voices[6] = { voice0, voice1, voice2, NULL, NULL, NULL };
-	Tune tune = createTune(voices, 3);
-	playTune(tune);
+	playVoices(voices, 3);
 }
 
 
@@ -70,8 +124,7 @@ void TuneParser::play(const char* voice0, const char* voice1, const char* voice2
  */
 void TuneParser::play(const char* voice0, const char* voice1, const char* voice2, const char* voice3) {
 	const char* voices[6] = { voice0, voice1, voice2, voice3, NULL, NULL };
-	Tune tune = createTune(voices, 4);
-	playTune(tune);
+	playVoices(voices, 4);
 }
 
 
@@ -86,8 +139,7 @@ void TuneParser::play(const char* voice0, const char* voice1, const char* voice2
  */
 void TuneParser::play(const char* voice0, const char* voice1, const char* voice2, const char* voice3, const char* voice4) {
 	const char* voices[6] = { voice0, voice1, voice2, voice3, voice4, NULL };
-	Tune tune = createTune(voices, 5);
-	playTune(tune);
+	playVoices(voices, 5);
 }
 
 
@@ -103,8 +155,7 @@ void TuneParser::play(const char* voice0, const char* voice1, const char* voice2
  */
 void TuneParser::play(const char* voice0, const char* voice1, const char* voice2, const char* voice3, const char* voice4, const char* voice5) {
 	const char* voices[6] = { voice0, voice1, voice2, voice3, voice4, voice5 };
-	Tune tune = createTune(voices, 6);
-	playTune(tune);
+	playVoices(voices, 6);
 }
 
 
@@ -196,17 +247,35 @@ Tune TuneParser::playBackground(const char* voice0, const char* voice1, const ch
 
 
 /**
- * Create a Tune structure from the given array of command strings.
+ * Create a Tune structure from the given array of command strings. The command strings are compiled into the code buffer
+ * of the TuneParser after the tunes that were created before. Tunes that were created before may still be playing, so
+ * when the new tune doesn't fit in the code buffer it is not created. Call clearTunes to make room for new tunes.
  *
  * @param voices - Array of command strings for each voice.
  * @param numVoices - The number of voices that is in use.
+ * @return The tune, or a tune without voices and with id TP_NO_TUNE when it doesn't fit in the code buffer.
  */
-Tune TuneParser::createTune(const char* voices[6], int numVoices) {
+Tune TuneParser::createTune(const char* voices[], int numVoices) {
 	Tune tune;
+	tune.priority = 0;
+	tune.numVoices = numVoices < TP_MAX_VOICES ? numVoices : TP_MAX_VOICES;
 
-	tune.numVoices = min(numVoices, 6);
+	unsigned int tuneLength = 0;
 	for (byte i = 0; i < tune.numVoices; i ++) {
-		tune.voice[i].pattern = voices[i];
+		tuneLength += compile(voices[i], NULL, TP_CODE_SIZE);
+	}
+	if (codeLength + tuneLength > TP_CODE_SIZE) {
+		tune.id = TP_NO_TUNE;
+		tune.numVoices = 0;
+		restartTune(tune);
+		return tune;
+	}
+
+	tune.id = nextTuneId = nextTuneId % 254 + 1;
+	for (byte i = 0; i < tune.numVoices; i ++) {
+		tune.voice[i].start = codeLength;
+		codeLength += compile(voices[i], code + codeLength, TP_CODE_SIZE - codeLength);
+		tune.voice[i].channel = TP_NO_CHANNEL;
 	}
 
 	restartTune(tune);
@@ -216,24 +285,115 @@ Tune TuneParser::createTune(const char* voices[6], int numVoices) {
 
 
 /**
- * Restart the given background tune.
+ * Remove all tunes from the code buffer to make room for new tunes. Subroutines are kept. Tunes that were created before
+ * are no longer valid and must be stopped first.
+ */
+void TuneParser::clearTunes() {
+	codeLength = codeBase;
+}
+
+
+/**
+ * Create a tune from the given command strings and play it. The compiled tune is removed from the code buffer
+ * afterwards.
+ *
+ * @param voices - Array of command strings for each voice.
+ * @param numVoices - The number of voices that is in use.
+ */
+void TuneParser::playVoices(const char* voices[], int numVoices) {
+	unsigned int codeStart = codeLength;
+	Tune tune = createTune(voices, numVoices);
+	playTune(tune);
+	codeLength = codeStart;
+}
+
+
+/**
+ * Restart the given background tune. Notes that the tune is still playing are stopped.
  *
  * @param tune - The tune to restart.
  */
 void TuneParser::restartTune(Tune& tune) {
+	for (byte i = 0; i < tune.numVoices; i ++) {
+		releaseVoice(tune, i);
+	}
+
 	tune.numEnded = 0;
-	tune.tickDuration = 60000 / (100 * 16);		// duration of a 64th note @ 100 bmp.
-	tune.nextTick = millis();
+	setTempo(tune, 100);
+	tune.nextTick = micros();
 
 	for (byte i = 0; i < tune.numVoices; i ++) {
 		tune.voice[i].ended = false;
-		tune.voice[i].position = 0;
+		tune.voice[i].position = tune.voice[i].start;
 		tune.voice[i].ticks = 1;
-		tune.voice[i].octave = 4;
-		tune.voice[i].volume = 0.8;
-		tune.voice[i].instrument = opl3->loadInstrument4OP(midiInstruments[0]);
-		tune.voice[i].defaultNoteLength = 16;
-		tune.voice[i].channel = tune.numVoices;
+		tune.voice[i].noteLength = 16;
+		tune.voice[i].defaultLength = 16;
+		tune.voice[i].transpose = 0;
+		tune.voice[i].instrument = 0;
+		tune.voice[i].volume = getAttenuation(0.8);
+		tune.voice[i].stackDepth = 0;
+	}
+}
+
+
+/**
+ * Stop the given tune. Notes that it is playing are released and channels that the tune has stolen are given back.
+ *
+ * @param tune - The tune to stop.
+ */
+void TuneParser::stopTune(Tune& tune) {
+	for (byte i = 0; i < tune.numVoices; i ++) {
+		releaseVoice(tune, i);
+		tune.voice[i].ended = true;
+	}
+	tune.numEnded = tune.numVoices;
+}
+
+
+/**
+ * Set the priority of the given tune. When no channel is free a tune steals the channel of a tune with a lower priority.
+ * The stolen note is given back when the note that replaced it ends, if it is still playing by then. This way short
+ * sound effects can be played over music with a higher priority than the music.
+ *
+ * @param tune - The tune to change.
+ * @param priority - Priority of the tune, 0 by default.
+ */
+void TuneParser::setPriority(Tune& tune, byte priority) {
+	tune.priority = priority;
+}
+
+
+/**
+ * Reserve a channel for the given tune. Other tunes will not play on a reserved channel, whatever their priority. The
+ * tune prefers its reserved channels over other free channels.
+ *
+ * @param tune - The tune to reserve the channel for.
+ * @param channelNum - The 4-OP channel, or the 2-OP channel when playing 2-OP instruments, to reserve.
+ * @return True if the channel is reserved or false if it is reserved by another tune or doesn't exist.
+ */
+bool TuneParser::reserveChannel(Tune& tune, byte channelNum) {
+	if (channelNum >= numChannels) {
+		return false;
+	}
+	if (channels[channelNum].reservedBy != TP_NO_TUNE && channels[channelNum].reservedBy != tune.id) {
+		return false;
+	}
+
+	channels[channelNum].reservedBy = tune.id;
+	return true;
+}
+
+
+/**
+ * Remove all channel reservations of the given tune.
+ *
+ * @param tune - The tune of which to remove the reservations.
+ */
+void TuneParser::clearReservations(Tune& tune) {
+	for (byte i = 0; i < numChannels; i ++) {
+		if (channels[i].reservedBy == tune.id) {
+			channels[i].reservedBy = TP_NO_TUNE;
+		}
 	}
 }
 
@@ -270,26 +430,36 @@ void TuneParser::playTune(Tune& tune) {
  * @return The number of ms to wait until the next tick.
  */
 unsigned long TuneParser::update(Tune& tune) {
+	return updateTick(tune) / 1000;
+}
+
+
+/**
+ * Process the next tick of the given tune when it is due. Ticks are scheduled relative to the previous tick, so the time
+ * it takes to process a tick doesn't add up. When the tune falls behind more than a tick, because update wasn't called
+ * in time, it continues from the current time instead of rushing through the missed ticks.
+ *
+ * @param tune - The tune to update.
+ * @return The number of us to wait until the next tick, never negative.
+ */
+long TuneParser::updateTick(Tune& tune) {
 	// Return immediately if it's not yet time to process the next tick.
-	if (millis() < tune.nextTick) {
-		return tune.nextTick - millis();
+	long wait = (long)(tune.nextTick - micros());
+	if (wait > 0) {
+		return wait;
 	}
 
-	tune.nextTick = millis();
-	unsigned long t = millis();
-
 	for (byte i = 0; i < tune.numVoices; i ++) {
 		if (!tune.voice[i].ended) {
 			tune.voice[i].ticks --;
 
 			if (tune.voice[i].ticks == 0) {
-				opl3->setKeyOn(opl3->get4OPControlChannel(tune.voice[i].channel), false);
-				channelInUse[tune.voice[i].channel] = false;
+				releaseVoice(tune, i);
 
-				// Parse commands until we find a note, a rest or the end of the tune for this voice.
+				// Run commands until we find a note, a rest or the end of the tune for this voice.
 				bool playingNote = false;
 				while (!playingNote) {
-					playingNote = parseTuneCommand(tune, i);
+					playingNote = runTuneCommand(tune, i);
 				}
 
 				if (tune.voice[i].ended) {
@@ -299,249 +469,1027 @@ unsigned long TuneParser::update(Tune& tune) {
 		}
 	}
 
-	// Calculate time of next tick.
-	unsigned long wait = tune.tickDuration - (millis() - t);
-	tune.nextTick += wait;
+	// Calculate time of next tick and add a us whenever the remainders of the tick duration add up to one.
+	unsigned int tickError = tune.tickError + TP_US_PER_TICK_BEAT % tune.tempo;
+	tune.nextTick += tune.tickDuration;
+	if (tickError >= tune.tempo) {
+		tickError -= tune.tempo;
+		tune.nextTick ++;
+	}
+	tune.tickError = tickError;
+
+	unsigned long now = micros();
+	wait = (long)(tune.nextTick - now);
+	if (wait < -(long)tune.tickDuration) {
+		tune.nextTick = now;
+	}
 
-	return wait;
+	return wait > 0 ? wait : 0;
 }
 
 
 /**
- * Parse the next command in the command string of the given tune and voice index and leave the data pointer at the next
- * command.
+ * Set the tempo of the given tune.
  *
- * @param tune - The tune that's being played.
- * @param voiceIndex - The index of the voice that is being parsed/
+ * @param tune - The tune to change.
+ * @param tempo - Tempo in beats per minute.
  */
-bool TuneParser::parseTuneCommand(Tune& tune, byte voiceIndex) {
-	bool isPlaying = false;
-	Voice& voice = tune.voice[voiceIndex];
+void TuneParser::setTempo(Tune& tune, byte tempo) {
+	tune.tempo = tempo;
+	tune.tickError = 0;
+	tune.tickDuration = TP_US_PER_TICK_BEAT / tempo;
+}
+
+
+/**
+ * Play the given tune in the background from a hardware timer, so it keeps time while the sketch is busy with other
+ * things. On AVR boards timer 1 is used, for which the sketch must add TUNEPARSER_TIMER_ISR, and on the Raspberry Pi the
+ * tune is played from a thread. While the tune plays in the background the sketch must not use the OPL3 or other devices
+ * on the SPI bus, and should only check whether the tune has ended. Stop the background tune to make changes to it.
+ *
+ * @param tune - The tune to play. It must remain in memory until it is stopped.
+ * @return True if the tune is playing in the background or false if there is no timer for this board.
+ */
+bool TuneParser::startBackground(Tune& tune) {
+	stopBackground();
+	backgroundTune = &tune;
+
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+		if (pthread_create(&thread, NULL, backgroundThread, this) != 0) {
+			backgroundTune = NULL;
+			return false;
+		}
+		return true;
+	#elif defined(__AVR__)
+		noInterrupts();
+		TCCR1A = 0;
+		TCCR1B = _BV(CS11) | _BV(CS10);		// Normal mode, clock / 64.
+		OCR1A = TCNT1 + 2;
+		TIFR1 = _BV(OCF1A);
+		TIMSK1 |= _BV(OCIE1A);
+		interrupts();
+		return true;
+	#else
+		backgroundTune = NULL;
+		return false;
+	#endif
+}
+
+
+/**
+ * Stop playing the background tune that was started with startBackground. Notes that are playing will keep playing.
+ */
+void TuneParser::stopBackground() {
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+		if (backgroundTune != NULL) {
+			backgroundTune = NULL;
+			pthread_join(thread, NULL);
+		}
+	#elif defined(__AVR__)
+		TIMSK1 &= ~_BV(OCIE1A);
+	#endif
 
-	// Get command character and convert to upper case.
-	char command = pgm_read_byte_near(voice.pattern + voice.position);
-	if (command >= 'a') {
-		command -= 32;
+	backgroundTune = NULL;
+}
+
+
+/**
+ * Process the background tune. This is called by the timer interrupt or thread that was started with startBackground.
+ *
+ * @return The number of us until the next tick is due.
+ */
+unsigned long TuneParser::runBackground() {
+	Tune* tune = backgroundTune;
+	if (tune == NULL) {
+		return TP_US_PER_TICK_BEAT / 100;
 	}
+	return updateTick(*tune);
+}
 
-	switch (command) {
-		// Handle end of tune for this voice.
-		case TUNE_CMD_END: {
-			voice.ended = true;
-			isPlaying = true;
-			break;
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+	/**
+	 * Process the background tune from the timer 1 compare interrupt that is added to the sketch with
+	 * TUNEPARSER_TIMER_ISR. Processing a tick takes a while because of all the register writes, so interrupts are enabled
+	 * again to keep millis, micros and serial running. The compare interrupt itself stays disabled until the tick has
+	 * been processed.
+	 */
+	void TuneParser::runTimer() {
+		TIMSK1 &= ~_BV(OCIE1A);
+		interrupts();
+
+		unsigned int counts = runBackground() / TP_TIMER_US_PER_COUNT;
+
+		noInterrupts();
+		OCR1A = TCNT1 + (counts > 2 ? counts : 2);
+		TIFR1 = _BV(OCF1A);
+		TIMSK1 |= _BV(OCIE1A);
+	}
+#endif
+
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+	/**
+	 * Thread that plays the background tune and sleeps until the next tick is due.
+	 *
+	 * @param parser - The TuneParser that plays the tune.
+	 */
+	void* TuneParser::backgroundThread(void* parser) {
+		TuneParser* tuneParser = (TuneParser*)parser;
+
+		while (tuneParser->backgroundTune != NULL) {
+			unsigned long wait = tuneParser->runBackground();
+			struct timespec sleepTime = { (time_t)(wait / 1000000), (long)(wait % 1000000) * 1000 };
+			nanosleep(&sleepTime, NULL);
 		}
 
-		// Parse note and cascade into handling rest for note delay.
-		case TUNE_CMD_NOTE_A ... TUNE_CMD_NOTE_G: {
-			parseNote(voice);
+		return NULL;
+	}
+#endif
+
+
+/**
+ * Execute the next compiled command of the given tune and voice index.
+ *
+ * @param tune - The tune that's being played.
+ * @param voiceIndex - The index of the voice that is being played.
+ * @return True if the voice started a note or a rest, or has ended.
+ */
+bool TuneParser::runTuneCommand(Tune& tune, byte voiceIndex) {
+	Voice& voice = tune.voice[voiceIndex];
+	byte op = code[voice.position ++];
+
+	if (op < TP_OP_REST) {
+		int note = op + voice.transpose;
+		while (note < 0) {
+			note += 12;
 		}
+		while (note >= TP_OP_REST) {
+			note -= 12;
+		}
+		playNote(tune, voiceIndex, note);
+		voice.ticks = voice.noteLength;
+		return true;
+	}
+
+	switch (op) {
+		case TP_OP_REST:
+			voice.ticks = voice.noteLength;
+			return true;
 
-		// Handle a rest or pause in the tune.
-		case TUNE_CMD_REST:
-		case TUNE_CMD_PAUSE: {
-			parseRest(voice);
-			isPlaying = true;
+		case TP_OP_LENGTH:
+			voice.noteLength = code[voice.position ++];
 			break;
-		}
 
-		// Handle 'On' to change octave.
-		case TUNE_CMD_OCTAVE: {
-			byte octave = parseNumber(voice, 0, 7);
-			if (octave != TP_NAN) {
-				voice.octave = octave;
-			}
+		case TP_OP_DEFAULT:
+			voice.defaultLength = code[voice.position ++];
 			break;
-		}
 
-		// Handle '>' to increment octave.
-		case TUNE_CMD_OCTAVE_UP: {
-			if (voice.octave < 7) {
-				voice.octave ++;
+		case TP_OP_USE_DEFAULT:
+			voice.noteLength = voice.defaultLength;
+			if (code[voice.position ++]) {
+				voice.noteLength += voice.noteLength / 2;
 			}
 			break;
-		}
 
-		// Handle '<' to decrement octave.
-		case TUNE_CMD_OCTAVE_DOWN: {
-			if (voice.octave > 0) {
-				voice.octave --;
-			}
+		case TP_OP_TRANSPOSE:
+			voice.transpose = (signed char)code[voice.position ++];
 			break;
-		}
 
-		// Handle 'Tnnn' to change sone temop.
-		case TUNE_CMD_TEMPO: {
-			byte tempo = parseNumber(voice, 40, 250);
-			if (tempo != TP_NAN) {
-				tune.tickDuration = 60000 / (tempo * 16);
-			}
+		case TP_OP_INSTRUMENT:
+			voice.instrument = code[voice.position ++];
 			break;
-		}
 
-		// Handle 'Lnn' to change the default note length.
-		case TUNE_CMD_NOTE_LENGTH: {
-			voice.defaultNoteLength = parseNoteLength(voice);
+		case TP_OP_VOLUME:
+			voice.volume = code[voice.position ++];
 			break;
-		}
 
-		// Handle 'Innn' to change the current instrument.
-		case TUNE_CMD_INSTRUMENT: {
-			byte instrumentIndex = parseNumber(voice, 0, 127);
-			if (instrumentIndex != TP_NAN) {
-				voice.instrument = opl3->loadInstrument4OP(midiInstruments[instrumentIndex]);
-			}
+		case TP_OP_TEMPO:
+			setTempo(tune, code[voice.position ++]);
+			break;
+
+		// The compiler makes sure that loops and calls don't nest deeper than the stack.
+		case TP_OP_LOOP:
+			voice.stack[voice.stackDepth].position = voice.position;
+			voice.stack[voice.stackDepth].counter = 0;
+			voice.stackDepth ++;
 			break;
-		}
 
-		// Handle 'Vnn' to change volume.
-		case TUNE_CMD_VOLUME: {
-			byte volume = parseNumber(voice, 0, 15);
-			if (volume != TP_NAN) {
-				voice.volume = (float)volume / 15.0;
+		// Octave changes of the loop carry over to the next pass.
+		case TP_OP_LOOP_END: {
+			TuneStackEntry& loop = voice.stack[voice.stackDepth - 1];
+			byte count = code[voice.position ++];
+			signed char transpose = (signed char)code[voice.position ++];
+			if (++ loop.counter < count) {
+				int shifted = voice.transpose + transpose;
+				voice.position = loop.position;
+				voice.transpose = shifted < -84 ? -84 : shifted > 84 ? 84 : shifted;
+			} else {
+				voice.stackDepth --;
 			}
 			break;
 		}
 
-		// ignore anything else.
-		default:
+		// Subroutines always start in octave 4 with quarter notes.
+		case TP_OP_CALL:
+			voice.stack[voice.stackDepth].position = voice.position + 2;
+			voice.stack[voice.stackDepth].transpose = voice.transpose;
+			voice.stack[voice.stackDepth].defaultLength = voice.defaultLength;
+			voice.stackDepth ++;
+			voice.position = code[voice.position] + (code[voice.position + 1] << 8);
+			voice.transpose = 0;
+			voice.defaultLength = 16;
+			break;
+
+		case TP_OP_RETURN:
+			voice.stackDepth --;
+			voice.position = voice.stack[voice.stackDepth].position;
+			voice.transpose = voice.stack[voice.stackDepth].transpose;
+			voice.defaultLength = voice.stack[voice.stackDepth].defaultLength;
 			break;
+
+		default:
+			voice.ended = true;
+			return true;
+	}
+
+	return false;
+}
+
+
+/**
+ * Play a compiled note on the next free channel. The instrument is only loaded when the channel doesn't have it yet.
+ *
+ * @param tune - The tune that's being played.
+ * @param voiceIndex - The index of the voice that plays the note.
+ * @param note - The note to play as octave * 12 + note.
+ */
+void TuneParser::playNote(Tune& tune, byte voiceIndex, byte note) {
+	Voice& voice = tune.voice[voiceIndex];
+	voice.channel = findChannel(tune);
+	if (voice.channel == TP_NO_CHANNEL) {
+		return;
+	}
+
+	TuneChannel& channel = channels[voice.channel];
+	if (channel.tuneId != TP_NO_TUNE) {
+		stealChannel(voice.channel);
+	}
+
+	// Do some administartion and play the note!
+	channel.tuneId = tune.id;
+	channel.voice = voiceIndex;
+	channel.priority = tune.priority;
+	if (channel.program != voice.instrument) {
+		loadInstrument(voice.channel, voice.instrument);
+		channel.program = voice.instrument;
 	}
 
-	voice.position ++;
-	return isPlaying;
+	if (is4OP && opl3->get4OPChannelVolume(voice.channel) != voice.volume) {
+		opl3->set4OPChannelVolume(voice.channel, voice.volume);
+	} else if (!is4OP && opl2->getChannelVolume(voice.channel) != voice.volume) {
+		opl2->setChannelVolume(voice.channel, voice.volume);
+	}
+	opl2->playNote(getControlChannel(voice.channel), note / 12, note % 12);
 }
 
 
 /**
- * Parse the note found at the current command string position of the given voice and play the note. The duration of the
- * note will be stored with the voice.
+ * Load an instrument on the given channel. The instrument is taken from the instrument bank when one is set and it has
+ * the program, otherwise from midiInstruments.
  *
- * @param voice - The voice from which to extract the note.
+ * @param channelNum - The 4-OP channel, or the 2-OP channel when playing 2-OP instruments.
+ * @param program - The MIDI program of the instrument.
  */
-void TuneParser::parseNote(Voice& voice) {
-	byte noteIndex = pgm_read_byte_near(voice.pattern + voice.position);
-	if (noteIndex >= 'a' && noteIndex <= 'g') {
-		noteIndex = noteIndex - 'a';
-	} else if (noteIndex >= 'A' && noteIndex <= 'G') {
-		noteIndex = noteIndex - 'A';
+void TuneParser::loadInstrument(byte channelNum, byte program) {
+	const byte* data = instrumentBank != NULL ? instrumentBank->getInstrument(program) : NULL;
+	if (data == NULL) {
+		if (is4OP) {
+			opl3->setInstrument4OP(channelNum, opl3->loadInstrument4OP(midiInstruments[program]));
+		} else {
+			opl2->setInstrument(channelNum, opl2->loadInstrument(midiInstruments[program]));
+		}
+	} else if (is4OP) {
+		#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+			opl3->setInstrument4OP(channelNum, opl3->loadInstrument4OP(data, INSTRUMENT_DATA_SRAM));
+		#else
+			opl3->setInstrument4OP(channelNum, opl3->loadInstrument4OP(data));
+		#endif
 	} else {
+		#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+			opl2->setInstrument(channelNum, opl2->loadInstrument(data, INSTRUMENT_DATA_SRAM));
+		#else
+			opl2->setInstrument(channelNum, opl2->loadInstrument(data));
+		#endif
+	}
+}
+
+
+/**
+ * Release the note that the given voice is playing. When the note had stolen the channel from another tune then the
+ * stolen note is restored.
+ *
+ * @param tune - The tune that's being played.
+ * @param voiceIndex - The index of the voice to release.
+ */
+void TuneParser::releaseVoice(Tune& tune, byte voiceIndex) {
+	Voice& voice = tune.voice[voiceIndex];
+	if (voice.channel == TP_NO_CHANNEL) {
 		return;
 	}
 
-	byte octave = voice.octave;
-	byte note = notes[0][noteIndex];
+	TuneChannel& channel = channels[voice.channel];
+	if (channel.tuneId == tune.id && channel.voice == voiceIndex) {
+		opl2->setKeyOn(getControlChannel(voice.channel), false);
+		channel.tuneId = TP_NO_TUNE;
+		if (channel.savedState != TP_NO_STATE) {
+			restoreChannel(voice.channel);
+		}
+	} else if (channel.savedState != TP_NO_STATE) {
+		// The note was stolen and has ended in the mean time, so it no longer needs to be given back.
+		TuneChannelState& state = savedStates[channel.savedState];
+		if (state.tuneId == tune.id && state.voice == voiceIndex) {
+			state.tuneId = TP_NO_TUNE;
+			channel.savedState = TP_NO_STATE;
+		}
+	}
+
+	voice.channel = TP_NO_CHANNEL;
+}
+
+
+/**
+ * Find a channel for the next note of the given tune. Free channels that are reserved for the tune are preferred, then
+ * other free channels and finally the channel of the tune with the lowest priority below the priority of this tune.
+ * Channels are searched round robin so notes can ring out while the next notes are played.
+ *
+ * @param tune - The tune that wants to play a note.
+ * @return The channel to play the note on or TP_NO_CHANNEL if all channels are in use.
+ */
+byte TuneParser::findChannel(Tune& tune) {
+	byte bestChannel = TP_NO_CHANNEL;
+	int bestScore = -1;
+
+	for (byte i = 1; i <= numChannels; i ++) {
+		byte channelNum = (oplChannel + i) % numChannels;
+		TuneChannel& channel = channels[channelNum];
+		if (channel.reservedBy != TP_NO_TUNE && channel.reservedBy != tune.id) {
+			continue;
+		}
 
-	// Handle sharp and flat notes.
-	char sharpFlat = pgm_read_byte_near(voice.pattern + voice.position + 1);
-	if (sharpFlat == TUNE_CMD_NOTE_FLAT) {
-		voice.position ++;
-		note = notes[1][noteIndex];
-		if (note == NOTE_B) {
-			octave = max(octave - 1, 0);
+		int score = -1;
+		if (channel.tuneId == TP_NO_TUNE) {
+			score = channel.reservedBy == tune.id ? 0x201 : 0x200;
+		} else if (channel.priority < tune.priority) {
+			score = 0xFF - channel.priority;
 		}
-	} else if (sharpFlat == TUNE_CMD_NOTE_SHARP || sharpFlat == TUNE_CMD_NOTE_SHARP2) {
-		voice.position ++;
-		note = notes[2][noteIndex];
-		if (note == NOTE_C) {
-			octave = min(octave + 1, 7);
+
+		if (score > bestScore) {
+			bestChannel = channelNum;
+			bestScore = score;
 		}
 	}
 
-	// Find the next free channel to play the note on.
-	for (byte i = 1; i <= TP_NUM_CHANNELS; i ++) {
-		oplChannel4OP = (oplChannel4OP + i) % TP_NUM_CHANNELS;
-		if (!channelInUse[oplChannel4OP]) {
-			break;
+	if (bestChannel != TP_NO_CHANNEL) {
+		oplChannel = bestChannel;
+	}
+	return bestChannel;
+}
+
+
+/**
+ * Get the 2-OP channel that controls the given channel.
+ *
+ * @param channelNum - The 4-OP channel, or the 2-OP channel when playing 2-OP instruments.
+ * @param index - Index [0, 1] of the 2-OP channel of a 4-OP channel.
+ * @return The 2-OP channel.
+ */
+byte TuneParser::getControlChannel(byte channelNum, byte index) {
+	return is4OP ? opl3->get4OPControlChannel(channelNum, index) : channelNum;
+}
+
+
+/**
+ * Take the given channel from the note that is playing on it. The registers of the channel are saved, so the note can
+ * be given back when the new note ends. When the note had already been stolen itself, or when there is no room to save
+ * it, the note is cut short instead.
+ *
+ * @param channelNum - The channel to steal.
+ */
+void TuneParser::stealChannel(byte channelNum) {
+	TuneChannel& channel = channels[channelNum];
+
+	for (byte i = 0; i < TP_NUM_SAVED_STATES && channel.savedState == TP_NO_STATE; i ++) {
+		if (savedStates[i].tuneId == TP_NO_TUNE) {
+			TuneChannelState& state = savedStates[i];
+			state.tuneId = channel.tuneId;
+			state.voice = channel.voice;
+			state.priority = channel.priority;
+			state.program = channel.program;
+
+			byte* registers = state.registers;
+			for (byte j = 0; j < (is4OP ? 2 : 1); j ++) {
+				byte channel2OP = getControlChannel(channelNum, j);
+				for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+					for (byte k = 0; k < 5; k ++) {
+						*registers ++ = opl2->getOperatorRegister(stateOperatorRegisters[k], channel2OP, op);
+					}
+				}
+				for (byte k = 0; k < 3; k ++) {
+					*registers ++ = opl2->getChannelRegister(stateChannelRegisters[k], channel2OP);
+				}
+			}
+			channel.savedState = i;
 		}
 	}
 
-	// Do some administartion and play the note!
-	channelInUse[oplChannel4OP] = true;
-	voice.channel = oplChannel4OP;
-	opl3->setInstrument4OP(oplChannel4OP, voice.instrument);
-	opl3->set4OPChannelVolume(oplChannel4OP, (1.0 - voice.volume) * 63);
-	opl3->playNote(opl3->get4OPControlChannel(oplChannel4OP), octave, note);
+	opl2->setKeyOn(getControlChannel(channelNum), false);
+	channel.tuneId = TP_NO_TUNE;
+}
+
+
+/**
+ * Give a stolen channel back to the note that was playing on it. Only the registers that differ from the saved state are
+ * written, and the key on registers are written last to restart the note.
+ *
+ * @param channelNum - The channel to restore.
+ */
+void TuneParser::restoreChannel(byte channelNum) {
+	TuneChannel& channel = channels[channelNum];
+	TuneChannelState& state = savedStates[channel.savedState];
+
+	const byte* registers = state.registers;
+	for (byte j = 0; j < (is4OP ? 2 : 1); j ++) {
+		byte channel2OP = getControlChannel(channelNum, j);
+		for (byte op = OPERATOR1; op <= OPERATOR2; op ++) {
+			for (byte k = 0; k < 5; k ++, registers ++) {
+				if (opl2->getOperatorRegister(stateOperatorRegisters[k], channel2OP, op) != *registers) {
+					opl2->setOperatorRegister(stateOperatorRegisters[k], channel2OP, op, *registers);
+				}
+			}
+		}
+		for (byte k = 0; k < 3; k ++, registers ++) {
+			if (stateChannelRegisters[k] != 0xB0 && opl2->getChannelRegister(stateChannelRegisters[k], channel2OP) != *registers) {
+				opl2->setChannelRegister(stateChannelRegisters[k], channel2OP, *registers);
+			}
+		}
+	}
+
+	for (byte j = 0; j < (is4OP ? 2 : 1); j ++) {
+		byte channel2OP = getControlChannel(channelNum, j);
+		byte value = state.registers[j * 13 + 12];
+		if (opl2->getChannelRegister(0xB0, channel2OP) != value) {
+			opl2->setChannelRegister(0xB0, channel2OP, value);
+		}
+	}
+
+	channel.tuneId = state.tuneId;
+	channel.voice = state.voice;
+	channel.priority = state.priority;
+	channel.program = state.program;
+	channel.savedState = TP_NO_STATE;
+	state.tuneId = TP_NO_TUNE;
+}
+
+
+/**
+ * Compile a command string into the ops that are executed while the tune plays. Octaves, note lengths, volume and tempo
+ * are resolved while compiling, so the tune only has to step through notes and rests. When the compiled commands don't
+ * fit in the given buffer then the voice is cut short.
+ *
+ * @param pattern - The command string to compile, in PROGMEM on Arduino.
+ * @param code - Buffer that receives the compiled commands or NULL to only determine their length.
+ * @param maxLength - Size of the buffer.
+ * @return The number of bytes of compiled commands, including the end of the voice.
+ */
+unsigned int TuneParser::compile(const char* pattern, byte* code, unsigned int maxLength) {
+	return compilePattern(pattern, code, maxLength, NULL);
+}
+
+
+/**
+ * Compile a command string as a voice or as a subroutine. Loops are compiled into a loop op at the start and a loop end
+ * op with the repeat count at the end of the loop. Octave and length changes in a loop carry over to the next pass, just
+ * like they would when the loop was written out:
+ *  - Notes are compiled for the octave of the first pass. The loop end op holds the octave change of a pass, which is
+ *    added to the transposition of the voice when the loop starts over. Setting the octave with 'O' clears it.
+ *  - Notes without a length use the default length of the voice when it is not known at compile time, which is in a
+ *    loop until the first 'L' of the loop.
+ * Subroutines don't know the octave and note length they are called with, so they start in octave 4 with a default
+ * length of a quarter note.
+ *
+ * @param pattern - The command string to compile, in PROGMEM on Arduino.
+ * @param code - Buffer that receives the compiled commands or NULL to only determine their length.
+ * @param maxLength - Size of the buffer.
+ * @param subroutine - Definition of the subroutine that is compiled or NULL when compiling a voice.
+ * @return The number of bytes of compiled commands, including the end of the voice or subroutine.
+ */
+unsigned int TuneParser::compilePattern(const char* pattern, byte* code, unsigned int maxLength, TuneDefinition* subroutine) {
+	if (maxLength == 0) {
+		return 0;
+	}
+
+	unsigned int length = 0;
+	unsigned int position = 0;
+	byte octave = 4;
+	byte defaultLength = 16;
+	byte noteLength = subroutine == NULL ? 16 : 0;
+	bool isDefaultKnown = true;			// The default length of the voice is the default length while compiling.
+	bool isNoteDefault = false;			// The note length of the voice is its default length.
+	bool isTransposed = false;			// The voice may be transposed by a loop.
+
+	// Loops that are open, whether they contain notes and the octave and default length state at their start. Loops
+	// without notes are played only once, so a tick can never take long.
+	byte numLoops = subroutine == NULL ? 0 : 1;
+	byte numIgnoredLoops = 0;
+	byte maxDepth = numLoops;
+	bool loopHasNotes[TP_STACK_DEPTH + 1] = { false, false };
+	byte loopOctaves[TP_STACK_DEPTH + 1];
+	bool loopDefaultKnown[TP_STACK_DEPTH + 1];
+
+	// Macros that are being expanded and the position to continue at after them.
+	const char* macroPatterns[TP_MACRO_DEPTH];
+	unsigned int macroPositions[TP_MACRO_DEPTH];
+	byte numMacros = 0;
+
+	// Keep room for the end of the voice and the longest command (a length change followed by a note), and to close any
+	// open loops.
+	while (pattern != NULL && length + 4 + numLoops * 3 <= maxLength) {
+		byte ops[3];
+		byte numOps = 0;
+
+		// Get command character and convert to upper case.
+		char command = readPattern(pattern, position);
+		if (command >= 'a') {
+			command -= 32;
+		}
+
+		if (command == TUNE_CMD_END) {
+			if (numMacros == 0) {
+				break;
+			}
+
+			// Continue after the name of the macro that has ended.
+			numMacros --;
+			pattern = macroPatterns[numMacros];
+			position = macroPositions[numMacros] + 1;
+			continue;
+		}
+
+		switch (command) {
+			// Notes and rests are followed by an optional length and dot.
+			case TUNE_CMD_NOTE_A ... TUNE_CMD_NOTE_G:
+			case TUNE_CMD_REST:
+			case TUNE_CMD_PAUSE: {
+				byte op = TP_OP_REST;
+				if (command >= TUNE_CMD_NOTE_A && command <= TUNE_CMD_NOTE_G) {
+					byte noteIndex = command - TUNE_CMD_NOTE_A;
+					byte noteOctave = octave;
+					byte note = notes[0][noteIndex];
+
+					// Handle sharp and flat notes.
+					char sharpFlat = readPattern(pattern, position + 1);
+					if (sharpFlat == TUNE_CMD_NOTE_FLAT) {
+						position ++;
+						note = notes[1][noteIndex];
+						if (note == NOTE_B && noteOctave > 0) {
+							noteOctave --;
+						}
+					} else if (sharpFlat == TUNE_CMD_NOTE_SHARP || sharpFlat == TUNE_CMD_NOTE_SHARP2) {
+						position ++;
+						note = notes[2][noteIndex];
+						if (note == NOTE_C && noteOctave < 7) {
+							noteOctave ++;
+						}
+					}
+					op = noteOctave * 12 + note;
+				}
+
+				unsigned int lengthPosition = position;
+				byte ticks = parseNoteLength(pattern, position, defaultLength);
+				bool isDefault = position == lengthPosition;
+
+				// If note has a dot then add half of its duration.
+				bool isDotted = readPattern(pattern, position + 1) == TUNE_CMD_NOTE_DOUBLE;
+				if (isDotted) {
+					position ++;
+					ticks += ticks / 2;
+				}
+
+				if (isDefault && !isDefaultKnown) {
+					if (isDotted || !isNoteDefault) {
+						ops[numOps ++] = TP_OP_USE_DEFAULT;
+						ops[numOps ++] = isDotted ? 1 : 0;
+					}
+					isNoteDefault = !isDotted;
+					noteLength = 0;
+				} else if (ticks != noteLength) {
+					ops[numOps ++] = TP_OP_LENGTH;
+					ops[numOps ++] = ticks;
+					noteLength = ticks;
+					isNoteDefault = false;
+				}
+				ops[numOps ++] = op;
+				loopHasNotes[numLoops] = true;
+				break;
+			}
+
+			// Handle 'On' to change octave. A transposition by a loop no longer applies after it.
+			case TUNE_CMD_OCTAVE: {
+				byte number = parseNumber(pattern, position, 0, 7);
+				if (number != TP_NAN) {
+					octave = number;
+					if (isTransposed || numLoops > (subroutine == NULL ? 0 : 1)) {
+						ops[numOps ++] = TP_OP_TRANSPOSE;
+						ops[numOps ++] = 0;
+						isTransposed = false;
+					}
+				}
+				break;
+			}
+
+			// Handle '>' to increment octave.
+			case TUNE_CMD_OCTAVE_UP: {
+				if (octave < 7) {
+					octave ++;
+				}
+				break;
+			}
+
+			// Handle '<' to decrement octave.
+			case TUNE_CMD_OCTAVE_DOWN: {
+				if (octave > 0) {
+					octave --;
+				}
+				break;
+			}
+
+			// Handle 'Tnnn' to change song tempo.
+			case TUNE_CMD_TEMPO: {
+				byte tempo = parseNumber(pattern, position, 40, 250);
+				if (tempo != TP_NAN) {
+					ops[numOps ++] = TP_OP_TEMPO;
+					ops[numOps ++] = tempo;
+				}
+				break;
+			}
+
+			// Handle 'Lnn' to change the default note length. The voice keeps track of it for the notes in loops.
+			case TUNE_CMD_NOTE_LENGTH: {
+				byte length = parseNoteLength(pattern, position, defaultLength);
+				if (length != defaultLength || !isDefaultKnown) {
+					ops[numOps ++] = TP_OP_DEFAULT;
+					ops[numOps ++] = length;
+					defaultLength = length;
+					isDefaultKnown = true;
+					isNoteDefault = false;
+				}
+				break;
+			}
+
+			// Handle 'Innn' to change the current instrument.
+			case TUNE_CMD_INSTRUMENT: {
+				byte instrumentIndex = parseNumber(pattern, position, 0, 127);
+				if (instrumentIndex != TP_NAN) {
+					ops[numOps ++] = TP_OP_INSTRUMENT;
+					ops[numOps ++] = instrumentIndex;
+				}
+				break;
+			}
+
+			// Handle 'Vnn' to change volume.
+			case TUNE_CMD_VOLUME: {
+				byte volume = parseNumber(pattern, position, 0, 15);
+				if (volume != TP_NAN) {
+					ops[numOps ++] = TP_OP_VOLUME;
+					ops[numOps ++] = getAttenuation((float)volume / 15.0);
+				}
+				break;
+			}
+
+			// Handle '[' to start a loop. The note length is unknown when the loop starts over, and so is the default
+			// length until it is set in the loop.
+			case TUNE_CMD_LOOP_START: {
+				if (numLoops < TP_STACK_DEPTH) {
+					ops[numOps ++] = TP_OP_LOOP;
+					numLoops ++;
+					loopHasNotes[numLoops] = false;
+					loopOctaves[numLoops] = octave;
+					loopDefaultKnown[numLoops] = isDefaultKnown;
+					noteLength = 0;
+					isDefaultKnown = false;
+					isNoteDefault = false;
+					if (numLoops > maxDepth) {
+						maxDepth = numLoops;
+					}
+				} else {
+					numIgnoredLoops ++;
+				}
+				break;
+			}
+
+			// Handle ']nn' to end a loop that plays nn times, or twice when there is no number.
+			case TUNE_CMD_LOOP_END: {
+				byte count = parseNumber(pattern, position, 1, 99);
+				if (numIgnoredLoops > 0) {
+					numIgnoredLoops --;
+				} else if (numLoops > (subroutine == NULL ? 0 : 1)) {
+					if (!loopHasNotes[numLoops]) {
+						count = 1;
+					}
+					count = count == TP_NAN ? 2 : count;
+					signed char transpose = (octave - loopOctaves[numLoops]) * 12;
+					ops[numOps ++] = TP_OP_LOOP_END;
+					ops[numOps ++] = count;
+					ops[numOps ++] = (byte)transpose;
+					isTransposed |= transpose != 0 && count > 1;
+					isDefaultKnown |= loopDefaultKnown[numLoops];
+					isNoteDefault = false;
+					numLoops --;
+					loopHasNotes[numLoops] |= loopHasNotes[numLoops + 1];
+				}
+				break;
+			}
+
+			// Handle '$x' to call subroutine x. The note length is unknown after the subroutine returns.
+			case TUNE_CMD_SUBROUTINE: {
+				TuneDefinition* definition = findDefinition(readPattern(pattern, position + 1));
+				if (readPattern(pattern, position + 1) != TUNE_CMD_END) {
+					position ++;
+				}
+				if (definition != NULL && definition->pattern == NULL && numLoops + definition->depth <= TP_STACK_DEPTH) {
+					ops[numOps ++] = TP_OP_CALL;
+					ops[numOps ++] = definition->offset & 0xFF;
+					ops[numOps ++] = definition->offset >> 8;
+					noteLength = 0;
+					isNoteDefault = false;
+					loopHasNotes[numLoops] |= definition->hasNotes;
+					if (numLoops + definition->depth > maxDepth) {
+						maxDepth = numLoops + definition->depth;
+					}
+				}
+				break;
+			}
+
+			// Handle '!x' to expand macro x.
+			case TUNE_CMD_MACRO: {
+				TuneDefinition* definition = findDefinition(readPattern(pattern, position + 1));
+				if (readPattern(pattern, position + 1) != TUNE_CMD_END) {
+					position ++;
+				}
+				if (definition != NULL && definition->pattern != NULL && numMacros < TP_MACRO_DEPTH) {
+					macroPatterns[numMacros] = pattern;
+					macroPositions[numMacros] = position;
+					numMacros ++;
+					pattern = definition->pattern;
+					position = 0;
+					continue;
+				}
+				break;
+			}
+
+			// ignore anything else.
+			default:
+				break;
+		}
+
+		for (byte i = 0; i < numOps; i ++) {
+			if (code != NULL) {
+				code[length] = ops[i];
+			}
+			length ++;
+		}
+		position ++;
+	}
+
+	// Close loops that are still open.
+	for (byte i = subroutine == NULL ? 0 : 1; i < numLoops; i ++) {
+		if (code != NULL) {
+			code[length] = TP_OP_LOOP_END;
+			code[length + 1] = 1;
+			code[length + 2] = 0;
+		}
+		length += 3;
+	}
+
+	if (subroutine != NULL) {
+		subroutine->depth = maxDepth;
+		subroutine->hasNotes = loopHasNotes[0] || loopHasNotes[1];
+	}
+
+	if (code != NULL) {
+		code[length] = subroutine == NULL ? TP_OP_END : TP_OP_RETURN;
+	}
+	return length + 1;
+}
+
+
+/**
+ * Define a subroutine that can be called from command strings with '$' followed by its name. The subroutine is compiled
+ * once into the code buffer and is shared by all tunes that call it. Subroutines are kept in the code buffer until the
+ * definitions are cleared. A subroutine can call subroutines that were defined before it.
+ *
+ * @param name - Letter that names the subroutine.
+ * @param pattern - Command string of the subroutine, in PROGMEM on Arduino.
+ * @return True if the subroutine is defined or false if there is no room for it.
+ */
+bool TuneParser::defineSubroutine(char name, const char* pattern) {
+	// Keep room for the tunes to end their voices.
+	unsigned int maxLength = TP_CODE_SIZE - codeLength - TP_MAX_VOICES;
+	if (codeLength + TP_MAX_VOICES >= TP_CODE_SIZE) {
+		return false;
+	}
+
+	TuneDefinition subroutine;
+	if (compilePattern(pattern, NULL, TP_CODE_SIZE, &subroutine) > maxLength) {
+		return false;
+	}
+
+	// Compile before the definition is added, so a subroutine can't call itself.
+	unsigned int length = compilePattern(pattern, code + codeLength, maxLength, &subroutine);
+	TuneDefinition* definition = addDefinition(name);
+	if (definition == NULL) {
+		return false;
+	}
+
+	definition->pattern = NULL;
+	definition->offset = codeLength;
+	definition->depth = subroutine.depth;
+	definition->hasNotes = subroutine.hasNotes;
+	codeLength += length;
+	codeBase = codeLength;
+	return true;
+}
+
+
+/**
+ * Define a macro that can be used in command strings with '!' followed by its name. The command string of a macro is
+ * inserted wherever it is used while compiling, so unlike subroutines macros can change the octave and note length that
+ * follow, but every use takes space in the code buffer.
+ *
+ * @param name - Letter that names the macro.
+ * @param pattern - Command string of the macro, in PROGMEM on Arduino. It must remain available while tunes are created.
+ * @return True if the macro is defined or false if there are too many definitions.
+ */
+bool TuneParser::defineMacro(char name, const char* pattern) {
+	TuneDefinition* definition = addDefinition(name);
+	if (definition == NULL || pattern == NULL) {
+		return false;
+	}
+
+	definition->pattern = pattern;
+	return true;
+}
+
+
+/**
+ * Remove all subroutines and macros and clear the code buffer. Tunes that were created before are no longer valid.
+ */
+void TuneParser::clearDefinitions() {
+	numDefinitions = 0;
+	codeBase = 0;
+	codeLength = 0;
+}
+
+
+/**
+ * Take the instruments that the I command selects from an instrument bank, for example one that is read from SD card.
+ * Programs that the bank does not have are taken from midiInstruments. When 4-OP instruments are played the second
+ * half of 2-OP bank instruments is left empty, otherwise only the first half of 4-OP bank instruments is used.
+ *
+ * @param bank - The instrument bank or NULL to only use midiInstruments.
+ */
+void TuneParser::setInstrumentBank(InstrumentBank* bank) {
+	instrumentBank = bank;
+
+	// Instruments that are on the channels may no longer match their program.
+	for (byte i = 0; i < TP_MAX_CHANNELS; i ++) {
+		channels[i].program = TP_NO_PROGRAM;
+	}
 }
 
 
 /**
- * Determine the number of ticks until the next command should be parsed. This is uesed for both rests and notes to
- * determine their length. The number of ticks to wait is sotred with the given voice.
+ * Find the subroutine or macro with the given name.
  *
- * @param voice - The voice for which we want to know the duration of the note or rest.
+ * @param name - Letter that names the subroutine or macro.
+ * @return The definition or NULL if it's not defined.
  */
-void TuneParser::parseRest(Voice& voice) {
-	byte ticks = parseNoteLength(voice);
+TuneDefinition* TuneParser::findDefinition(char name) {
+	if (name >= 'a') {
+		name -= 32;
+	}
+
+	for (byte i = 0; i < numDefinitions; i ++) {
+		if (definitions[i].name == name) {
+			return &definitions[i];
+		}
+	}
+	return NULL;
+}
+
 
-	// Step through pattern data until we no longer find a digit.
-	char digit;
-	do {
-		voice.position ++;
-		digit = pgm_read_byte_near(voice.pattern + voice.position);
-	} while (digit >= '0' && digit <= '9');
+/**
+ * Get the definition with the given name to (re)define it.
+ *
+ * @param name - Letter that names the subroutine or macro.
+ * @return The definition or NULL if the name is not a letter or there are too many definitions.
+ */
+TuneDefinition* TuneParser::addDefinition(char name) {
+	if (name >= 'a') {
+		name -= 32;
+	}
+	if (name < 'A' || name > 'Z') {
+		return NULL;
+	}
 
-	// If note has a dot then add half of its duration.
-	if (pgm_read_byte_near(voice.pattern + voice.position) == TUNE_CMD_NOTE_DOUBLE) {
-		ticks += ticks / 2;
+	TuneDefinition* definition = findDefinition(name);
+	if (definition == NULL && numDefinitions < TP_MAX_DEFINITIONS) {
+		definition = &definitions[numDefinitions ++];
+		definition->name = name;
 	}
+	return definition;
+}
 
-	// Move position back one byte to not skip next command.
-	voice.position --;
 
-	// Set the number of ticks to hold the note.
-	voice.ticks = ticks;
+/**
+ * Get the channel attenuation for the given volume.
+ *
+ * @param volume - Volume in the range [0.0, 1.0].
+ * @return The attenuation to set with set4OPChannelVolume [0, 63].
+ */
+byte TuneParser::getAttenuation(float volume) {
+	return (1.0 - volume) * 63;
 }
 
 
 /**
- * Extract the note length at the current position of the command string for the given voice. If there is no number at
- * at the current position then return the default note lengt that ser set with the L command. Note the the '.' is not
+ * Read a character of a command string. On Arduino command strings are stored in PROGMEM.
+ */
+char TuneParser::readPattern(const char* pattern, unsigned int position) {
+	#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO
+		return pgm_read_byte_near(pattern + position);
+	#else
+		return pattern[position];
+	#endif
+}
+
+
+/**
+ * Extract the note length following the given position of the command string and leave the position at the last digit.
+ * If there is no number then return the default note length that was set with the L command. Note that the '.' is not
  * taken into account in this function!
  *
- * @param voice - the voice from which to extract the note length.
+ * @param pattern - The command string.
+ * @param position - Position of the command in the command string.
+ * @param defaultLength - Length in ticks when there is no number.
  * @return The length of the note in ticks.
  */
-byte TuneParser::parseNoteLength(Voice voice) {
-	byte length = parseNumber(voice, 1, 64);
+byte TuneParser::parseNoteLength(const char* pattern, unsigned int& position, byte defaultLength) {
+	byte length = parseNumber(pattern, position, 1, 64);
 
 	if (length == TP_NAN) {
-		return voice.defaultNoteLength;
+		return defaultLength;
 	}
 
 	// Reverse the bit order, so if duration is 16th note return 4 ticks.
-	for (byte i = 6; i >= 0; i --) {
+	for (byte i = 6; i > 0; i --) {
 		if (length & 1 << i) {
 			return 1 << (6 - i);
 		}
 	}
 
-	return 16;
+	return 64;
 }
 
 
 /**
- * Extract the number at the current command position of the given voice. The number is bounded by nMain and nMax. If
- * there is no number at the current command string position then TP_NAN is returned.
+ * Extract the number following the given position of the command string and leave the position at the last digit. The
+ * number is bounded by nMin and nMax. If there is no number then TP_NAN is returned.
  *
- * @param voice - The voice where the number needs to be extracted from.
+ * @param pattern - The command string.
+ * @param position - Position of the command in the command string.
  * @param nMin - Minimum value of the number.
  * @param nMax - Maximum value of the number.
- * @return The number at the current command position in the voice or TP_NAN.
+ * @return The number following the command or TP_NAN.
  */
-byte TuneParser::parseNumber(Voice voice, int nMin, int nMax) {
-	char nextDigit = pgm_read_byte_near(voice.pattern + voice.position + 1);
+byte TuneParser::parseNumber(const char* pattern, unsigned int& position, int nMin, int nMax) {
+	char nextDigit = readPattern(pattern, position + 1);
 	if (nextDigit < '0' || nextDigit > '9') {
 		return TP_NAN;
 	}
 
 	int number = 0;
-	while(nextDigit >= '0' && nextDigit <= '9') {
-		number *= 10;
-		voice.position ++;
-		number = number + pgm_read_byte_near(voice.pattern + voice.position) - '0';
-		nextDigit = pgm_read_byte_near(voice.pattern + voice.position + 1);
+	while (nextDigit >= '0' && nextDigit <= '9') {
+		if (number <= nMax) {
+			number = number * 10 + nextDigit - '0';
+		}
+		position ++;
+		nextDigit = readPattern(pattern, position + 1);
 	}
 
-	return (byte)max(nMin, min(number, nMax));
+	if (number < nMin) {
+		return nMin;
+	}
+	return number > nMax ? nMax : number;
 }
@@ -1,4 +1,9 @@
 #include <OPL3Duo.h>
+#include "InstrumentBank.h"
+
+#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+	#include <pthread.h>
+#endif
 
 #define TUNE_CMD_END '\0'
 #define TUNE_CMD_INSTRUMENT 'I'
@@ -16,31 +21,155 @@
 #define TUNE_CMD_REST 'R'
 #define TUNE_CMD_TEMPO 'T'
 #define TUNE_CMD_VOLUME 'V'
+#define TUNE_CMD_LOOP_START '['
+#define TUNE_CMD_LOOP_END ']'
+#define TUNE_CMD_SUBROUTINE '$'
+#define TUNE_CMD_MACRO '!'
+
+
+// Maximum number of voices of a tune and channels that are managed by the TuneParser. An OPL3 Duo has 12 4-OP or 36
+// 2-OP channels, but on AVR the channels beyond TP_MAX_CHANNELS are left unused to save RAM.
+#if defined(__AVR__)
+	#define TP_MAX_VOICES 6
+	#define TP_MAX_CHANNELS 18
+#else
+	#define TP_MAX_VOICES 12
+	#define TP_MAX_CHANNELS 36
+#endif
 
+// Loops and subroutine calls are nested on a stack of each voice. Loops and calls that would nest deeper are played as
+// if they weren't there. Macros are expanded while compiling and may be nested up to TP_MACRO_DEPTH deep. Subroutines
+// and macros are named by a letter.
+#if defined(__AVR__)
+	#define TP_STACK_DEPTH 3
+	#define TP_MAX_DEFINITIONS 8
+#else
+	#define TP_STACK_DEPTH 8
+	#define TP_MAX_DEFINITIONS 26
+#endif
+#define TP_MACRO_DEPTH 4
 
-#define TP_NUM_CHANNELS 12
+// On AVR boards background tunes are played from timer 1. The library does not claim the timer itself, so it stays free
+// for Servo and TimerOne. A sketch that plays tunes in the background adds TUNEPARSER_TIMER_ISR(tuneParser) once,
+// outside of any function. On other boards this adds nothing.
+#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+	#define TUNEPARSER_TIMER_ISR(parser) ISR(TIMER1_COMPA_vect) { (parser).runTimer(); }
+#else
+	#define TUNEPARSER_TIMER_ISR(parser)
+#endif
 #define TP_NAN 255
+#define TP_NO_CHANNEL 255
+#define TP_NO_TUNE 0
+#define TP_NO_PROGRAM 255
+#define TP_NO_STATE 255
+
+// Registers of a channel that are saved when its note is stolen by a tune with a higher priority: A0, B0, C0 and five
+// registers for both operators of each 2-OP channel, of which a 4-OP channel has two.
+#define TP_CHANNEL_REGISTERS 26
+
+// Number of stolen channels of which the state can be saved to give them back afterwards. When all are in use stolen
+// notes are cut short instead.
+#if defined(__AVR__)
+	#define TP_NUM_SAVED_STATES 2
+#else
+	#define TP_NUM_SAVED_STATES 6
+#endif
+
+// A tick is a 64th note, so there are 16 ticks per beat. Tick durations are kept in us and the remainder of the
+// division by the tempo is accumulated, so tunes don't drift at any tempo.
+#define TP_TICKS_PER_BEAT 16
+#define TP_US_PER_TICK_BEAT (60000000UL / TP_TICKS_PER_BEAT)
+
+// Command strings are compiled when a tune is created. The compiled commands of all tunes share the code buffer of the
+// TuneParser. Notes and rests take a single byte unless their length changes.
+#if defined(__AVR__)
+	#define TP_CODE_SIZE 512
+#else
+	#define TP_CODE_SIZE 4096
+#endif
+
+// Compiled tune ops. Values below TP_OP_REST are notes (octave * 12 + note) that play for the current note length.
+#define TP_OP_REST        0x60		// Rest for the current note length.
+#define TP_OP_LENGTH      0x61		// Set the note length, followed by the length in ticks.
+#define TP_OP_INSTRUMENT  0x62		// Change instrument, followed by the MIDI program.
+#define TP_OP_VOLUME      0x63		// Change volume, followed by the channel attenuation [0, 63].
+#define TP_OP_TEMPO       0x64		// Change tempo, followed by the tempo in beats per minute.
+#define TP_OP_END         0x65		// End of the voice.
+#define TP_OP_LOOP        0x66		// Start of a loop.
+#define TP_OP_LOOP_END    0x67		// End of a loop, followed by the number of times the loop is played and the number of
+										// semitones that the octave changes in a pass.
+#define TP_OP_CALL        0x68		// Call a subroutine, followed by the offset of the subroutine (2 bytes).
+#define TP_OP_RETURN      0x69		// Return from a subroutine.
+#define TP_OP_TRANSPOSE   0x6A		// Set the transposition, followed by the number of semitones.
+#define TP_OP_DEFAULT     0x6B		// Set the default note length, followed by the length in ticks.
+#define TP_OP_USE_DEFAULT 0x6C		// Set the note length to the default length, followed by 1 to add a dot or 0.
+
+
+struct TuneStackEntry {
+	unsigned int position;			// Start of the loop or the return address of the subroutine.
+	byte counter;					// Number of times the loop has been played.
+	signed char transpose;			// Transposition of the voice that called the subroutine.
+	byte defaultLength;				// Default note length of the voice that called the subroutine.
+};
 
 
 struct Voice {
-	const char* pattern;			// String of commands to be played.
-	unsigned long position;			// Position within the pattern string.
+	unsigned int start;				// Offset of the compiled commands of this voice in the code buffer.
+	unsigned int position;			// Offset of the next op to execute.
 	byte ticks;						// Number of ticks left until the next command.
-	Instrument4OP instrument;		// Current instrument for this voice.
-	float volume;					// Current volume of this voice.
-	byte octave;					// Current octave of this voice.
-	byte defaultNoteLength;			// Current default not length for this voice.
+	byte noteLength;				// Length in ticks of the notes and rests that follow.
+	byte defaultLength;				// Length in ticks of notes without a length in loops.
+	signed char transpose;			// Semitones that notes are shifted by octave changes of loops that repeat.
+	byte instrument;				// MIDI program of the current instrument in the bank or midiInstruments.
+	byte volume;					// Current channel attenuation [0, 63] of this voice.
 	bool ended;						// Indicates that the voice has processed all commands.
-	byte channel;					// OPL channel used by this voice.
+	byte channel;					// OPL channel used by this voice or TP_NO_CHANNEL.
+	byte stackDepth;				// Number of loops and subroutine calls that are active.
+	TuneStackEntry stack[TP_STACK_DEPTH];
 };
 
 
 struct Tune {
+	byte id;						// Identifies the tune on the channels it uses.
+	byte priority;					// Tunes can steal channels from tunes with a lower priority.
 	byte numVoices;					// Number of voices in use.
 	byte numEnded;					// Number of voices that has ended.
-	unsigned long tickDuration;		// Duration of each tick in ms (tempo)
-	unsigned long nextTick;			// Time in ms of the next tick.
-	Voice voice[6];					// Data of each voice.
+	byte tempo;						// Tempo in beats per minute.
+	byte tickError;					// Accumulated remainder of the tick duration in 1 / tempo us.
+	unsigned long tickDuration;		// Duration of each tick in us, rounded down.
+	unsigned long nextTick;			// Time in us of the next tick.
+	Voice voice[TP_MAX_VOICES];		// Data of each voice.
+};
+
+
+// Subroutine or macro that can be used in command strings.
+struct TuneDefinition {
+	char name;						// Letter that names the subroutine or macro.
+	const char* pattern;			// Command string of a macro or NULL for a subroutine.
+	unsigned int offset;			// Offset of a compiled subroutine in the code buffer.
+	byte depth;						// Stack depth needed to call a subroutine.
+	bool hasNotes;					// Indicates that a subroutine plays notes or rests.
+};
+
+
+// OPL channel as seen by the TuneParser.
+struct TuneChannel {
+	byte tuneId;					// Tune that plays a note on the channel or TP_NO_TUNE.
+	byte voice;						// Voice of the tune that plays the note.
+	byte priority;					// Priority of the tune that plays the note.
+	byte reservedBy;				// Tune that may use the channel exclusively or TP_NO_TUNE.
+	byte program;					// MIDI program that is loaded into the channel or TP_NO_PROGRAM.
+	byte savedState;				// State of the stolen note that is restored when the channel is released.
+};
+
+
+// State of a note that was stolen by a tune with a higher priority.
+struct TuneChannelState {
+	byte tuneId;					// Tune that played the stolen note or TP_NO_TUNE when the state is not in use.
+	byte voice;
+	byte priority;
+	byte program;
+	byte registers[TP_CHANNEL_REGISTERS];
 };
 
 
@@ -48,12 +177,14 @@ extern const unsigned char *midiInstruments[];
 const byte notes[3][7] = {{ NOTE_A,  NOTE_B,  NOTE_C,  NOTE_D,  NOTE_E,  NOTE_F,  NOTE_G  },
 						  { NOTE_GS, NOTE_AS, NOTE_B,  NOTE_CS, NOTE_DS, NOTE_E,  NOTE_FS },
 						  { NOTE_AS, NOTE_C,  NOTE_CS, NOTE_DS, NOTE_F,  NOTE_FS, NOTE_GS }};
+const byte stateOperatorRegisters[5] = { 0x20, 0x40, 0x60, 0x80, 0xE0 };
+const byte stateChannelRegisters[3] = { 0xA0, 0xC0, 0xB0 };
 
 
 class TuneParser {
 	public:
-		TuneParser(OPL3Duo* opl3Ref);
 		TuneParser(OPL2* opl2Ref);
+		TuneParser(OPL3* opl3Ref, bool use4OP = true);
 		void begin();
 		void play(const char* voice0);
 		void play(const char* voice0, const char* voice1);
@@ -67,22 +198,66 @@ class TuneParser {
 		Tune playBackground(const char* voice0, const char* voice1, const char* voice2, const char* voice3);
 		Tune playBackground(const char* voice0, const char* voice1, const char* voice2, const char* voice3, const char* voice4);
 		Tune playBackground(const char* voice0, const char* voice1, const char* voice2, const char* voice3, const char* voice4, const char* voice5);
-		Tune createTune(const char* voices[6], int numVoices);
+		Tune createTune(const char* voices[], int numVoices);
+		void clearTunes();
 		void playTune(Tune& tune);
 		void restartTune(Tune& tune);
 		bool tuneEnded(Tune& tune);
+		void stopTune(Tune& tune);
+		void setPriority(Tune& tune, byte priority);
+		bool reserveChannel(Tune& tune, byte channel4OP);
+		void clearReservations(Tune& tune);
 		unsigned long update(Tune& tune);
-		bool parseTuneCommand(Tune& tune, byte voiceIndex);
-		void parseNote(Voice& voice);
-		void parseRest(Voice& voice);
-		byte parseNoteLength(Voice voice);
-		byte parseNumber(Voice voice, int nMin, int nMax);
+		bool startBackground(Tune& tune);
+		void stopBackground();
+		unsigned long runBackground();
+		#if BOARD_TYPE == OPL2_BOARD_TYPE_ARDUINO && defined(__AVR__)
+			void runTimer();
+		#endif
+		unsigned int compile(const char* pattern, byte* code, unsigned int maxLength);
+		bool defineSubroutine(char name, const char* pattern);
+		bool defineMacro(char name, const char* pattern);
+		void clearDefinitions();
+		void setInstrumentBank(InstrumentBank* bank);
 
 	private:
-		OPL3Duo* opl3 = NULL;
-		byte oplChannel4OP = 0;
-		bool channelInUse[TP_NUM_CHANNELS] = {
-			false, false, false, false, false, false,
-			false, false, false, false, false, false
-		};
+		void initChannels();
+		void playVoices(const char* voices[], int numVoices);
+		long updateTick(Tune& tune);
+		void setTempo(Tune& tune, byte tempo);
+		bool runTuneCommand(Tune& tune, byte voiceIndex);
+		void playNote(Tune& tune, byte voiceIndex, byte note);
+		void loadInstrument(byte channelNum, byte program);
+		void releaseVoice(Tune& tune, byte voiceIndex);
+		byte findChannel(Tune& tune);
+		byte getControlChannel(byte channelNum, byte index = 0);
+		void stealChannel(byte channelNum);
+		void restoreChannel(byte channelNum);
+		byte getAttenuation(float volume);
+		unsigned int compilePattern(const char* pattern, byte* code, unsigned int maxLength, TuneDefinition* subroutine);
+		TuneDefinition* findDefinition(char name);
+		TuneDefinition* addDefinition(char name);
+		char readPattern(const char* pattern, unsigned int position);
+		byte parseNoteLength(const char* pattern, unsigned int& position, byte defaultLength);
+		byte parseNumber(const char* pattern, unsigned int& position, int nMin, int nMax);
+
+		OPL2* opl2 = NULL;
+		OPL3* opl3 = NULL;
+		bool is4OP = false;				// Play 4-OP instruments from midi_instruments_4op.h instead of 2-OP instruments.
+		InstrumentBank* instrumentBank = NULL;	// Bank to take instruments from instead of midiInstruments.
+		byte numChannels = 0;			// Number of 2-OP or 4-OP channels in use.
+		byte oplChannel = 0;
+		byte code[TP_CODE_SIZE];		// Compiled commands of the voices of all tunes.
+		unsigned int codeLength = 0;	// Number of bytes of the code buffer in use.
+		unsigned int codeBase = 0;		// Start of the code buffer after the subroutines, where tunes are compiled.
+		TuneDefinition definitions[TP_MAX_DEFINITIONS];
+		byte numDefinitions = 0;
+		Tune* volatile backgroundTune = NULL;	// Tune played by the timer or thread.
+		#if BOARD_TYPE == OPL2_BOARD_TYPE_RASPBERRY_PI
+			static void* backgroundThread(void* parser);
+			pthread_t thread;
+		#endif
+		byte nextTuneId = TP_NO_TUNE;
+		TuneChannel channels[TP_MAX_CHANNELS];
+		TuneChannelState savedStates[TP_NUM_SAVED_STATES];
 };
@@ -0,0 +1,864 @@
+/**
+ * This file was generated by examples_pi/instrumenttables from the instrument headers of the library. Do not
+ * edit it by hand, change the instrument headers and run instrumenttables again instead.
+ *
+ * Every table stores the unique 2-OP voices of its instruments once and per program the transpose followed by
+ * the voice number of each 2-OP half. Load an instrument with OPL2.loadInstrument(table, program) or
+ * OPL3.loadInstrument4OP(table, program). Tables that are not used by a sketch do not take up any flash.
+ */
+
+#include "OPL2.h"
+
+#ifndef _MIDI_INSTRUMENT_TABLES_H_
+	#define _MIDI_INSTRUMENT_TABLES_H_
+
+
+	// Instruments of midi_instruments.h.
+	const unsigned char midiInstrumentTableVoices[128][10] PROGMEM = {
+		{ 0x33, 0x5A, 0xB2, 0x50, 0x00, 0x31, 0x00, 0xB1, 0xF5, 0x11 },  //   0 INSTRUMENT_PIANO1
+		{ 0x31, 0x49, 0xF2, 0x53, 0x01, 0x11, 0x03, 0xF1, 0xF5, 0x07 },  //   1 INSTRUMENT_PIANO2
+		{ 0x31, 0x95, 0xD1, 0x83, 0x01, 0x32, 0x03, 0xC1, 0xF5, 0x0D },  //   2 INSTRUMENT_PIANO3
+		{ 0x34, 0x9B, 0xF3, 0x63, 0x01, 0x11, 0x00, 0x92, 0xF5, 0x11 },  //   3 INSTRUMENT_HONKTONK
+		{ 0x27, 0x28, 0xF8, 0xB7, 0x02, 0x91, 0x00, 0xF1, 0xF9, 0x01 },  //   4 INSTRUMENT_EP1
+		{ 0x1A, 0x2D, 0xF3, 0xEE, 0x01, 0x11, 0x00, 0xF1, 0xF5, 0x01 },  //   5 INSTRUMENT_EP2
+		{ 0x35, 0x95, 0xF2, 0x58, 0x01, 0x32, 0x02, 0x81, 0xF6, 0x1F },  //   6 INSTRUMENT_HARPSIC
+		{ 0x31, 0x85, 0xC9, 0x40, 0x00, 0x35, 0x00, 0xC2, 0xB9, 0x11 },  //   7 INSTRUMENT_CLAVIC
+		{ 0x09, 0x15, 0xC7, 0x64, 0x00, 0x01, 0x05, 0xB2, 0x35, 0x08 },  //   8 INSTRUMENT_CELESTA
+		{ 0x06, 0x03, 0xF4, 0x44, 0x01, 0x01, 0x1B, 0xF2, 0x34, 0x00 },  //   9 INSTRUMENT_GLOCK
+		{ 0x04, 0x06, 0xA9, 0x24, 0x01, 0x01, 0x01, 0xF5, 0x74, 0x0A },  //  10 INSTRUMENT_MUSICBOX
+		{ 0xD4, 0x00, 0xF6, 0x33, 0x00, 0xF1, 0x00, 0x61, 0xE3, 0x00 },  //  11 INSTRUMENT_VIBES
+		{ 0xD4, 0x00, 0xF7, 0xE8, 0x00, 0xD1, 0x00, 0xA4, 0x64, 0x04 },  //  12 INSTRUMENT_MARIMBA
+		{ 0x36, 0x16, 0xF7, 0xF7, 0x00, 0x31, 0x07, 0xB5, 0xF5, 0x01 },  //  13 INSTRUMENT_XYLO
+		{ 0x03, 0x1B, 0xA2, 0x43, 0x00, 0x00, 0x00, 0xF3, 0x74, 0x0B },  //  14 INSTRUMENT_TUBEBELL
+		{ 0xC3, 0x8E, 0xF8, 0x35, 0x01, 0x11, 0x00, 0xC3, 0x94, 0x11 },  //  15 INSTRUMENT_SANTUR
+		{ 0xE2, 0x07, 0xF4, 0x1B, 0x01, 0xE0, 0x00, 0xF4, 0x0D, 0x16 },  //  16 INSTRUMENT_ORGAN1
+		{ 0xF2, 0x00, 0xF6, 0x2C, 0x00, 0xF0, 0x00, 0xF5, 0x0B, 0x14 },  //  17 INSTRUMENT_ORGAN2
+		{ 0xF1, 0x06, 0xB6, 0x15, 0x00, 0xF0, 0x00, 0xBF, 0x07, 0x0A },  //  18 INSTRUMENT_ORGAN3
+		{ 0x22, 0x03, 0x79, 0x16, 0x01, 0xE0, 0x00, 0x6D, 0x08, 0x18 },  //  19 INSTRUMENT_PIPEORG
+		{ 0x31, 0x27, 0x63, 0x06, 0x00, 0x72, 0x00, 0x51, 0x17, 0x11 },  //  20 INSTRUMENT_REEDORG
+		{ 0xB4, 0x1D, 0x53, 0x16, 0x01, 0x71, 0x00, 0x51, 0x17, 0x1F },  //  21 INSTRUMENT_ACORDIAN
+		{ 0x25, 0x29, 0x97, 0x15, 0x00, 0x32, 0x00, 0x53, 0x08, 0x11 },  //  22 INSTRUMENT_HARMONIC
+		{ 0x24, 0x9E, 0x67, 0x15, 0x00, 0x31, 0x00, 0x53, 0x06, 0x1F },  //  23 INSTRUMENT_BANDNEON
+		{ 0x13, 0x27, 0xA3, 0xB4, 0x01, 0x31, 0x00, 0xD2, 0xF8, 0x05 },  //  24 INSTRUMENT_NYLONGT
+		{ 0x17, 0xA3, 0xF3, 0x32, 0x00, 0x11, 0x00, 0xE2, 0xC7, 0x11 },  //  25 INSTRUMENT_STEELGT
+		{ 0x33, 0x24, 0xD2, 0xC1, 0x01, 0x31, 0x00, 0xF1, 0x9C, 0x0F },  //  26 INSTRUMENT_JAZZGT
+		{ 0x31, 0x05, 0xF8, 0x44, 0x00, 0x32, 0x02, 0xF2, 0xC9, 0x11 },  //  27 INSTRUMENT_CLEANGT
+		{ 0x21, 0x09, 0x9C, 0x7B, 0x00, 0x02, 0x03, 0x95, 0xFB, 0x07 },  //  28 INSTRUMENT_MUTEGT
+		{ 0x21, 0x84, 0x81, 0x98, 0x01, 0x21, 0x04, 0xA1, 0x59, 0x07 },  //  29 INSTRUMENT_OVERDGT
+		{ 0xB1, 0x0C, 0x78, 0x43, 0x00, 0x22, 0x03, 0x91, 0xFC, 0x31 },  //  30 INSTRUMENT_DISTGT
+		{ 0x00, 0x0A, 0x82, 0x8C, 0x00, 0x08, 0x02, 0xB4, 0xEC, 0x09 },  //  31 INSTRUMENT_GTHARMS
+		{ 0x21, 0x13, 0xAB, 0x46, 0x00, 0x21, 0x00, 0x93, 0xF7, 0x01 },  //  32 INSTRUMENT_ACOUBASS
+		{ 0x01, 0x0A, 0xF9, 0x32, 0x00, 0x22, 0x04, 0xC1, 0x58, 0x01 },  //  33 INSTRUMENT_FINGBASS
+		{ 0x21, 0x07, 0xFA, 0x77, 0x00, 0x22, 0x02, 0xC3, 0x6A, 0x0B },  //  34 INSTRUMENT_PICKBASS
+		{ 0x21, 0x17, 0x71, 0x57, 0x00, 0x21, 0x00, 0x62, 0x87, 0x0B },  //  35 INSTRUMENT_FRETLESS
+		{ 0x25, 0x01, 0xFA, 0x78, 0x01, 0x12, 0x00, 0xF3, 0x97, 0x07 },  //  36 INSTRUMENT_SLAPBAS1
+		{ 0x21, 0x03, 0xFA, 0x88, 0x00, 0x13, 0x00, 0xB3, 0x97, 0x0D },  //  37 INSTRUMENT_SLAPBAS2
+		{ 0x21, 0x09, 0xF5, 0x7F, 0x01, 0x23, 0x04, 0xF3, 0xCC, 0x09 },  //  38 INSTRUMENT_SYNBASS1
+		{ 0x01, 0x10, 0xA3, 0x9B, 0x00, 0x01, 0x00, 0x93, 0xAA, 0x09 },  //  39 INSTRUMENT_SYNBASS2
+		{ 0xE2, 0x19, 0xF6, 0x29, 0x01, 0xE1, 0x00, 0x78, 0x08, 0x1D },  //  40 INSTRUMENT_VIOLIN
+		{ 0xE2, 0x1C, 0xF6, 0x29, 0x01, 0xE1, 0x00, 0x78, 0x08, 0x1D },  //  41 INSTRUMENT_VIOLA
+		{ 0x61, 0x19, 0x69, 0x16, 0x01, 0x61, 0x00, 0x54, 0x27, 0x1B },  //  42 INSTRUMENT_CELLO
+		{ 0x71, 0x18, 0x82, 0x31, 0x01, 0x32, 0x00, 0x61, 0x56, 0x0D },  //  43 INSTRUMENT_CONTRAB
+		{ 0xE2, 0x23, 0x70, 0x06, 0x01, 0xE1, 0x00, 0x75, 0x16, 0x1D },  //  44 INSTRUMENT_TREMSTR
+		{ 0x02, 0x00, 0x88, 0xE6, 0x00, 0x61, 0x00, 0xF5, 0xF6, 0x18 },  //  45 INSTRUMENT_PIZZ
+		{ 0x12, 0x20, 0xF6, 0xD5, 0x01, 0x11, 0x80, 0xF3, 0xE3, 0x0F },  //  46 INSTRUMENT_HARP
+		{ 0x61, 0x0E, 0xF4, 0xF4, 0x01, 0x00, 0x00, 0xB5, 0xF5, 0x01 },  //  47 INSTRUMENT_TIMPANI
+		{ 0x61, 0x1E, 0x9C, 0x04, 0x01, 0x21, 0x80, 0x71, 0x16, 0x0F },  //  48 INSTRUMENT_STRINGS
+		{ 0xA2, 0x2A, 0xC0, 0xD6, 0x02, 0x21, 0x00, 0x30, 0x55, 0x1F },  //  49 INSTRUMENT_SLOWSTR
+		{ 0x61, 0x21, 0x72, 0x35, 0x01, 0x61, 0x00, 0x62, 0x36, 0x1F },  //  50 INSTRUMENT_SYNSTR1
+		{ 0x21, 0x1A, 0x72, 0x23, 0x01, 0x21, 0x02, 0x51, 0x07, 0x0F },  //  51 INSTRUMENT_SYNSTR2
+		{ 0xE1, 0x16, 0x97, 0x31, 0x00, 0x61, 0x00, 0x62, 0x39, 0x09 },  //  52 INSTRUMENT_CHOIR
+		{ 0x22, 0xC3, 0x79, 0x45, 0x00, 0x21, 0x00, 0x66, 0x27, 0x01 },  //  53 INSTRUMENT_OOHS
+		{ 0x21, 0xDE, 0x63, 0x55, 0x01, 0x21, 0x00, 0x73, 0x46, 0x01 },  //  54 INSTRUMENT_SYNVOX
+		{ 0x42, 0x05, 0x86, 0xF7, 0x00, 0x50, 0x00, 0x74, 0x76, 0x1A },  //  55 INSTRUMENT_ORCHIT
+		{ 0x31, 0x1C, 0x61, 0x02, 0x00, 0x61, 0x81, 0x92, 0x38, 0x0F },  //  56 INSTRUMENT_TRUMPET
+		{ 0x71, 0x1E, 0x52, 0x23, 0x00, 0x61, 0x02, 0x71, 0x19, 0x0F },  //  57 INSTRUMENT_TROMBONE
+		{ 0x21, 0x1A, 0x76, 0x16, 0x00, 0x21, 0x01, 0x81, 0x09, 0x0F },  //  58 INSTRUMENT_TUBA
+		{ 0x25, 0x28, 0x89, 0x2C, 0x02, 0x20, 0x00, 0x83, 0x4B, 0x27 },  //  59 INSTRUMENT_MUTETRP
+		{ 0x21, 0x1F, 0x79, 0x16, 0x00, 0xA2, 0x05, 0x71, 0x59, 0x09 },  //  60 INSTRUMENT_FRHORN
+		{ 0x21, 0x19, 0x87, 0x16, 0x00, 0x21, 0x03, 0x82, 0x39, 0x0F },  //  61 INSTRUMENT_BRASS1
+		{ 0x21, 0x17, 0x75, 0x35, 0x00, 0x22, 0x82, 0x84, 0x17, 0x0F },  //  62 INSTRUMENT_SYNBRAS1
+		{ 0x21, 0x22, 0x62, 0x58, 0x00, 0x21, 0x02, 0x72, 0x16, 0x0F },  //  63 INSTRUMENT_SYNBRAS2
+		{ 0xB1, 0x1B, 0x59, 0x07, 0x01, 0xA1, 0x00, 0x7B, 0x0A, 0x01 },  //  64 INSTRUMENT_SOPSAX
+		{ 0x21, 0x16, 0x9F, 0x04, 0x00, 0x21, 0x00, 0x85, 0x0C, 0x1B },  //  65 INSTRUMENT_ALTOSAX
+		{ 0x21, 0x0F, 0xA8, 0x20, 0x00, 0x23, 0x00, 0x7B, 0x0A, 0x1D },  //  66 INSTRUMENT_TENSAX
+		{ 0x21, 0x0F, 0x88, 0x04, 0x00, 0x26, 0x00, 0x79, 0x18, 0x19 },  //  67 INSTRUMENT_BARISAX
+		{ 0x31, 0x18, 0x8F, 0x05, 0x00, 0x32, 0x01, 0x73, 0x08, 0x01 },  //  68 INSTRUMENT_OBOE
+		{ 0xA1, 0x0A, 0x8C, 0x37, 0x01, 0x24, 0x04, 0x77, 0x0A, 0x01 },  //  69 INSTRUMENT_ENGLHORN
+		{ 0x31, 0x04, 0xA8, 0x67, 0x00, 0x75, 0x00, 0x51, 0x19, 0x0B },  //  70 INSTRUMENT_BASSOON
+		{ 0xA2, 0x1F, 0x77, 0x26, 0x01, 0x21, 0x01, 0x74, 0x09, 0x01 },  //  71 INSTRUMENT_CLARINET
+		{ 0xE1, 0x07, 0xB8, 0x94, 0x01, 0x21, 0x01, 0x63, 0x28, 0x01 },  //  72 INSTRUMENT_PICCOLO
+		{ 0xA1, 0x93, 0x87, 0x59, 0x00, 0xE1, 0x00, 0x65, 0x0A, 0x01 },  //  73 INSTRUMENT_FLUTE1
+		{ 0x22, 0x10, 0x9F, 0x38, 0x00, 0x61, 0x00, 0x67, 0x29, 0x01 },  //  74 INSTRUMENT_RECORDER
+		{ 0xE2, 0x0D, 0x88, 0x9A, 0x01, 0x21, 0x00, 0x67, 0x09, 0x01 },  //  75 INSTRUMENT_PANFLUTE
+		{ 0xA2, 0x10, 0x98, 0x94, 0x00, 0x21, 0x01, 0x6A, 0x28, 0x0F },  //  76 INSTRUMENT_BOTTLEB
+		{ 0xF1, 0x1C, 0x86, 0x26, 0x00, 0xF1, 0x00, 0x55, 0x27, 0x0F },  //  77 INSTRUMENT_SHAKU
+		{ 0xE1, 0x3F, 0x9F, 0x09, 0x00, 0xE1, 0x00, 0x6F, 0x08, 0x00 },  //  78 INSTRUMENT_WHISTLE
+		{ 0xE2, 0x3B, 0xF7, 0x19, 0x00, 0x21, 0x00, 0x7A, 0x07, 0x01 },  //  79 INSTRUMENT_OCARINA
+		{ 0x22, 0x1E, 0x92, 0x0C, 0x00, 0x61, 0x06, 0xA2, 0x0D, 0x0F },  //  80 INSTRUMENT_SQUARWAV
+		{ 0x21, 0x15, 0xF4, 0x22, 0x01, 0x21, 0x00, 0xA3, 0x5F, 0x0F },  //  81 INSTRUMENT_SAWWAV
+		{ 0xF2, 0x20, 0x47, 0x66, 0x01, 0xF1, 0x00, 0x42, 0x27, 0x03 },  //  82 INSTRUMENT_SYNCALLI
+		{ 0x61, 0x19, 0x88, 0x28, 0x00, 0x61, 0x05, 0xB2, 0x49, 0x0F },  //  83 INSTRUMENT_CHIFLEAD
+		{ 0x21, 0x16, 0x82, 0x1B, 0x00, 0x23, 0x00, 0xB2, 0x79, 0x11 },  //  84 INSTRUMENT_CHARANG
+		{ 0x21, 0x00, 0xCA, 0x93, 0x00, 0x22, 0x00, 0x7A, 0x1A, 0x01 },  //  85 INSTRUMENT_SOLOVOX
+		{ 0x23, 0x00, 0x92, 0xC9, 0x01, 0x22, 0x00, 0x82, 0x28, 0x18 },  //  86 INSTRUMENT_FIFTHSAW
+		{ 0x21, 0x1D, 0xF3, 0x7B, 0x00, 0x22, 0x02, 0xC3, 0x5F, 0x0F },  //  87 INSTRUMENT_BASSLEAD
+		{ 0xE1, 0x00, 0x81, 0x25, 0x01, 0xA6, 0x86, 0xC4, 0x95, 0x10 },  //  88 INSTRUMENT_FANTASIA
+		{ 0x21, 0x27, 0x31, 0x01, 0x00, 0x21, 0x00, 0x44, 0x15, 0x0F },  //  89 INSTRUMENT_WARMPAD
+		{ 0x60, 0x14, 0x83, 0x35, 0x02, 0x61, 0x00, 0xD1, 0x06, 0x0D },  //  90 INSTRUMENT_POLYSYN
+		{ 0xE1, 0x5C, 0xD3, 0x01, 0x01, 0x62, 0x00, 0x82, 0x37, 0x01 },  //  91 INSTRUMENT_SPACEVOX
+		{ 0x28, 0x38, 0x34, 0x86, 0x02, 0x21, 0x00, 0x41, 0x35, 0x01 },  //  92 INSTRUMENT_BOWEDGLS
+		{ 0x24, 0x12, 0x52, 0xF3, 0x01, 0x23, 0x02, 0x32, 0xF5, 0x15 },  //  93 INSTRUMENT_METALPAD
+		{ 0x61, 0x1D, 0x62, 0xA6, 0x00, 0xA1, 0x00, 0x61, 0x26, 0x0B },  //  94 INSTRUMENT_HALOPAD
+		{ 0x22, 0x0F, 0x22, 0xD5, 0x01, 0x21, 0x84, 0x3F, 0x05, 0x1B },  //  95 INSTRUMENT_SWEEPPAD
+		{ 0xE3, 0x1F, 0xF9, 0x24, 0x00, 0x31, 0x01, 0xD1, 0xF6, 0x01 },  //  96 INSTRUMENT_ICERAIN
+		{ 0x63, 0x00, 0x41, 0x55, 0x01, 0xA2, 0x00, 0x41, 0x05, 0x16 },  //  97 INSTRUMENT_SOUNDTRK
+		{ 0xC7, 0x25, 0xA7, 0x65, 0x01, 0xC1, 0x05, 0xF3, 0xE4, 0x01 },  //  98 INSTRUMENT_CRYSTAL
+		{ 0xE3, 0x19, 0xF7, 0xB7, 0x01, 0x61, 0x00, 0x92, 0xF5, 0x11 },  //  99 INSTRUMENT_ATMOSPH
+		{ 0x66, 0x9B, 0xA8, 0x44, 0x00, 0x41, 0x04, 0xF2, 0xE4, 0x1F },  // 100 INSTRUMENT_BRIGHT
+		{ 0x61, 0x20, 0x22, 0x75, 0x00, 0x61, 0x00, 0x45, 0x25, 0x0D },  // 101 INSTRUMENT_GOBLIN
+		{ 0xE1, 0x21, 0xF6, 0x84, 0x00, 0xE1, 0x01, 0xA3, 0x36, 0x0F },  // 102 INSTRUMENT_ECHODROP
+		{ 0xE2, 0x14, 0x73, 0x64, 0x01, 0xE1, 0x01, 0x98, 0x05, 0x1B },  // 103 INSTRUMENT_STARTHEM
+		{ 0x21, 0x0B, 0x72, 0x34, 0x00, 0x24, 0x02, 0xA3, 0xF6, 0x19 },  // 104 INSTRUMENT_SITAR
+		{ 0x21, 0x16, 0xF4, 0x53, 0x00, 0x04, 0x00, 0xF6, 0xF8, 0x0D },  // 105 INSTRUMENT_BANJO
+		{ 0x21, 0x18, 0xDA, 0x02, 0x00, 0x35, 0x00, 0xF3, 0xF5, 0x0D },  // 106 INSTRUMENT_SHAMISEN
+		{ 0x25, 0x0F, 0xFA, 0x63, 0x00, 0x02, 0x00, 0x94, 0xE5, 0x19 },  // 107 INSTRUMENT_KOTO
+		{ 0x32, 0x07, 0xF9, 0x96, 0x00, 0x11, 0x00, 0x84, 0x44, 0x01 },  // 108 INSTRUMENT_KALIMBA
+		{ 0x20, 0x0E, 0x97, 0x18, 0x02, 0x25, 0x03, 0x83, 0x18, 0x19 },  // 109 INSTRUMENT_BAGPIPE
+		{ 0x61, 0x18, 0xF6, 0x29, 0x00, 0x62, 0x01, 0x78, 0x08, 0x11 },  // 110 INSTRUMENT_FIDDLE
+		{ 0xE6, 0x21, 0x76, 0x19, 0x00, 0x61, 0x03, 0x8E, 0x08, 0x1B },  // 111 INSTRUMENT_SHANNAI
+		{ 0x27, 0x23, 0xF0, 0xD4, 0x00, 0x05, 0x09, 0xF2, 0x46, 0x01 },  // 112 INSTRUMENT_TINKLBEL
+		{ 0x1C, 0x0C, 0xF9, 0x31, 0x01, 0x15, 0x00, 0x96, 0xE8, 0x1F },  // 113 INSTRUMENT_AGOGO
+		{ 0x02, 0x00, 0x75, 0x16, 0x02, 0x01, 0x00, 0xF6, 0xF6, 0x16 },  // 114 INSTRUMENT_STEELDRM
+		{ 0x25, 0x1B, 0xFA, 0xF2, 0x00, 0x12, 0x00, 0xF6, 0x9A, 0x01 },  // 115 INSTRUMENT_WOODBLOK
+		{ 0x02, 0x1D, 0xF5, 0x93, 0x00, 0x00, 0x00, 0xC6, 0x45, 0x01 },  // 116 INSTRUMENT_TAIKO
+		{ 0x11, 0x15, 0xF5, 0x32, 0x00, 0x10, 0x00, 0xF4, 0xB4, 0x05 },  // 117 INSTRUMENT_MELOTOM
+		{ 0x22, 0x06, 0xFA, 0x99, 0x00, 0x01, 0x00, 0xD5, 0x25, 0x09 },  // 118 INSTRUMENT_SYNDRUM
+		{ 0x2E, 0x00, 0xFF, 0x00, 0x02, 0x0E, 0x0E, 0x21, 0x2D, 0x0F },  // 119 INSTRUMENT_REVRSCYM
+		{ 0x30, 0x0B, 0x56, 0xE4, 0x01, 0x17, 0x00, 0x55, 0x87, 0x21 },  // 120 INSTRUMENT_FRETNOIS
+		{ 0x24, 0x00, 0xFF, 0x03, 0x00, 0x05, 0x08, 0x98, 0x87, 0x1D },  // 121 INSTRUMENT_BRTHNOIS
+		{ 0x0E, 0x00, 0xF0, 0x00, 0x02, 0x0A, 0x04, 0x17, 0x04, 0x3F },  // 122 INSTRUMENT_SEASHORE
+		{ 0x20, 0x08, 0xF6, 0xF7, 0x00, 0x0E, 0x05, 0x77, 0xF9, 0x21 },  // 123 INSTRUMENT_BIRDS
+		{ 0x20, 0x14, 0xF1, 0x08, 0x00, 0x2E, 0x02, 0xF4, 0x08, 0x01 },  // 124 INSTRUMENT_TELEPHON
+		{ 0x20, 0x04, 0xF2, 0x00, 0x01, 0x23, 0x00, 0x36, 0x05, 0x13 },  // 125 INSTRUMENT_HELICOPT
+		{ 0x2E, 0x00, 0xFF, 0x02, 0x00, 0x2A, 0x05, 0x32, 0x55, 0x3F },  // 126 INSTRUMENT_APPLAUSE
+		{ 0x20, 0x00, 0xA1, 0xEF, 0x00, 0x10, 0x00, 0xF3, 0xDF, 0x0F },  // 127 INSTRUMENT_GUNSHOT
+	};
+
+	const InstrumentTable midiInstrumentTable = {
+		midiInstrumentTableVoices[0], NULL, 128, 1, 0x00
+	};
+
+
+	// Instruments of midi_instruments_4op.h.
+	const unsigned char midiInstrumentTable4OPVoices[256][10] PROGMEM = {
+		{ 0x31, 0x8F, 0xF1, 0xB2, 0x08, 0x11, 0x83, 0xF1, 0xAF, 0x00 },  //   0 INSTRUMENT_PIANO1
+		{ 0x31, 0x19, 0xF1, 0xB2, 0x01, 0x31, 0x01, 0xC1, 0xD5, 0x00 },  //   1 INSTRUMENT_PIANO1
+		{ 0x11, 0x4C, 0xF1, 0xD2, 0x0A, 0x11, 0x83, 0xF2, 0xE6, 0x00 },  //   2 INSTRUMENT_PIANO2
+		{ 0x11, 0x15, 0xC1, 0xD5, 0x01, 0x31, 0x00, 0xC2, 0xE6, 0x00 },  //   3 INSTRUMENT_PIANO2
+		{ 0x15, 0x5F, 0xF3, 0xD4, 0x0E, 0x15, 0x61, 0xB1, 0xE4, 0x00 },  //   4 INSTRUMENT_PIANO3
+		{ 0x11, 0x5C, 0xB1, 0xE4, 0x00, 0x11, 0x00, 0xB1, 0xB5, 0x00 },  //   5 INSTRUMENT_PIANO3
+		{ 0x11, 0x89, 0xF1, 0xD4, 0x0D, 0x02, 0x5F, 0xC3, 0xE4, 0x00 },  //   6 INSTRUMENT_HONKTONK
+		{ 0x00, 0x9B, 0xC1, 0x35, 0x00, 0x11, 0x00, 0xC1, 0xD5, 0x00 },  //   7 INSTRUMENT_HONKTONK
+		{ 0x1C, 0x6F, 0xF2, 0xE7, 0x0C, 0x01, 0x80, 0xF2, 0xB8, 0x00 },  //   8 INSTRUMENT_EP1
+		{ 0x11, 0x9C, 0xB1, 0xE5, 0x01, 0x11, 0x80, 0xF2, 0xB8, 0x00 },  //   9 INSTRUMENT_EP1
+		{ 0x1C, 0x3A, 0xC2, 0xE7, 0x00, 0x01, 0x80, 0xF3, 0xB8, 0x00 },  //  10 INSTRUMENT_EP2
+		{ 0x11, 0x1B, 0xB1, 0xF5, 0x01, 0x11, 0x80, 0xF2, 0xD8, 0x00 },  //  11 INSTRUMENT_EP2
+		{ 0x31, 0x90, 0xF0, 0x31, 0x08, 0x34, 0x9F, 0xF2, 0x37, 0x00 },  //  12 INSTRUMENT_HARPSIC
+		{ 0x24, 0x1C, 0xF3, 0x51, 0x00, 0x11, 0x00, 0xF2, 0x97, 0x44 },  //  13 INSTRUMENT_HARPSIC
+		{ 0x10, 0x60, 0xF2, 0x50, 0x04, 0x31, 0x5D, 0xE1, 0xF0, 0x00 },  //  14 INSTRUMENT_CLAVIC
+		{ 0x30, 0xA2, 0xB2, 0x40, 0x00, 0x11, 0x80, 0xF1, 0xE9, 0x50 },  //  15 INSTRUMENT_CLAVIC
+		{ 0x02, 0x25, 0xCE, 0xE6, 0x00, 0x01, 0x00, 0xF4, 0xE6, 0x00 },  //  16 INSTRUMENT_CELESTA
+		{ 0x07, 0xA1, 0xF5, 0xE6, 0x01, 0x41, 0x00, 0xF3, 0xE5, 0x00 },  //  17 INSTRUMENT_CELESTA
+		{ 0x17, 0x54, 0xF2, 0xE3, 0x0A, 0x11, 0x06, 0xC2, 0xE2, 0x00 },  //  18 INSTRUMENT_GLOCK
+		{ 0x19, 0x2B, 0xF2, 0xC3, 0x01, 0x91, 0x07, 0xF2, 0xD2, 0x00 },  //  19 INSTRUMENT_GLOCK
+		{ 0x17, 0x21, 0x56, 0x04, 0x02, 0x01, 0x00, 0xF6, 0x04, 0x00 },  //  20 INSTRUMENT_MUSICBOX
+		{ 0x1A, 0x27, 0xA6, 0x04, 0x01, 0x00, 0x0A, 0xF6, 0x04, 0x00 },  //  21 INSTRUMENT_MUSICBOX
+		{ 0x25, 0x9A, 0x08, 0x79, 0x0A, 0x85, 0x5B, 0xE3, 0xE6, 0x00 },  //  22 INSTRUMENT_VIBES
+		{ 0x15, 0x62, 0xF3, 0xE6, 0x01, 0x81, 0x00, 0xF2, 0xE6, 0x00 },  //  23 INSTRUMENT_VIBES
+		{ 0x1C, 0xA3, 0xF7, 0x55, 0x06, 0x20, 0x0D, 0x85, 0xD8, 0x00 },  //  24 INSTRUMENT_MARIMBA
+		{ 0x18, 0x23, 0xF7, 0x55, 0x01, 0x21, 0x00, 0xE5, 0xD8, 0x00 },  //  25 INSTRUMENT_MARIMBA
+		{ 0x0A, 0x53, 0xF9, 0xD6, 0x0A, 0x84, 0x80, 0xF7, 0xD6, 0x00 },  //  26 INSTRUMENT_XYLO
+		{ 0x15, 0x91, 0xF6, 0xA6, 0x01, 0x01, 0x00, 0xF6, 0xE6, 0x00 },  //  27 INSTRUMENT_XYLO
+		{ 0x41, 0x8A, 0xD4, 0xB3, 0x04, 0x80, 0x13, 0xC2, 0xB4, 0x00 },  //  28 INSTRUMENT_TUBEBELL
+		{ 0x45, 0x59, 0xD3, 0x82, 0x01, 0x81, 0x80, 0xA3, 0xE3, 0x00 },  //  29 INSTRUMENT_TUBEBELL
+		{ 0x01, 0x84, 0xE7, 0xF7, 0x0D, 0x03, 0x49, 0x74, 0x55, 0x10 },  //  30 INSTRUMENT_SANTUR
+		{ 0x01, 0x80, 0xB3, 0x05, 0x01, 0x01, 0x80, 0x76, 0xF7, 0x00 },  //  31 INSTRUMENT_SANTUR
+		{ 0xA0, 0x85, 0xA2, 0x2A, 0x07, 0x22, 0x9E, 0xA5, 0x2A, 0x00 },  //  32 INSTRUMENT_ORGAN1
+		{ 0xA2, 0x83, 0xA5, 0x2A, 0x01, 0x28, 0x95, 0xA1, 0x2A, 0x00 },  //  33 INSTRUMENT_ORGAN1
+		{ 0xA0, 0x85, 0x91, 0x2A, 0x07, 0x21, 0x0B, 0xC8, 0x3A, 0x00 },  //  34 INSTRUMENT_ORGAN2
+		{ 0x20, 0x81, 0xC6, 0x38, 0x01, 0x21, 0x80, 0xF6, 0x57, 0x00 },  //  35 INSTRUMENT_ORGAN2
+		{ 0xE3, 0x56, 0xA6, 0x2A, 0x08, 0x61, 0x83, 0xAF, 0x0A, 0x01 },  //  36 INSTRUMENT_ORGAN3
+		{ 0xE1, 0x91, 0xAF, 0x0A, 0x01, 0x62, 0x83, 0xAF, 0x0A, 0x00 },  //  37 INSTRUMENT_ORGAN3
+		{ 0x25, 0x5F, 0xB0, 0x02, 0x0C, 0x30, 0x40, 0x70, 0x05, 0x00 },  //  38 INSTRUMENT_PIPEORG
+		{ 0x31, 0x46, 0xC0, 0x02, 0x01, 0x31, 0x80, 0x60, 0x05, 0x00 },  //  39 INSTRUMENT_PIPEORG
+		{ 0x21, 0x93, 0xC8, 0x15, 0x0C, 0x31, 0x00, 0x6F, 0x05, 0x00 },  //  40 INSTRUMENT_REEDORG
+		{ 0x31, 0x16, 0xCF, 0x05, 0x01, 0x32, 0x87, 0x7F, 0x05, 0x00 },  //  41 INSTRUMENT_REEDORG
+		{ 0x23, 0xAC, 0x72, 0x1A, 0x00, 0x21, 0x83, 0x72, 0x2A, 0x07 },  //  42 INSTRUMENT_ACORDIAN
+		{ 0x23, 0x22, 0x62, 0x1A, 0x01, 0xA1, 0x00, 0x62, 0x2A, 0x04 },  //  43 INSTRUMENT_ACORDIAN
+		{ 0x25, 0xA1, 0xFF, 0x06, 0x0A, 0x23, 0x2F, 0xFF, 0x05, 0x00 },  //  44 INSTRUMENT_HARMONIC
+		{ 0xA1, 0x1F, 0xFF, 0x05, 0x00, 0x22, 0x80, 0x6F, 0x09, 0x04 },  //  45 INSTRUMENT_HARMONIC
+		{ 0x23, 0x19, 0x62, 0x1A, 0x0C, 0x21, 0x80, 0x72, 0x2A, 0x01 },  //  46 INSTRUMENT_BANDNEON
+		{ 0x23, 0x1E, 0x62, 0x1A, 0x01, 0x22, 0x83, 0x72, 0x2A, 0x04 },  //  47 INSTRUMENT_BANDNEON
+		{ 0x02, 0x9C, 0xF3, 0x74, 0x0A, 0x41, 0x80, 0xF3, 0xB8, 0x00 },  //  48 INSTRUMENT_NYLONGT
+		{ 0x02, 0xA5, 0xD3, 0x74, 0x01, 0x82, 0x40, 0xD3, 0xB8, 0x02 },  //  49 INSTRUMENT_NYLONGT
+		{ 0x34, 0x5B, 0xF2, 0xF6, 0x0C, 0x31, 0x9E, 0xF2, 0xF7, 0x02 },  //  50 INSTRUMENT_STEELGT
+		{ 0x23, 0xAB, 0xF2, 0xF7, 0x00, 0x11, 0x00, 0xF1, 0xE7, 0x00 },  //  51 INSTRUMENT_STEELGT
+		{ 0x22, 0x53, 0xF3, 0xFA, 0x0A, 0x23, 0x66, 0xF2, 0xFA, 0x00 },  //  52 INSTRUMENT_JAZZGT
+		{ 0x21, 0xA7, 0xC2, 0xFA, 0x00, 0x21, 0x00, 0xC2, 0xF7, 0x00 },  //  53 INSTRUMENT_JAZZGT
+		{ 0x02, 0x4C, 0xFA, 0x22, 0x08, 0x01, 0x97, 0xF3, 0xF3, 0x00 },  //  54 INSTRUMENT_CLEANGT
+		{ 0x04, 0x9D, 0xC2, 0xF3, 0x00, 0x11, 0x00, 0xC1, 0xF7, 0x01 },  //  55 INSTRUMENT_CLEANGT
+		{ 0x11, 0x87, 0xC7, 0xAF, 0x08, 0x01, 0x00, 0xF5, 0xF8, 0x00 },  //  56 INSTRUMENT_MUTEGT
+		{ 0x01, 0x18, 0xC3, 0x98, 0x01, 0x02, 0x00, 0xC3, 0xF8, 0x00 },  //  57 INSTRUMENT_MUTEGT
+		{ 0x13, 0x0D, 0xB9, 0xF2, 0x0A, 0x02, 0x1A, 0x91, 0x11, 0x04 },  //  58 INSTRUMENT_OVERDGT
+		{ 0x21, 0x99, 0x92, 0x4A, 0x00, 0x22, 0x00, 0x91, 0x2A, 0x01 },  //  59 INSTRUMENT_OVERDGT
+		{ 0x23, 0x96, 0xF8, 0x42, 0x00, 0x22, 0x1A, 0x91, 0xFA, 0x22 },  //  60 INSTRUMENT_DISTGT
+		{ 0x21, 0x99, 0x92, 0xBA, 0x00, 0x22, 0x00, 0x91, 0x4A, 0x00 },  //  61 INSTRUMENT_DISTGT
+		{ 0x09, 0xA1, 0x20, 0x4F, 0x08, 0x04, 0x80, 0xD1, 0xF8, 0x00 },  //  62 INSTRUMENT_GTHARMS
+		{ 0x02, 0x87, 0xF8, 0xF8, 0x01, 0x02, 0x00, 0xF6, 0xF8, 0x02 },  //  63 INSTRUMENT_GTHARMS
+		{ 0x01, 0x4D, 0xA7, 0x15, 0x02, 0x01, 0x00, 0xA3, 0xC8, 0x00 },  //  64 INSTRUMENT_ACOUBASS
+		{ 0x01, 0x93, 0x71, 0x31, 0x01, 0x01, 0x00, 0x73, 0xC8, 0x00 },  //  65 INSTRUMENT_ACOUBASS
+		{ 0x11, 0xA8, 0xF1, 0xE5, 0x04, 0x12, 0x57, 0xF3, 0xE5, 0x00 },  //  66 INSTRUMENT_FINGBASS
+		{ 0x11, 0x97, 0xE1, 0xE5, 0x00, 0x11, 0x00, 0xE1, 0xE6, 0x00 },  //  67 INSTRUMENT_FINGBASS
+		{ 0x01, 0xB3, 0xF0, 0xC7, 0x06, 0x01, 0x16, 0xF1, 0x27, 0x00 },  //  68 INSTRUMENT_PICKBASS
+		{ 0x01, 0x16, 0xF1, 0x27, 0x00, 0x01, 0x00, 0xF1, 0x28, 0x00 },  //  69 INSTRUMENT_PICKBASS
+		{ 0x31, 0x5B, 0x51, 0x28, 0x0C, 0x32, 0x00, 0x71, 0x48, 0x00 },  //  70 INSTRUMENT_FRETLESS
+		{ 0x31, 0x19, 0x71, 0x48, 0x01, 0x31, 0x00, 0x71, 0x48, 0x00 },  //  71 INSTRUMENT_FRETLESS
+		{ 0x01, 0x8B, 0xA1, 0x9A, 0x08, 0x21, 0x40, 0xF2, 0xDF, 0x00 },  //  72 INSTRUMENT_SLAPBAS1
+		{ 0x04, 0x0B, 0xF9, 0xDA, 0x01, 0x01, 0x80, 0xF7, 0xDF, 0x00 },  //  73 INSTRUMENT_SLAPBAS1
+		{ 0x01, 0x89, 0xA1, 0x9A, 0x06, 0x21, 0x40, 0xF2, 0xDF, 0x00 },  //  74 INSTRUMENT_SLAPBAS2
+		{ 0x04, 0x0B, 0xF9, 0xDA, 0x01, 0x01, 0x80, 0xF7, 0xDF, 0x00 },  //  75 INSTRUMENT_SLAPBAS2
+		{ 0x21, 0x1C, 0xF6, 0xC8, 0x0A, 0x01, 0x1F, 0xF1, 0xC8, 0x00 },  //  76 INSTRUMENT_SYNBASS1
+		{ 0x01, 0xD8, 0xF1, 0xC8, 0x00, 0x01, 0x00, 0xF2, 0xC8, 0x00 },  //  77 INSTRUMENT_SYNBASS1
+		{ 0x21, 0x1C, 0xF6, 0xC8, 0x0A, 0x01, 0x1F, 0xF1, 0xC8, 0x01 },  //  78 INSTRUMENT_SYNBASS2
+		{ 0x01, 0x12, 0x54, 0x42, 0x00, 0x01, 0x00, 0xF2, 0xC8, 0x00 },  //  79 INSTRUMENT_SYNBASS2
+		{ 0x31, 0x15, 0xDD, 0x13, 0x08, 0x21, 0x00, 0x56, 0x26, 0x01 },  //  80 INSTRUMENT_VIOLIN
+		{ 0x12, 0x95, 0x8D, 0x03, 0x01, 0x03, 0x8B, 0x65, 0x86, 0x01 },  //  81 INSTRUMENT_VIOLIN
+		{ 0x31, 0x17, 0xDD, 0x13, 0x08, 0x21, 0x00, 0x56, 0x26, 0x01 },  //  82 INSTRUMENT_VIOLA
+		{ 0x12, 0x95, 0x8D, 0x03, 0x01, 0x03, 0x8B, 0x65, 0x86, 0x01 },  //  83 INSTRUMENT_VIOLA
+		{ 0x31, 0x95, 0xDD, 0x13, 0x08, 0x21, 0x00, 0x56, 0x26, 0x05 },  //  84 INSTRUMENT_CELLO
+		{ 0x13, 0x95, 0x8D, 0x03, 0x01, 0x05, 0x8C, 0x66, 0x86, 0x01 },  //  85 INSTRUMENT_CELLO
+		{ 0x70, 0x92, 0xCC, 0x43, 0x0E, 0xA0, 0x03, 0x74, 0x17, 0x22 },  //  86 INSTRUMENT_CONTRAB
+		{ 0x21, 0x95, 0xBF, 0x07, 0x01, 0x21, 0x00, 0x6F, 0x07, 0x10 },  //  87 INSTRUMENT_CONTRAB
+		{ 0x61, 0x97, 0xC2, 0x15, 0x06, 0xA1, 0x00, 0x6F, 0x05, 0x05 },  //  88 INSTRUMENT_TREMSTR
+		{ 0x63, 0x13, 0xB5, 0x8F, 0x01, 0xA5, 0x94, 0xB5, 0x8F, 0x00 },  //  89 INSTRUMENT_TREMSTR
+		{ 0x23, 0xA7, 0x85, 0x84, 0x0E, 0x12, 0xA4, 0x82, 0x74, 0x00 },  //  90 INSTRUMENT_PIZZ
+		{ 0x02, 0x27, 0x82, 0x74, 0x00, 0x11, 0x00, 0x85, 0x35, 0x00 },  //  91 INSTRUMENT_PIZZ
+		{ 0x23, 0xA7, 0x85, 0x84, 0x0E, 0x12, 0xA4, 0x82, 0x74, 0x00 },  //  92 INSTRUMENT_HARP
+		{ 0x02, 0x27, 0x82, 0x74, 0x00, 0x11, 0x00, 0x84, 0x33, 0x00 },  //  93 INSTRUMENT_HARP
+		{ 0x10, 0x41, 0xF5, 0x05, 0x02, 0x11, 0x00, 0xF2, 0xC3, 0x01 },  //  94 INSTRUMENT_TIMPANI
+		{ 0x11, 0x01, 0xF5, 0x05, 0x01, 0x12, 0x1E, 0xF2, 0xC3, 0x00 },  //  95 INSTRUMENT_TIMPANI
+		{ 0x30, 0x98, 0x61, 0x03, 0x0E, 0xA0, 0x03, 0x64, 0x17, 0x22 },  //  96 INSTRUMENT_STRINGS
+		{ 0x61, 0x92, 0x65, 0x17, 0x01, 0x21, 0x00, 0x65, 0x17, 0x01 },  //  97 INSTRUMENT_STRINGS
+		{ 0x30, 0x98, 0x41, 0x23, 0x0E, 0x60, 0x01, 0x44, 0x17, 0x22 },  //  98 INSTRUMENT_SLOWSTR
+		{ 0xA1, 0x98, 0x7F, 0x03, 0x01, 0x21, 0x00, 0x3F, 0x07, 0x11 },  //  99 INSTRUMENT_SLOWSTR
+		{ 0x21, 0x1A, 0xC1, 0x12, 0x0C, 0x61, 0x00, 0x4F, 0x05, 0x00 },  // 100 INSTRUMENT_SYNSTR1
+		{ 0xA1, 0x93, 0xC1, 0x12, 0x01, 0x21, 0x00, 0x4F, 0x05, 0x00 },  // 101 INSTRUMENT_SYNSTR1
+		{ 0x21, 0x18, 0xC1, 0x22, 0x0C, 0x61, 0x00, 0x4F, 0x05, 0x00 },  // 102 INSTRUMENT_SYNSTR2
+		{ 0x22, 0x0B, 0xC1, 0x22, 0x01, 0x22, 0x1C, 0x4F, 0x05, 0x00 },  // 103 INSTRUMENT_SYNSTR2
+		{ 0x06, 0x03, 0xA0, 0xF5, 0x0E, 0xE4, 0x23, 0xA3, 0x35, 0x00 },  // 104 INSTRUMENT_CHOIR
+		{ 0xA1, 0x51, 0x7F, 0x07, 0x01, 0x61, 0x00, 0x7F, 0x07, 0x00 },  // 105 INSTRUMENT_CHOIR
+		{ 0x02, 0x05, 0x84, 0x57, 0x0E, 0xE4, 0x16, 0xA7, 0x74, 0x00 },  // 106 INSTRUMENT_OOHS
+		{ 0xA1, 0x90, 0x74, 0x39, 0x01, 0x61, 0x00, 0x71, 0x67, 0x00 },  // 107 INSTRUMENT_OOHS
+		{ 0x0A, 0x65, 0x99, 0x54, 0x08, 0x07, 0x60, 0x97, 0x63, 0x00 },  // 108 INSTRUMENT_SYNVOX
+		{ 0xA1, 0x59, 0x5F, 0x04, 0x00, 0x61, 0x00, 0x6F, 0x06, 0x01 },  // 109 INSTRUMENT_SYNVOX
+		{ 0x00, 0x00, 0x65, 0x68, 0x0B, 0x00, 0x00, 0xC5, 0x13, 0x62 },  // 110 INSTRUMENT_ORCHIT
+		{ 0x00, 0x00, 0xC8, 0x06, 0x01, 0x00, 0x00, 0x74, 0x07, 0x36 },  // 111 INSTRUMENT_ORCHIT
+		{ 0x21, 0x92, 0x85, 0x17, 0x0C, 0x21, 0x01, 0x8F, 0x09, 0x00 },  // 112 INSTRUMENT_TRUMPET
+		{ 0x21, 0x15, 0x84, 0x17, 0x01, 0x61, 0x0B, 0xAF, 0x08, 0x00 },  // 113 INSTRUMENT_TRUMPET
+		{ 0x21, 0x94, 0x85, 0x17, 0x0C, 0x21, 0x05, 0x7F, 0x09, 0x00 },  // 114 INSTRUMENT_TROMBONE
+		{ 0x21, 0x15, 0x84, 0x17, 0x01, 0x61, 0x0D, 0xAF, 0x08, 0x00 },  // 115 INSTRUMENT_TROMBONE
+		{ 0x20, 0x94, 0x76, 0x15, 0x0C, 0x61, 0x00, 0x82, 0x37, 0x00 },  // 116 INSTRUMENT_TUBA
+		{ 0xB1, 0xD3, 0x61, 0x26, 0x01, 0x71, 0x80, 0x61, 0x26, 0x00 },  // 117 INSTRUMENT_TUBA
+		{ 0x31, 0x15, 0x71, 0x27, 0x0C, 0x61, 0x83, 0x91, 0x49, 0x01 },  // 118 INSTRUMENT_MUTETRP
+		{ 0xB1, 0x10, 0x7D, 0x27, 0x01, 0x21, 0x08, 0x7A, 0x29, 0x00 },  // 119 INSTRUMENT_MUTETRP
+		{ 0x21, 0x9F, 0x63, 0x0A, 0x0E, 0x21, 0x00, 0x7F, 0x0B, 0x00 },  // 120 INSTRUMENT_FRHORN
+		{ 0xA1, 0xA2, 0x65, 0x0A, 0x01, 0x61, 0x00, 0x7F, 0x0B, 0x00 },  // 121 INSTRUMENT_FRHORN
+		{ 0x21, 0x16, 0x72, 0x25, 0x0C, 0x21, 0x05, 0x7F, 0x0A, 0x00 },  // 122 INSTRUMENT_BRASS1
+		{ 0x21, 0x1D, 0x7A, 0x35, 0x01, 0x21, 0x09, 0x7A, 0x3A, 0x00 },  // 123 INSTRUMENT_BRASS1
+		{ 0x21, 0x16, 0xC2, 0x35, 0x0E, 0x61, 0x09, 0xCF, 0x0A, 0x00 },  // 124 INSTRUMENT_SYNBRAS1
+		{ 0xA1, 0x8A, 0x74, 0x45, 0x01, 0x21, 0x00, 0x7F, 0x08, 0x00 },  // 125 INSTRUMENT_SYNBRAS1
+		{ 0xA1, 0x97, 0x52, 0x1A, 0x0C, 0x61, 0x00, 0x8F, 0x1B, 0x00 },  // 126 INSTRUMENT_SYNBRAS2
+		{ 0x21, 0xA1, 0x75, 0x1A, 0x01, 0x21, 0x00, 0x8F, 0x1B, 0x00 },  // 127 INSTRUMENT_SYNBRAS2
+		{ 0x31, 0x96, 0x93, 0x0F, 0x08, 0xA1, 0x00, 0x72, 0x0F, 0x02 },  // 128 INSTRUMENT_SOPSAX
+		{ 0x21, 0x96, 0x85, 0x07, 0x01, 0x31, 0x00, 0x84, 0x27, 0x10 },  // 129 INSTRUMENT_SOPSAX
+		{ 0x31, 0x8E, 0x93, 0x03, 0x08, 0xA1, 0x00, 0x72, 0x09, 0x01 },  // 130 INSTRUMENT_ALTOSAX
+		{ 0x24, 0xA1, 0xC5, 0x06, 0x01, 0x31, 0x00, 0x64, 0x27, 0x10 },  // 131 INSTRUMENT_ALTOSAX
+		{ 0xB1, 0x8E, 0x93, 0x06, 0x0A, 0x71, 0x00, 0x72, 0x06, 0x01 },  // 132 INSTRUMENT_TENSAX
+		{ 0x21, 0x5D, 0x85, 0x08, 0x01, 0xB1, 0x00, 0x84, 0x28, 0x00 },  // 133 INSTRUMENT_TENSAX
+		{ 0x31, 0x93, 0x93, 0x0F, 0x0C, 0x72, 0x00, 0x72, 0x0F, 0x01 },  // 134 INSTRUMENT_BARISAX
+		{ 0x22, 0x61, 0x85, 0x06, 0x01, 0xB1, 0x00, 0x84, 0x16, 0x00 },  // 135 INSTRUMENT_BARISAX
+		{ 0x61, 0xA3, 0xA9, 0x2A, 0x08, 0x23, 0x52, 0xA8, 0x36, 0x00 },  // 136 INSTRUMENT_OBOE
+		{ 0xA1, 0x94, 0xAA, 0x16, 0x00, 0x21, 0x80, 0x8F, 0x0A, 0x00 },  // 137 INSTRUMENT_OBOE
+		{ 0x21, 0x21, 0x77, 0x29, 0x02, 0x33, 0x55, 0x7A, 0x26, 0x10 },  // 138 INSTRUMENT_ENGLHORN
+		{ 0xA1, 0x93, 0x7A, 0x16, 0x00, 0x22, 0x00, 0x7A, 0x19, 0x00 },  // 139 INSTRUMENT_ENGLHORN
+		{ 0x21, 0x2B, 0x7B, 0x07, 0x0A, 0x22, 0x57, 0x7F, 0x00, 0x01 },  // 140 INSTRUMENT_BASSOON
+		{ 0x31, 0x51, 0x75, 0x19, 0x00, 0x72, 0x00, 0x61, 0x19, 0x00 },  // 141 INSTRUMENT_BASSOON
+		{ 0x32, 0x90, 0x9B, 0x21, 0x08, 0x21, 0x00, 0x72, 0x17, 0x00 },  // 142 INSTRUMENT_CLARINET
+		{ 0x32, 0x90, 0x9B, 0x21, 0x01, 0x21, 0x13, 0x72, 0x17, 0x00 },  // 143 INSTRUMENT_CLARINET
+		{ 0x25, 0x00, 0xDA, 0x11, 0x0C, 0xE3, 0x2B, 0xA6, 0x68, 0x00 },  // 144 INSTRUMENT_PICCOLO
+		{ 0xE1, 0x1F, 0x85, 0x5F, 0x01, 0xE1, 0x00, 0x65, 0x1A, 0x00 },  // 145 INSTRUMENT_PICCOLO
+		{ 0x25, 0x00, 0xDA, 0x11, 0x0C, 0xE3, 0x2B, 0xA6, 0x68, 0x00 },  // 146 INSTRUMENT_FLUTE1
+		{ 0xE1, 0x46, 0x88, 0x5F, 0x01, 0xE1, 0x00, 0x65, 0x1A, 0x00 },  // 147 INSTRUMENT_FLUTE1
+		{ 0xA4, 0xA2, 0xC9, 0x29, 0x0C, 0x21, 0x80, 0x6F, 0x08, 0x00 },  // 148 INSTRUMENT_RECORDER
+		{ 0xA2, 0xAA, 0xCA, 0x15, 0x01, 0x21, 0x00, 0x6F, 0x08, 0x00 },  // 149 INSTRUMENT_RECORDER
+		{ 0x25, 0x00, 0xDA, 0x11, 0x0C, 0x23, 0x1E, 0xA6, 0x68, 0x00 },  // 150 INSTRUMENT_PANFLUTE
+		{ 0x21, 0x8C, 0x88, 0x58, 0x01, 0x21, 0x00, 0x65, 0x1A, 0x00 },  // 151 INSTRUMENT_PANFLUTE
+		{ 0xA1, 0x0D, 0x76, 0xC6, 0x0F, 0x26, 0x59, 0x87, 0x86, 0x00 },  // 152 INSTRUMENT_BOTTLEB
+		{ 0x22, 0x56, 0x66, 0x56, 0x00, 0xA1, 0x00, 0x65, 0x26, 0x00 },  // 153 INSTRUMENT_BOTTLEB
+		{ 0x26, 0x00, 0x9F, 0x01, 0x0E, 0x64, 0x25, 0x76, 0x48, 0x00 },  // 154 INSTRUMENT_SHAKU
+		{ 0x22, 0xCB, 0x56, 0x46, 0x01, 0xA1, 0x00, 0x45, 0x36, 0x00 },  // 155 INSTRUMENT_SHAKU
+		{ 0xE1, 0x67, 0x67, 0x14, 0x0C, 0x61, 0x00, 0x54, 0x17, 0x01 },  // 156 INSTRUMENT_WHISTLE
+		{ 0x21, 0x6D, 0x67, 0x14, 0x01, 0x21, 0x00, 0x44, 0x16, 0x01 },  // 157 INSTRUMENT_WHISTLE
+		{ 0x26, 0x00, 0xDF, 0x01, 0x0C, 0xE4, 0x2B, 0x76, 0x38, 0x00 },  // 158 INSTRUMENT_OCARINA
+		{ 0x22, 0xD8, 0x95, 0x36, 0x01, 0xE1, 0x00, 0x76, 0x07, 0x00 },  // 159 INSTRUMENT_OCARINA
+		{ 0x21, 0x35, 0xFF, 0x0F, 0x04, 0x21, 0xB7, 0xFF, 0x0F, 0x00 },  // 160 INSTRUMENT_SQUARWAV
+		{ 0x21, 0xB9, 0xFF, 0x0F, 0x00, 0x21, 0x80, 0xFF, 0x0F, 0x60 },  // 161 INSTRUMENT_SQUARWAV
+		{ 0x21, 0x36, 0xFF, 0x0F, 0x0A, 0x21, 0x1B, 0xFF, 0x0F, 0x00 },  // 162 INSTRUMENT_SAWWAV
+		{ 0x21, 0x1D, 0xFF, 0x0F, 0x00, 0x61, 0x00, 0xCF, 0x09, 0x40 },  // 163 INSTRUMENT_SAWWAV
+		{ 0xA3, 0x00, 0xC4, 0x87, 0x0E, 0x26, 0x57, 0xC6, 0x76, 0x00 },  // 164 INSTRUMENT_SYNCALLI
+		{ 0x22, 0x46, 0x86, 0x55, 0x01, 0x21, 0x80, 0x64, 0x18, 0x00 },  // 165 INSTRUMENT_SYNCALLI
+		{ 0x21, 0x48, 0xA3, 0x4A, 0x08, 0x21, 0x00, 0x86, 0x0A, 0x00 },  // 166 INSTRUMENT_CHIFLEAD
+		{ 0x21, 0x45, 0x66, 0x12, 0x01, 0x21, 0x00, 0x96, 0x0A, 0x00 },  // 167 INSTRUMENT_CHIFLEAD
+		{ 0x12, 0x0D, 0xB9, 0xF2, 0x0A, 0x01, 0x1A, 0x91, 0x11, 0x04 },  // 168 INSTRUMENT_CHARANG
+		{ 0x21, 0x99, 0x92, 0x2A, 0x00, 0x22, 0x00, 0x91, 0x2A, 0x01 },  // 169 INSTRUMENT_CHARANG
+		{ 0x61, 0x40, 0x7D, 0x15, 0x0E, 0xB1, 0xA3, 0x72, 0x15, 0x00 },  // 170 INSTRUMENT_SOLOVOX
+		{ 0xA2, 0x5D, 0xDF, 0x05, 0x01, 0x61, 0x40, 0x7F, 0x07, 0x00 },  // 171 INSTRUMENT_SOLOVOX
+		{ 0x20, 0x36, 0xFF, 0x01, 0x08, 0x61, 0x00, 0x8F, 0x06, 0x40 },  // 172 INSTRUMENT_FIFTHSAW
+		{ 0x21, 0x27, 0xFF, 0x0F, 0x01, 0x61, 0x00, 0x8F, 0x07, 0x40 },  // 173 INSTRUMENT_FIFTHSAW
+		{ 0x21, 0x8F, 0xF1, 0x29, 0x0A, 0x21, 0x80, 0xF4, 0x09, 0x00 },  // 174 INSTRUMENT_BASSLEAD
+		{ 0x21, 0x1D, 0xF1, 0x09, 0x01, 0x21, 0x80, 0xF1, 0x09, 0x11 },  // 175 INSTRUMENT_BASSLEAD
+		{ 0x17, 0x1A, 0x53, 0x03, 0x02, 0x08, 0x0D, 0xF6, 0x04, 0x01 },  // 176 INSTRUMENT_FANTASIA
+		{ 0xA1, 0x9D, 0x41, 0x32, 0x01, 0x61, 0x00, 0x61, 0x15, 0x00 },  // 177 INSTRUMENT_FANTASIA
+		{ 0x61, 0x1F, 0xA8, 0x11, 0x0A, 0xB1, 0x80, 0x25, 0x03, 0x00 },  // 178 INSTRUMENT_WARMPAD
+		{ 0x81, 0xA1, 0xA1, 0x31, 0x01, 0x71, 0x00, 0x25, 0x03, 0x00 },  // 179 INSTRUMENT_WARMPAD
+		{ 0x61, 0x17, 0x11, 0x14, 0x0C, 0x61, 0x00, 0x55, 0x16, 0x00 },  // 180 INSTRUMENT_POLYSYN
+		{ 0x61, 0x14, 0xC3, 0x45, 0x01, 0x61, 0x00, 0xC3, 0x25, 0x04 },  // 181 INSTRUMENT_POLYSYN
+		{ 0x2A, 0x80, 0x54, 0x21, 0x0E, 0x27, 0xA6, 0x6A, 0x13, 0x00 },  // 182 INSTRUMENT_SPACEVOX
+		{ 0x31, 0x5D, 0x54, 0x01, 0x01, 0x72, 0x00, 0x6A, 0x03, 0x00 },  // 183 INSTRUMENT_SPACEVOX
+		{ 0x21, 0x97, 0x21, 0x33, 0x08, 0x22, 0x03, 0x42, 0x45, 0x00 },  // 184 INSTRUMENT_BOWEDGLS
+		{ 0xA1, 0x99, 0x21, 0xD4, 0x01, 0x21, 0x03, 0x42, 0xD5, 0x00 },  // 185 INSTRUMENT_BOWEDGLS
+		{ 0x21, 0x8D, 0x61, 0x33, 0x0A, 0x61, 0x03, 0x42, 0x35, 0x00 },  // 186 INSTRUMENT_METALPAD
+		{ 0xA1, 0x1C, 0xA1, 0x77, 0x01, 0x21, 0x00, 0x31, 0x47, 0x11 },  // 187 INSTRUMENT_METALPAD
+		{ 0x21, 0x89, 0x11, 0x33, 0x0A, 0x61, 0x03, 0x42, 0x35, 0x00 },  // 188 INSTRUMENT_HALOPAD
+		{ 0x21, 0x8C, 0x21, 0xE4, 0x01, 0x61, 0x03, 0x42, 0xD5, 0x00 },  // 189 INSTRUMENT_HALOPAD
+		{ 0x21, 0x15, 0x11, 0x47, 0x00, 0x21, 0x00, 0xCF, 0x07, 0x01 },  // 190 INSTRUMENT_SWEEPPAD
+		{ 0x21, 0x8C, 0x11, 0xE4, 0x01, 0x61, 0x00, 0x52, 0xD5, 0x00 },  // 191 INSTRUMENT_SWEEPPAD
+		{ 0x0F, 0x83, 0xFE, 0x8A, 0x0C, 0x04, 0x85, 0xFB, 0x06, 0x05 },  // 192 INSTRUMENT_ICERAIN
+		{ 0x21, 0x99, 0xA8, 0x03, 0x01, 0x22, 0x00, 0xA7, 0x04, 0x00 },  // 193 INSTRUMENT_ICERAIN
+		{ 0x21, 0x8C, 0x21, 0x32, 0x06, 0x20, 0x97, 0x32, 0x13, 0x02 },  // 194 INSTRUMENT_SOUNDTRK
+		{ 0x21, 0x0E, 0x11, 0x03, 0x01, 0x21, 0x00, 0x31, 0x13, 0x01 },  // 195 INSTRUMENT_SOUNDTRK
+		{ 0x01, 0x61, 0x75, 0x93, 0x08, 0x02, 0x80, 0xC5, 0xB4, 0x00 },  // 196 INSTRUMENT_CRYSTAL
+		{ 0x06, 0x5B, 0x74, 0x95, 0x01, 0x01, 0x00, 0xA5, 0x72, 0x00 },  // 197 INSTRUMENT_CRYSTAL
+		{ 0x22, 0x92, 0xB2, 0x56, 0x0C, 0x61, 0x8A, 0xF2, 0x56, 0x00 },  // 198 INSTRUMENT_ATMOSPH
+		{ 0x21, 0x9D, 0x31, 0x34, 0x01, 0xA1, 0x80, 0x32, 0x05, 0x02 },  // 199 INSTRUMENT_ATMOSPH
+		{ 0x24, 0x40, 0xA3, 0x88, 0x0E, 0x22, 0x5B, 0xA3, 0x87, 0x00 },  // 200 INSTRUMENT_BRIGHT
+		{ 0x01, 0x13, 0xF1, 0x51, 0x01, 0x41, 0x00, 0xF2, 0xF5, 0x01 },  // 201 INSTRUMENT_BRIGHT
+		{ 0xA1, 0x10, 0x11, 0x42, 0x0A, 0x61, 0x92, 0x11, 0x73, 0x00 },  // 202 INSTRUMENT_GOBLIN
+		{ 0x61, 0x98, 0x11, 0x21, 0x01, 0xA1, 0x80, 0x1D, 0x03, 0x00 },  // 203 INSTRUMENT_GOBLIN
+		{ 0x62, 0x57, 0x7D, 0x16, 0x04, 0xA2, 0x80, 0x72, 0x16, 0x00 },  // 204 INSTRUMENT_ECHODROP
+		{ 0x61, 0x5B, 0x9F, 0x06, 0x01, 0xA1, 0x00, 0x9F, 0x04, 0x00 },  // 205 INSTRUMENT_ECHODROP
+		{ 0x38, 0x9F, 0xA2, 0x24, 0x06, 0x31, 0x9C, 0xF2, 0x24, 0x00 },  // 206 INSTRUMENT_STARTHEM
+		{ 0x23, 0x9F, 0xF1, 0x14, 0x00, 0x61, 0x00, 0x81, 0x23, 0x00 },  // 207 INSTRUMENT_STARTHEM
+		{ 0x01, 0x46, 0xF3, 0x53, 0x00, 0x01, 0x80, 0xF1, 0xF6, 0x10 },  // 208 INSTRUMENT_SITAR
+		{ 0x01, 0x43, 0xF2, 0x53, 0x01, 0x08, 0x40, 0xF2, 0xF6, 0x00 },  // 209 INSTRUMENT_SITAR
+		{ 0x11, 0x10, 0xA5, 0x35, 0x00, 0x17, 0xA4, 0xA5, 0x33, 0x11 },  // 210 INSTRUMENT_BANJO
+		{ 0x11, 0x0D, 0xF6, 0x41, 0x00, 0x11, 0x00, 0xF2, 0xE5, 0x21 },  // 211 INSTRUMENT_BANJO
+		{ 0x55, 0x92, 0xF7, 0xF8, 0x0E, 0x52, 0x9F, 0xF7, 0xE4, 0x10 },  // 212 INSTRUMENT_SHAMISEN
+		{ 0x41, 0x13, 0xF3, 0xE4, 0x00, 0x51, 0x00, 0xF3, 0xE5, 0x10 },  // 213 INSTRUMENT_SHAMISEN
+		{ 0x93, 0x91, 0xD4, 0x32, 0x08, 0x11, 0x00, 0xEB, 0x11, 0x10 },  // 214 INSTRUMENT_KOTO
+		{ 0x53, 0x91, 0xD4, 0x32, 0x01, 0x13, 0x0D, 0xEB, 0x12, 0x10 },  // 215 INSTRUMENT_KOTO
+		{ 0x04, 0x4F, 0xFA, 0x56, 0x0C, 0x01, 0x00, 0xC2, 0x05, 0x00 },  // 216 INSTRUMENT_KALIMBA
+		{ 0x20, 0x00, 0xF7, 0xE5, 0x01, 0x21, 0x0C, 0xF5, 0xE5, 0x03 },  // 217 INSTRUMENT_KALIMBA
+		{ 0x21, 0x49, 0x7C, 0x20, 0x06, 0x22, 0x00, 0x6F, 0x0C, 0x10 },  // 218 INSTRUMENT_BAGPIPE
+		{ 0x21, 0x09, 0x7C, 0x20, 0x01, 0x22, 0x09, 0x6F, 0x0C, 0x10 },  // 219 INSTRUMENT_BAGPIPE
+		{ 0x31, 0x85, 0xDD, 0x33, 0x0A, 0x21, 0x00, 0x56, 0x16, 0x01 },  // 220 INSTRUMENT_FIDDLE
+		{ 0x02, 0x83, 0xDD, 0x33, 0x01, 0x01, 0x80, 0x66, 0x16, 0x01 },  // 221 INSTRUMENT_FIDDLE
+		{ 0x61, 0x33, 0x89, 0x29, 0x06, 0xA3, 0xA4, 0xD8, 0x06, 0x40 },  // 222 INSTRUMENT_SHANNAI
+		{ 0x21, 0x17, 0xDA, 0x05, 0x00, 0x22, 0x80, 0x8F, 0x0B, 0x00 },  // 223 INSTRUMENT_SHANNAI
+		{ 0x05, 0x6A, 0xF1, 0xE5, 0x06, 0x03, 0x80, 0xC3, 0xE5, 0x00 },  // 224 INSTRUMENT_TINKLBEL
+		{ 0x01, 0x71, 0xC6, 0x53, 0x01, 0x83, 0x40, 0xF5, 0xD5, 0x00 },  // 225 INSTRUMENT_TINKLBEL
+		{ 0x08, 0x15, 0xEC, 0x26, 0x0A, 0x04, 0x00, 0xF8, 0x16, 0x00 },  // 226 INSTRUMENT_AGOGO
+		{ 0x07, 0x15, 0xEC, 0x26, 0x01, 0x02, 0x00, 0xF8, 0x16, 0x00 },  // 227 INSTRUMENT_AGOGO
+		{ 0x2C, 0xAB, 0x68, 0x24, 0x00, 0x01, 0x00, 0xDF, 0x35, 0x00 },  // 228 INSTRUMENT_STEELDRM
+		{ 0x05, 0x9D, 0x67, 0x35, 0x01, 0x01, 0x00, 0xDF, 0x05, 0x00 },  // 229 INSTRUMENT_STEELDRM
+		{ 0x15, 0x11, 0xFA, 0xFC, 0x0A, 0x12, 0x80, 0xFA, 0xEC, 0x04 },  // 230 INSTRUMENT_WOODBLOK
+		{ 0x18, 0x9D, 0xFA, 0xFC, 0x01, 0x12, 0x00, 0xF8, 0xE5, 0x00 },  // 231 INSTRUMENT_WOODBLOK
+		{ 0x10, 0x86, 0xA8, 0x07, 0x06, 0x00, 0x03, 0xFA, 0x03, 0x00 },  // 232 INSTRUMENT_TAIKO
+		{ 0x01, 0x5C, 0xA8, 0x07, 0x01, 0x00, 0x03, 0xF6, 0x83, 0x00 },  // 233 INSTRUMENT_TAIKO
+		{ 0x11, 0x8F, 0xF8, 0x58, 0x0E, 0x10, 0x00, 0xF3, 0xE5, 0x04 },  // 234 INSTRUMENT_MELOTOM
+		{ 0x10, 0x92, 0xF6, 0x54, 0x01, 0x10, 0x00, 0xF4, 0xE4, 0x01 },  // 235 INSTRUMENT_MELOTOM
+		{ 0x11, 0x86, 0xF8, 0x55, 0x0E, 0x10, 0x00, 0xF4, 0xE5, 0x04 },  // 236 INSTRUMENT_SYNDRUM
+		{ 0x11, 0x9C, 0xF3, 0x55, 0x01, 0x10, 0x00, 0xF4, 0xE5, 0x01 },  // 237 INSTRUMENT_SYNDRUM
+		{ 0x0F, 0x00, 0x1F, 0x00, 0x0E, 0xC0, 0x00, 0x1F, 0xF0, 0x30 },  // 238 INSTRUMENT_REVRSCYM
+		{ 0x0F, 0x3F, 0x1F, 0x00, 0x01, 0xC0, 0x3F, 0x1F, 0xF1, 0x30 },  // 239 INSTRUMENT_REVRSCYM
+		{ 0x06, 0x80, 0xF8, 0x24, 0x0E, 0x03, 0x88, 0x56, 0x84, 0x70 },  // 240 INSTRUMENT_FRETNOIS
+		{ 0x03, 0x1E, 0xD8, 0x24, 0x01, 0x04, 0x08, 0x66, 0x84, 0x70 },  // 241 INSTRUMENT_FRETNOIS
+		{ 0x06, 0x00, 0xFF, 0x01, 0x0E, 0x14, 0x00, 0x34, 0x04, 0x30 },  // 242 INSTRUMENT_BRTHNOIS
+		{ 0x01, 0x3F, 0x00, 0xF1, 0x01, 0x01, 0x3F, 0x00, 0xF1, 0x00 },  // 243 INSTRUMENT_BRTHNOIS
+		{ 0x26, 0x00, 0xFF, 0x01, 0x0E, 0x04, 0x00, 0x12, 0x84, 0x10 },  // 244 INSTRUMENT_SEASHORE
+		{ 0x01, 0x3F, 0x00, 0xF1, 0x01, 0x01, 0x3F, 0x00, 0xF1, 0x00 },  // 245 INSTRUMENT_SEASHORE
+		{ 0x48, 0x00, 0x68, 0xF8, 0x05, 0x01, 0x3F, 0x00, 0xF1, 0x00 },  // 246 INSTRUMENT_BIRDS
+		{ 0x47, 0x00, 0x67, 0xF8, 0x01, 0x4C, 0x00, 0x46, 0xF8, 0x00 },  // 247 INSTRUMENT_BIRDS
+		{ 0x35, 0x1C, 0xB2, 0x61, 0x0A, 0x14, 0x08, 0xF4, 0x15, 0x02 },  // 248 INSTRUMENT_TELEPHON
+		{ 0x11, 0x20, 0xFE, 0x15, 0x01, 0x87, 0xC0, 0xF4, 0x19, 0x07 },  // 249 INSTRUMENT_TELEPHON
+		{ 0xF0, 0x00, 0x2E, 0x11, 0x08, 0xE2, 0xC0, 0x21, 0x16, 0x11 },  // 250 INSTRUMENT_HELICOPT
+		{ 0xF0, 0x00, 0x2E, 0x11, 0x01, 0xE2, 0xC0, 0x21, 0x16, 0x17 },  // 251 INSTRUMENT_HELICOPT
+		{ 0x26, 0x00, 0xFF, 0x01, 0x0E, 0xE4, 0x00, 0x12, 0x16, 0x70 },  // 252 INSTRUMENT_APPLAUSE
+		{ 0x01, 0x3F, 0x00, 0xF1, 0x01, 0x01, 0x3F, 0x00, 0xF1, 0x00 },  // 253 INSTRUMENT_APPLAUSE
+		{ 0x00, 0x00, 0xF2, 0x59, 0x0E, 0x01, 0x00, 0xF7, 0x00, 0x00 },  // 254 INSTRUMENT_GUNSHOT
+		{ 0x01, 0x00, 0xF3, 0xF0, 0x00, 0x01, 0x00, 0xF6, 0xC9, 0x60 },  // 255 INSTRUMENT_GUNSHOT
+	};
+
+	const InstrumentTable midiInstrumentTable4OP = {
+		midiInstrumentTable4OPVoices[0], NULL, 128, 2, 0x00
+	};
+
+
+	// Instruments of midi_instruments2_4op.h.
+	const unsigned char midiInstrumentTable2_4OPVoices[256][10] PROGMEM = {
+		{ 0x23, 0x15, 0xFD, 0x7C, 0x00, 0x01, 0x08, 0x84, 0xF5, 0x03 },  //   0 INSTRUMENT_PIANO1
+		{ 0x03, 0x5D, 0xF2, 0x35, 0x01, 0x01, 0x08, 0xF4, 0xF5, 0x40 },  //   1 INSTRUMENT_PIANO1
+		{ 0x03, 0x7D, 0xF3, 0xF5, 0x00, 0x01, 0x08, 0xF3, 0xF5, 0x40 },  //   2 INSTRUMENT_PIANO2
+		{ 0x03, 0x55, 0xF2, 0xF5, 0x01, 0x01, 0x08, 0xF2, 0xF5, 0x40 },  //   3 INSTRUMENT_PIANO2
+		{ 0x03, 0x4D, 0xFB, 0x55, 0x00, 0x01, 0x08, 0xF3, 0xC5, 0x44 },  //   4 INSTRUMENT_PIANO3
+		{ 0x03, 0xCE, 0xF3, 0x55, 0x01, 0x01, 0x08, 0xF3, 0xD5, 0x40 },  //   5 INSTRUMENT_PIANO3
+		{ 0x03, 0xD7, 0xF3, 0xF5, 0x00, 0x01, 0x08, 0xF2, 0xF5, 0x44 },  //   6 INSTRUMENT_HONKTONK
+		{ 0x03, 0xD5, 0xF3, 0xF5, 0x01, 0x01, 0x08, 0xF3, 0xF5, 0x40 },  //   7 INSTRUMENT_HONKTONK
+		{ 0x16, 0x57, 0xFF, 0x8A, 0x0C, 0x01, 0x08, 0xF3, 0x66, 0x00 },  //   8 INSTRUMENT_EP1
+		{ 0x0B, 0x2B, 0xE5, 0xB5, 0x01, 0x81, 0x08, 0xE2, 0x86, 0x00 },  //   9 INSTRUMENT_EP1
+		{ 0x0A, 0x5F, 0xF4, 0x87, 0x00, 0x01, 0x08, 0xF4, 0x86, 0x00 },  //  10 INSTRUMENT_EP2
+		{ 0x03, 0xCC, 0xF2, 0x86, 0x01, 0x01, 0x08, 0xE2, 0x86, 0x00 },  //  11 INSTRUMENT_EP2
+		{ 0x22, 0xD1, 0xE3, 0x79, 0x04, 0x01, 0x88, 0xF3, 0xA7, 0x44 },  //  12 INSTRUMENT_HARPSIC
+		{ 0x22, 0x96, 0xF2, 0x79, 0x01, 0x01, 0x08, 0xF3, 0xA7, 0x44 },  //  13 INSTRUMENT_HARPSIC
+		{ 0x22, 0x9C, 0xF4, 0x19, 0x00, 0x01, 0x08, 0xF3, 0xA6, 0x55 },  //  14 INSTRUMENT_CLAVIC
+		{ 0x22, 0x97, 0xF4, 0x19, 0x01, 0x01, 0x08, 0xF3, 0xE6, 0x44 },  //  15 INSTRUMENT_CLAVIC
+		{ 0x1B, 0x5A, 0xF4, 0xF6, 0x00, 0x19, 0x09, 0xE3, 0xA2, 0x00 },  //  16 INSTRUMENT_CELESTA
+		{ 0x1A, 0x57, 0xF3, 0xB2, 0x01, 0x11, 0x08, 0xF2, 0xA3, 0x00 },  //  17 INSTRUMENT_CELESTA
+		{ 0x1B, 0x5A, 0xD6, 0x53, 0x00, 0x17, 0x0A, 0xF3, 0x53, 0x00 },  //  18 INSTRUMENT_GLOCK
+		{ 0x1A, 0x49, 0xD1, 0x52, 0x01, 0x11, 0x08, 0xF3, 0x52, 0x00 },  //  19 INSTRUMENT_GLOCK
+		{ 0x1B, 0x5A, 0xF6, 0xF6, 0x00, 0x14, 0x08, 0x63, 0xA3, 0x00 },  //  20 INSTRUMENT_MUSICBOX
+		{ 0x1B, 0x52, 0xD3, 0xB2, 0x01, 0x11, 0x08, 0xF2, 0xA3, 0x00 },  //  21 INSTRUMENT_MUSICBOX
+		{ 0x8B, 0x5A, 0xD7, 0x15, 0x00, 0x84, 0x08, 0xF1, 0x95, 0x00 },  //  22 INSTRUMENT_VIBES
+		{ 0x9B, 0x49, 0xDC, 0x25, 0x01, 0x81, 0x08, 0xD2, 0xB5, 0x00 },  //  23 INSTRUMENT_VIBES
+		{ 0x08, 0xC0, 0xFD, 0x56, 0x00, 0x01, 0x08, 0xF6, 0x68, 0x00 },  //  24 INSTRUMENT_MARIMBA
+		{ 0x95, 0x40, 0xFE, 0x27, 0x01, 0x81, 0x08, 0xF0, 0x05, 0x00 },  //  25 INSTRUMENT_MARIMBA
+		{ 0x08, 0xC0, 0xFA, 0x56, 0x00, 0x03, 0x08, 0xF8, 0x66, 0x00 },  //  26 INSTRUMENT_XYLO
+		{ 0x97, 0x40, 0xDF, 0x26, 0x01, 0x81, 0x08, 0xF8, 0x06, 0x00 },  //  27 INSTRUMENT_XYLO
+		{ 0x03, 0x95, 0xF3, 0x33, 0x00, 0x00, 0x88, 0xF3, 0x23, 0x00 },  //  28 INSTRUMENT_TUBEBELL
+		{ 0x03, 0x8C, 0xF4, 0x23, 0x01, 0x00, 0x88, 0xF3, 0x03, 0x00 },  //  29 INSTRUMENT_TUBEBELL
+		{ 0x01, 0x8B, 0xA7, 0xF9, 0x00, 0x00, 0x08, 0x94, 0x36, 0x56 },  //  30 INSTRUMENT_SANTUR
+		{ 0x02, 0x18, 0xF6, 0x79, 0x01, 0x81, 0x88, 0xF4, 0x55, 0x44 },  //  31 INSTRUMENT_SANTUR
+		{ 0x24, 0x40, 0xFD, 0xFD, 0x00, 0x24, 0x0A, 0xFB, 0x0E, 0x00 },  //  32 INSTRUMENT_ORGAN1
+		{ 0x20, 0x95, 0xFB, 0x0E, 0x01, 0x20, 0x08, 0xF6, 0x0E, 0x00 },  //  33 INSTRUMENT_ORGAN1
+		{ 0x04, 0x17, 0xFE, 0xB7, 0x00, 0x24, 0x08, 0xF7, 0x67, 0x00 },  //  34 INSTRUMENT_ORGAN2
+		{ 0x20, 0x14, 0xF9, 0x06, 0x01, 0xA0, 0x08, 0xF6, 0x07, 0x00 },  //  35 INSTRUMENT_ORGAN2
+		{ 0xA2, 0x1E, 0xB9, 0x36, 0x00, 0x20, 0x08, 0xA9, 0x0E, 0x00 },  //  36 INSTRUMENT_ORGAN3
+		{ 0xB4, 0x1A, 0x79, 0x51, 0x01, 0x20, 0x08, 0x77, 0x4C, 0x04 },  //  37 INSTRUMENT_ORGAN3
+		{ 0x25, 0x23, 0x74, 0x11, 0x02, 0xA1, 0x08, 0x60, 0x05, 0x00 },  //  38 INSTRUMENT_PIPEORG
+		{ 0xB0, 0xD3, 0x74, 0x12, 0x01, 0xB0, 0x08, 0x60, 0x05, 0x14 },  //  39 INSTRUMENT_PIPEORG
+		{ 0x22, 0x24, 0x76, 0x06, 0x00, 0x21, 0x48, 0x76, 0x06, 0x44 },  //  40 INSTRUMENT_REEDORG
+		{ 0x20, 0x21, 0x76, 0x06, 0x01, 0x21, 0x08, 0x66, 0x06, 0x20 },  //  41 INSTRUMENT_REEDORG
+		{ 0x22, 0x1B, 0x76, 0x07, 0x00, 0x21, 0x08, 0x76, 0x07, 0x40 },  //  42 INSTRUMENT_ACORDIAN
+		{ 0x21, 0x19, 0x76, 0x07, 0x01, 0x21, 0x08, 0x66, 0x07, 0x20 },  //  43 INSTRUMENT_ACORDIAN
+		{ 0x21, 0x20, 0x93, 0x09, 0x00, 0x21, 0x08, 0x73, 0x09, 0x44 },  //  44 INSTRUMENT_HARMONIC
+		{ 0x21, 0x27, 0x76, 0x09, 0x01, 0x21, 0x08, 0x76, 0x09, 0x44 },  //  45 INSTRUMENT_HARMONIC
+		{ 0x21, 0x1E, 0x76, 0x09, 0x00, 0x21, 0x08, 0x66, 0x19, 0x54 },  //  46 INSTRUMENT_BANDNEON
+		{ 0x21, 0x22, 0x76, 0x29, 0x01, 0x21, 0x08, 0x66, 0x19, 0x44 },  //  47 INSTRUMENT_BANDNEON
+		{ 0x1B, 0x4C, 0xFE, 0xFE, 0x00, 0x11, 0x08, 0xF2, 0xE3, 0x04 },  //  48 INSTRUMENT_NYLONGT
+		{ 0x31, 0x4C, 0xF2, 0x45, 0x01, 0x11, 0x08, 0xF2, 0xF4, 0x04 },  //  49 INSTRUMENT_NYLONGT
+		{ 0x30, 0x08, 0xF2, 0x49, 0x01, 0x05, 0x0B, 0xFE, 0x43, 0x12 },  //  50 INSTRUMENT_STEELGT
+		{ 0x01, 0x08, 0xF2, 0xE7, 0x01, 0x00, 0x08, 0xF3, 0x9D, 0x21 },  //  51 INSTRUMENT_STEELGT
+		{ 0x34, 0x0D, 0xF2, 0x49, 0x01, 0x04, 0x16, 0xFD, 0x43, 0x00 },  //  52 INSTRUMENT_JAZZGT
+		{ 0x01, 0x08, 0xF2, 0xE7, 0x01, 0x01, 0x0C, 0xF3, 0x9D, 0x00 },  //  53 INSTRUMENT_JAZZGT
+		{ 0x03, 0x00, 0xFB, 0x49, 0x09, 0x23, 0x00, 0xFC, 0x64, 0x06 },  //  54 INSTRUMENT_CLEANGT
+		{ 0x01, 0x08, 0xF4, 0xC4, 0x01, 0x01, 0x08, 0xF6, 0xC4, 0x62 },  //  55 INSTRUMENT_CLEANGT
+		{ 0x01, 0x06, 0xF6, 0x27, 0x00, 0x01, 0x0D, 0xF3, 0xE7, 0x15 },  //  56 INSTRUMENT_MUTEGT
+		{ 0x02, 0x05, 0xFA, 0x96, 0x01, 0x01, 0x08, 0x65, 0x9B, 0x44 },  //  57 INSTRUMENT_MUTEGT
+		{ 0x21, 0xC1, 0xF2, 0x13, 0x00, 0x21, 0x48, 0xF3, 0x16, 0x40 },  //  58 INSTRUMENT_OVERDGT
+		{ 0x21, 0x03, 0x97, 0xAE, 0x01, 0x21, 0x08, 0x96, 0x26, 0x53 },  //  59 INSTRUMENT_OVERDGT
+		{ 0x21, 0xC1, 0xF2, 0x16, 0x00, 0x21, 0x08, 0xF2, 0x16, 0x40 },  //  60 INSTRUMENT_DISTGT
+		{ 0x21, 0x03, 0xC7, 0x46, 0x01, 0x20, 0x08, 0x90, 0x16, 0x33 },  //  61 INSTRUMENT_DISTGT
+		{ 0x0B, 0x40, 0x65, 0x1A, 0x0C, 0x01, 0x48, 0xF2, 0x3E, 0x30 },  //  62 INSTRUMENT_GTHARMS
+		{ 0x05, 0x00, 0xE2, 0x1A, 0x01, 0x0A, 0x49, 0x54, 0x1A, 0x12 },  //  63 INSTRUMENT_GTHARMS
+		{ 0x21, 0x12, 0xE4, 0x15, 0x00, 0x21, 0x08, 0xD3, 0xA6, 0x00 },  //  64 INSTRUMENT_ACOUBASS
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },  //  65 INSTRUMENT_ACOUBASS
+		{ 0x21, 0x08, 0xF2, 0x49, 0x01, 0x01, 0x0B, 0xF2, 0x97, 0x54 },  //  66 INSTRUMENT_FINGBASS
+		{ 0x01, 0x09, 0xF6, 0xE7, 0x01, 0x01, 0x08, 0xF3, 0x9D, 0x41 },  //  67 INSTRUMENT_FINGBASS
+		{ 0x21, 0x08, 0xF2, 0x49, 0x01, 0x01, 0x08, 0xF2, 0x97, 0x54 },  //  68 INSTRUMENT_PICKBASS
+		{ 0x01, 0x08, 0xF6, 0xE7, 0x01, 0x01, 0x08, 0xF3, 0x9D, 0x41 },  //  69 INSTRUMENT_PICKBASS
+		{ 0x01, 0xC8, 0xF2, 0x6A, 0x09, 0x01, 0x08, 0xC4, 0x97, 0x00 },  //  70 INSTRUMENT_FRETLESS
+		{ 0x01, 0x11, 0x91, 0xE7, 0x01, 0x01, 0x08, 0xF2, 0x6D, 0x00 },  //  71 INSTRUMENT_FRETLESS
+		{ 0x01, 0x06, 0xFD, 0x49, 0x01, 0x0B, 0x08, 0xFA, 0x87, 0x46 },  //  72 INSTRUMENT_SLAPBAS1
+		{ 0x01, 0x08, 0xF3, 0xB7, 0x01, 0x01, 0x08, 0xF3, 0x9D, 0x44 },  //  73 INSTRUMENT_SLAPBAS1
+		{ 0x26, 0x24, 0xF6, 0x87, 0x00, 0x21, 0x08, 0xF2, 0xF7, 0x44 },  //  74 INSTRUMENT_SLAPBAS2
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },  //  75 INSTRUMENT_SLAPBAS2
+		{ 0x21, 0x08, 0xF5, 0x47, 0x00, 0x01, 0x48, 0xF2, 0xF7, 0x00 },  //  76 INSTRUMENT_SYNBASS1
+		{ 0x21, 0x07, 0xF5, 0x47, 0x09, 0x01, 0x48, 0xF2, 0xF7, 0x00 },  //  77 INSTRUMENT_SYNBASS1
+		{ 0xC1, 0x08, 0xF2, 0x48, 0x01, 0x01, 0x21, 0xF2, 0x97, 0x00 },  //  78 INSTRUMENT_SYNBASS2
+		{ 0x01, 0x0A, 0xF2, 0x97, 0x00, 0x01, 0x08, 0xF2, 0x77, 0x00 },  //  79 INSTRUMENT_SYNBASS2
+		{ 0x22, 0xCA, 0xB4, 0x26, 0x0C, 0x21, 0x11, 0x44, 0x06, 0x44 },  //  80 INSTRUMENT_VIOLIN
+		{ 0x22, 0xCC, 0x89, 0x16, 0x01, 0x01, 0x10, 0x5D, 0x06, 0x44 },  //  81 INSTRUMENT_VIOLIN
+		{ 0x24, 0xCB, 0x88, 0x26, 0x0C, 0x21, 0x10, 0x66, 0x16, 0x44 },  //  82 INSTRUMENT_VIOLA
+		{ 0x34, 0xC4, 0x86, 0x66, 0x01, 0x21, 0x10, 0x66, 0x06, 0x44 },  //  83 INSTRUMENT_VIOLA
+		{ 0x22, 0xCB, 0x72, 0x46, 0x06, 0x01, 0x1C, 0x5F, 0x86, 0x44 },  //  84 INSTRUMENT_CELLO
+		{ 0x22, 0xCD, 0x76, 0x36, 0x01, 0x21, 0x08, 0x54, 0x06, 0x44 },  //  85 INSTRUMENT_CELLO
+		{ 0x22, 0xFF, 0x86, 0x06, 0x06, 0x01, 0x08, 0x6F, 0x08, 0x44 },  //  86 INSTRUMENT_CONTRAB
+		{ 0x22, 0xD2, 0x74, 0x16, 0x01, 0x21, 0x08, 0x54, 0x06, 0x44 },  //  87 INSTRUMENT_CONTRAB
+		{ 0x60, 0x00, 0x68, 0x04, 0x01, 0x61, 0x09, 0x53, 0x45, 0x32 },  //  88 INSTRUMENT_TREMSTR
+		{ 0x61, 0x11, 0x54, 0x54, 0x01, 0x60, 0x08, 0x78, 0x35, 0x31 },  //  89 INSTRUMENT_TREMSTR
+		{ 0x00, 0x07, 0xF9, 0xF1, 0x06, 0x00, 0x08, 0xF6, 0x34, 0x23 },  //  90 INSTRUMENT_PIZZ
+		{ 0x00, 0x0C, 0x89, 0xF1, 0x01, 0x00, 0x08, 0xB5, 0x34, 0x23 },  //  91 INSTRUMENT_PIZZ
+		{ 0x12, 0xD0, 0xB5, 0x23, 0x00, 0x01, 0x17, 0xC3, 0xE3, 0x04 },  //  92 INSTRUMENT_HARP
+		{ 0x12, 0xD9, 0xE5, 0x15, 0x01, 0x11, 0x08, 0xA2, 0xF3, 0x04 },  //  93 INSTRUMENT_HARP
+		{ 0x11, 0xD0, 0xE4, 0xE4, 0x00, 0x10, 0x08, 0xD3, 0xF4, 0x01 },  //  94 INSTRUMENT_TIMPANI
+		{ 0x14, 0x14, 0xF6, 0xF4, 0x01, 0x10, 0x08, 0xF3, 0xF4, 0x22 },  //  95 INSTRUMENT_TIMPANI
+		{ 0x21, 0x1B, 0xA9, 0x23, 0x0E, 0x21, 0xC8, 0x63, 0x25, 0x40 },  //  96 INSTRUMENT_STRINGS
+		{ 0x21, 0x22, 0xA9, 0x23, 0x01, 0x21, 0x48, 0x43, 0x24, 0x40 },  //  97 INSTRUMENT_STRINGS
+		{ 0x21, 0x1F, 0xA9, 0x23, 0x0E, 0x21, 0xC8, 0x33, 0x15, 0x40 },  //  98 INSTRUMENT_SLOWSTR
+		{ 0x21, 0x23, 0x60, 0x23, 0x01, 0x21, 0x88, 0x33, 0x25, 0x40 },  //  99 INSTRUMENT_SLOWSTR
+		{ 0x20, 0x08, 0x52, 0xB6, 0x01, 0x01, 0x0C, 0x50, 0x15, 0x12 },  // 100 INSTRUMENT_SYNSTR1
+		{ 0x21, 0x09, 0x44, 0x04, 0x01, 0x20, 0x51, 0x41, 0x27, 0x21 },  // 101 INSTRUMENT_SYNSTR1
+		{ 0x22, 0x48, 0x51, 0xA4, 0x01, 0x01, 0xC2, 0x31, 0xF4, 0x14 },  // 102 INSTRUMENT_SYNSTR2
+		{ 0x21, 0x08, 0x70, 0xF4, 0x01, 0x21, 0x48, 0x34, 0x74, 0x41 },  // 103 INSTRUMENT_SYNSTR2
+		{ 0x21, 0x10, 0x61, 0x04, 0x0A, 0x21, 0x08, 0x66, 0x45, 0x40 },  // 104 INSTRUMENT_CHOIR
+		{ 0x20, 0x1C, 0x63, 0x05, 0x01, 0x21, 0x08, 0x63, 0x04, 0x00 },  // 105 INSTRUMENT_CHOIR
+		{ 0x21, 0x16, 0xA6, 0x66, 0x00, 0x21, 0x08, 0x77, 0x06, 0x00 },  // 106 INSTRUMENT_OOHS
+		{ 0x20, 0xD8, 0x66, 0x36, 0x01, 0x21, 0x08, 0x68, 0x06, 0x00 },  // 107 INSTRUMENT_OOHS
+		{ 0x21, 0x12, 0x75, 0x66, 0x00, 0x21, 0x08, 0x67, 0x06, 0x00 },  // 108 INSTRUMENT_SYNVOX
+		{ 0x21, 0x2D, 0x62, 0x36, 0x01, 0x21, 0x08, 0x68, 0x06, 0x00 },  // 109 INSTRUMENT_SYNVOX
+		{ 0x02, 0x0E, 0x76, 0x34, 0x00, 0x01, 0x08, 0x64, 0x35, 0x40 },  // 110 INSTRUMENT_ORCHIT
+		{ 0x01, 0x2D, 0x66, 0x35, 0x01, 0x00, 0x08, 0x63, 0x04, 0x04 },  // 111 INSTRUMENT_ORCHIT
+		{ 0x21, 0x23, 0x72, 0x9B, 0x00, 0x21, 0x08, 0x72, 0x3B, 0x41 },  // 112 INSTRUMENT_TRUMPET
+		{ 0x21, 0x23, 0x82, 0x9B, 0x01, 0x21, 0x08, 0x92, 0x3B, 0x41 },  // 113 INSTRUMENT_TRUMPET
+		{ 0x21, 0x23, 0x63, 0x9B, 0x00, 0x21, 0x08, 0x62, 0x3B, 0x41 },  // 114 INSTRUMENT_TROMBONE
+		{ 0x21, 0x21, 0x73, 0x9B, 0x01, 0x21, 0x08, 0x82, 0x3B, 0x41 },  // 115 INSTRUMENT_TROMBONE
+		{ 0x01, 0x14, 0x62, 0x0B, 0x06, 0x01, 0x08, 0xE6, 0x2B, 0x55 },  // 116 INSTRUMENT_TUBA
+		{ 0x21, 0x13, 0x55, 0x1B, 0x01, 0x22, 0x08, 0x72, 0x2B, 0x04 },  // 117 INSTRUMENT_TUBA
+		{ 0x01, 0x11, 0x60, 0xFB, 0x00, 0x21, 0x18, 0x62, 0x7B, 0x05 },  // 118 INSTRUMENT_MUTETRP
+		{ 0x01, 0x10, 0x60, 0x3B, 0x01, 0x21, 0x17, 0x62, 0x7B, 0x05 },  // 119 INSTRUMENT_MUTETRP
+		{ 0x21, 0x23, 0x41, 0x94, 0x0E, 0x21, 0x08, 0x81, 0xF6, 0x00 },  // 120 INSTRUMENT_FRHORN
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },  // 121 INSTRUMENT_FRHORN
+		{ 0x22, 0x4C, 0x75, 0x37, 0x00, 0x61, 0x48, 0xF1, 0xB7, 0x51 },  // 122 INSTRUMENT_BRASS1
+		{ 0x21, 0x4D, 0x56, 0x07, 0x01, 0x20, 0x08, 0x72, 0x17, 0x25 },  // 123 INSTRUMENT_BRASS1
+		{ 0x21, 0x04, 0x82, 0xCB, 0x06, 0x21, 0x09, 0x71, 0x2B, 0x11 },  // 124 INSTRUMENT_SYNBRAS1
+		{ 0x21, 0x11, 0x75, 0x8B, 0x01, 0x21, 0x08, 0x80, 0x3B, 0x00 },  // 125 INSTRUMENT_SYNBRAS1
+		{ 0x21, 0x83, 0x84, 0x3B, 0x06, 0x21, 0x4D, 0xA2, 0x3B, 0x01 },  // 126 INSTRUMENT_SYNBRAS2
+		{ 0x21, 0x0E, 0x74, 0x7B, 0x01, 0x21, 0x08, 0x73, 0x3B, 0x00 },  // 127 INSTRUMENT_SYNBRAS2
+		{ 0x01, 0x15, 0x70, 0xE7, 0x00, 0x02, 0x08, 0x70, 0xE8, 0x05 },  // 128 INSTRUMENT_SOPSAX
+		{ 0x01, 0x42, 0x70, 0xF8, 0x01, 0x00, 0x08, 0x70, 0xE8, 0x27 },  // 129 INSTRUMENT_SOPSAX
+		{ 0x01, 0x13, 0x70, 0xE9, 0x00, 0x01, 0x08, 0x70, 0xE9, 0x05 },  // 130 INSTRUMENT_ALTOSAX
+		{ 0x01, 0x47, 0x70, 0xE9, 0x01, 0x40, 0x48, 0x70, 0xE9, 0x27 },  // 131 INSTRUMENT_ALTOSAX
+		{ 0x01, 0x15, 0x70, 0xEB, 0x00, 0x01, 0x08, 0x70, 0xEA, 0x05 },  // 132 INSTRUMENT_TENSAX
+		{ 0x01, 0x09, 0x70, 0xEB, 0x01, 0x40, 0x08, 0x70, 0xEB, 0x27 },  // 133 INSTRUMENT_TENSAX
+		{ 0x01, 0x11, 0xA4, 0xBB, 0x00, 0x04, 0x0D, 0x67, 0x6A, 0x00 },  // 134 INSTRUMENT_BARISAX
+		{ 0x01, 0x0C, 0xD0, 0xEB, 0x01, 0x02, 0x08, 0x80, 0xEB, 0x21 },  // 135 INSTRUMENT_BARISAX
+		{ 0x11, 0x17, 0x70, 0x29, 0x00, 0x34, 0x08, 0x61, 0x29, 0x00 },  // 136 INSTRUMENT_OBOE
+		{ 0x31, 0xFF, 0x60, 0x09, 0x01, 0x34, 0x7F, 0x60, 0x09, 0x20 },  // 137 INSTRUMENT_OBOE
+		{ 0x01, 0x11, 0xF0, 0x29, 0x00, 0x24, 0x08, 0x80, 0x09, 0x00 },  // 138 INSTRUMENT_ENGLHORN
+		{ 0x31, 0xDA, 0x80, 0x09, 0x01, 0x24, 0x08, 0x80, 0x09, 0x00 },  // 139 INSTRUMENT_ENGLHORN
+		{ 0x01, 0x13, 0x60, 0x22, 0x00, 0x24, 0x0C, 0x80, 0x09, 0x00 },  // 140 INSTRUMENT_BASSOON
+		{ 0x31, 0x86, 0x80, 0x05, 0x01, 0x24, 0x18, 0x80, 0x09, 0x00 },  // 141 INSTRUMENT_BASSOON
+		{ 0x32, 0x1D, 0xA2, 0x16, 0x0A, 0x31, 0x08, 0x51, 0x26, 0x04 },  // 142 INSTRUMENT_CLARINET
+		{ 0x32, 0x45, 0xFE, 0x52, 0x01, 0x31, 0x08, 0x55, 0x15, 0x04 },  // 143 INSTRUMENT_CLARINET
+		{ 0x24, 0x20, 0x67, 0xF6, 0x00, 0xA2, 0x08, 0x65, 0x06, 0x00 },  // 144 INSTRUMENT_PICCOLO
+		{ 0x24, 0x1C, 0x7F, 0x27, 0x01, 0xA2, 0x08, 0x67, 0x06, 0x00 },  // 145 INSTRUMENT_PICCOLO
+		{ 0x22, 0x26, 0x65, 0x66, 0x00, 0xA1, 0x10, 0x67, 0x06, 0x00 },  // 146 INSTRUMENT_FLUTE1
+		{ 0x02, 0x2A, 0xA2, 0x36, 0x01, 0x21, 0x10, 0x6F, 0x06, 0x00 },  // 147 INSTRUMENT_FLUTE1
+		{ 0x21, 0x11, 0x85, 0x66, 0x00, 0x31, 0x1B, 0x68, 0x06, 0x00 },  // 148 INSTRUMENT_RECORDER
+		{ 0x32, 0x19, 0xD5, 0x39, 0x01, 0x31, 0x08, 0x68, 0x06, 0x00 },  // 149 INSTRUMENT_RECORDER
+		{ 0x20, 0x00, 0x77, 0x08, 0x0E, 0xA0, 0x15, 0x77, 0x58, 0x00 },  // 150 INSTRUMENT_PANFLUTE
+		{ 0x24, 0xD3, 0x76, 0xA9, 0x01, 0x21, 0x08, 0x76, 0x08, 0x04 },  // 151 INSTRUMENT_PANFLUTE
+		{ 0x2B, 0x12, 0x73, 0x68, 0x0E, 0x26, 0x24, 0x67, 0x97, 0x00 },  // 152 INSTRUMENT_BOTTLEB
+		{ 0x22, 0x14, 0x66, 0x46, 0x01, 0x21, 0x17, 0x60, 0xB6, 0x00 },  // 153 INSTRUMENT_BOTTLEB
+		{ 0x61, 0x16, 0x67, 0x56, 0x00, 0xA1, 0x11, 0x77, 0x06, 0x02 },  // 154 INSTRUMENT_SHAKU
+		{ 0x21, 0x15, 0xD7, 0x66, 0x01, 0x01, 0x08, 0x40, 0xB6, 0x02 },  // 155 INSTRUMENT_SHAKU
+		{ 0x61, 0x31, 0xC4, 0x56, 0x00, 0xA1, 0x08, 0x50, 0xB6, 0x02 },  // 156 INSTRUMENT_WHISTLE
+		{ 0x61, 0x30, 0xC4, 0x66, 0x01, 0x81, 0x08, 0x50, 0xB6, 0x01 },  // 157 INSTRUMENT_WHISTLE
+		{ 0x31, 0x2B, 0x57, 0x46, 0x00, 0x31, 0x08, 0x68, 0x06, 0x04 },  // 158 INSTRUMENT_OCARINA
+		{ 0x32, 0x30, 0x47, 0x69, 0x01, 0x31, 0x08, 0x68, 0x06, 0x04 },  // 159 INSTRUMENT_OCARINA
+		{ 0x21, 0x0D, 0xD4, 0x1B, 0x01, 0x21, 0x0D, 0xC2, 0x26, 0x64 },  // 160 INSTRUMENT_SQUARWAV
+		{ 0x21, 0x15, 0xC6, 0x19, 0x01, 0x21, 0x15, 0xD0, 0x27, 0x64 },  // 161 INSTRUMENT_SQUARWAV
+		{ 0x21, 0x11, 0xD4, 0x1B, 0x00, 0x20, 0x08, 0xC2, 0x36, 0x34 },  // 162 INSTRUMENT_SAWWAV
+		{ 0x21, 0x10, 0xC9, 0x49, 0x01, 0x21, 0x08, 0xD0, 0x37, 0x14 },  // 163 INSTRUMENT_SAWWAV
+		{ 0x22, 0x0E, 0x76, 0x66, 0x06, 0xA1, 0x14, 0x67, 0x06, 0x00 },  // 164 INSTRUMENT_SYNCALLI
+		{ 0x22, 0x1E, 0x75, 0x06, 0x01, 0x21, 0x14, 0x75, 0x06, 0x02 },  // 165 INSTRUMENT_SYNCALLI
+		{ 0xD1, 0x00, 0xB7, 0x66, 0x00, 0xA0, 0x08, 0x87, 0x06, 0x22 },  // 166 INSTRUMENT_CHIFLEAD
+		{ 0x01, 0x14, 0x75, 0x66, 0x01, 0x60, 0x08, 0xB5, 0x06, 0x22 },  // 167 INSTRUMENT_CHIFLEAD
+		{ 0x30, 0x0C, 0xF4, 0xA0, 0x00, 0x22, 0x0C, 0x62, 0x0E, 0x00 },  // 168 INSTRUMENT_CHARANG
+		{ 0x20, 0x14, 0x77, 0x4E, 0x01, 0x21, 0x0C, 0x90, 0x1C, 0x00 },  // 169 INSTRUMENT_CHARANG
+		{ 0x20, 0x1A, 0x76, 0x64, 0x06, 0x32, 0x0C, 0x47, 0x05, 0x00 },  // 170 INSTRUMENT_SOLOVOX
+		{ 0x31, 0x1B, 0x75, 0x03, 0x01, 0x21, 0x0C, 0x75, 0x05, 0x00 },  // 171 INSTRUMENT_SOLOVOX
+		{ 0x03, 0x0C, 0xF2, 0xA6, 0x07, 0x06, 0x3F, 0xF0, 0xFB, 0x00 },  // 172 INSTRUMENT_FIFTHSAW
+		{ 0x01, 0x15, 0xF0, 0xF8, 0x00, 0x00, 0x14, 0xF3, 0xC8, 0x00 },  // 173 INSTRUMENT_FIFTHSAW
+		{ 0x02, 0x0B, 0xF3, 0xFB, 0x06, 0x21, 0x09, 0xF1, 0x2B, 0x11 },  // 174 INSTRUMENT_BASSLEAD
+		{ 0x01, 0xE1, 0xF3, 0xFB, 0x01, 0x21, 0x10, 0xF0, 0x2B, 0x05 },  // 175 INSTRUMENT_BASSLEAD
+		{ 0x12, 0xC0, 0xF2, 0x23, 0x00, 0x12, 0x14, 0xE2, 0x55, 0x00 },  // 176 INSTRUMENT_FANTASIA
+		{ 0x31, 0x1C, 0x69, 0x33, 0x01, 0x30, 0x0D, 0x52, 0x15, 0x22 },  // 177 INSTRUMENT_FANTASIA
+		{ 0x01, 0x18, 0x21, 0x53, 0x00, 0x31, 0x08, 0x22, 0x55, 0x00 },  // 178 INSTRUMENT_WARMPAD
+		{ 0x11, 0xD4, 0x21, 0x53, 0x01, 0x31, 0x08, 0x21, 0x45, 0x01 },  // 179 INSTRUMENT_WARMPAD
+		{ 0x20, 0x00, 0xC3, 0xF4, 0x00, 0x01, 0x08, 0xF0, 0xF5, 0x02 },  // 180 INSTRUMENT_POLYSYN
+		{ 0x01, 0x08, 0x32, 0x14, 0x01, 0x21, 0x12, 0x20, 0x04, 0x05 },  // 181 INSTRUMENT_POLYSYN
+		{ 0x30, 0xD1, 0xA2, 0x40, 0x00, 0x20, 0x04, 0x63, 0x48, 0x00 },  // 182 INSTRUMENT_SPACEVOX
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },  // 183 INSTRUMENT_SPACEVOX
+		{ 0x06, 0x08, 0xF0, 0xE4, 0x00, 0x21, 0x16, 0x45, 0x36, 0x00 },  // 184 INSTRUMENT_BOWEDGLS
+		{ 0x01, 0x46, 0xE5, 0x34, 0x01, 0x21, 0x0C, 0x40, 0x05, 0x04 },  // 185 INSTRUMENT_BOWEDGLS
+		{ 0x21, 0x40, 0x63, 0x83, 0x00, 0x21, 0x08, 0x30, 0x13, 0x00 },  // 186 INSTRUMENT_METALPAD
+		{ 0x21, 0x17, 0x63, 0xA3, 0x01, 0x21, 0x09, 0x40, 0x13, 0x45 },  // 187 INSTRUMENT_METALPAD
+		{ 0x31, 0x08, 0x60, 0x15, 0x05, 0x30, 0xC4, 0x64, 0xF8, 0x20 },  // 188 INSTRUMENT_HALOPAD
+		{ 0x31, 0x14, 0xB0, 0xC5, 0x01, 0x31, 0x0C, 0xD0, 0x45, 0x00 },  // 189 INSTRUMENT_HALOPAD
+		{ 0x31, 0x00, 0x44, 0xF4, 0x05, 0x12, 0x8C, 0x12, 0xB3, 0x00 },  // 190 INSTRUMENT_SWEEPPAD
+		{ 0x10, 0x10, 0x30, 0xB4, 0x01, 0x30, 0x08, 0x74, 0x04, 0x11 },  // 191 INSTRUMENT_SWEEPPAD
+		{ 0x08, 0xC0, 0xFB, 0x66, 0x00, 0x83, 0x08, 0xF5, 0x68, 0x00 },  // 192 INSTRUMENT_ICERAIN
+		{ 0x21, 0x14, 0xF0, 0x25, 0x01, 0x21, 0x08, 0xDE, 0x05, 0x00 },  // 193 INSTRUMENT_ICERAIN
+		{ 0x08, 0x01, 0x33, 0xF2, 0x00, 0x01, 0x17, 0x31, 0xF2, 0x00 },  // 194 INSTRUMENT_SOUNDTRK
+		{ 0x01, 0x04, 0x31, 0xF2, 0x01, 0x01, 0x08, 0x32, 0xF2, 0x01 },  // 195 INSTRUMENT_SOUNDTRK
+		{ 0x17, 0xC0, 0xF1, 0x31, 0x08, 0x91, 0x08, 0xF1, 0x22, 0x00 },  // 196 INSTRUMENT_CRYSTAL
+		{ 0x95, 0x9B, 0xF1, 0x21, 0x01, 0x91, 0x09, 0xF1, 0x23, 0x00 },  // 197 INSTRUMENT_CRYSTAL
+		{ 0x01, 0x00, 0xD2, 0x24, 0x00, 0x17, 0x0C, 0xD8, 0x34, 0x00 },  // 198 INSTRUMENT_ATMOSPH
+		{ 0x01, 0x17, 0xEA, 0x34, 0x01, 0x20, 0x08, 0xE1, 0x14, 0x22 },  // 199 INSTRUMENT_ATMOSPH
+		{ 0x06, 0x08, 0xF0, 0xE4, 0x00, 0x01, 0x08, 0xF5, 0x34, 0x00 },  // 200 INSTRUMENT_BRIGHT
+		{ 0x01, 0x44, 0xE5, 0x34, 0x01, 0xA0, 0x08, 0xE0, 0x44, 0x22 },  // 201 INSTRUMENT_BRIGHT
+		{ 0x04, 0x02, 0x11, 0x32, 0x08, 0x01, 0x08, 0x21, 0x22, 0x00 },  // 202 INSTRUMENT_GOBLIN
+		{ 0x01, 0x41, 0x11, 0x24, 0x01, 0x01, 0x08, 0x11, 0x23, 0x00 },  // 203 INSTRUMENT_GOBLIN
+		{ 0x05, 0xC0, 0xF8, 0xD3, 0x00, 0x01, 0x0C, 0xE1, 0x03, 0x00 },  // 204 INSTRUMENT_ECHODROP
+		{ 0x21, 0x10, 0x69, 0x33, 0x01, 0x21, 0x08, 0x52, 0x13, 0x01 },  // 205 INSTRUMENT_ECHODROP
+		{ 0x02, 0x00, 0x83, 0xF3, 0x06, 0x21, 0x08, 0x61, 0x23, 0x01 },  // 206 INSTRUMENT_STARTHEM
+		{ 0x01, 0x0B, 0x73, 0xF3, 0x01, 0x21, 0x08, 0x52, 0x23, 0x05 },  // 207 INSTRUMENT_STARTHEM
+		{ 0x25, 0x12, 0xF7, 0x44, 0x00, 0x01, 0x0F, 0xF8, 0x04, 0x44 },  // 208 INSTRUMENT_SITAR
+		{ 0xA7, 0x17, 0x80, 0x64, 0x01, 0x01, 0x10, 0xF3, 0x74, 0x44 },  // 209 INSTRUMENT_SITAR
+		{ 0x01, 0x08, 0xF4, 0xA6, 0x05, 0x05, 0x25, 0xF8, 0xFB, 0x04 },  // 210 INSTRUMENT_BANJO
+		{ 0x01, 0x10, 0xF4, 0xFB, 0x00, 0x02, 0x08, 0xF6, 0xC7, 0x40 },  // 211 INSTRUMENT_BANJO
+		{ 0x04, 0x09, 0xFA, 0xA6, 0x04, 0x07, 0x08, 0xF8, 0xFB, 0x00 },  // 212 INSTRUMENT_SHAMISEN
+		{ 0x01, 0x16, 0xF3, 0x95, 0x01, 0x01, 0x08, 0xF3, 0xC5, 0x44 },  // 213 INSTRUMENT_SHAMISEN
+		{ 0x01, 0x08, 0xF4, 0xA4, 0x05, 0x05, 0x25, 0xFA, 0xFB, 0x44 },  // 214 INSTRUMENT_KOTO
+		{ 0x01, 0x18, 0xF4, 0xF5, 0x00, 0x01, 0x08, 0xF3, 0xC5, 0x44 },  // 215 INSTRUMENT_KOTO
+		{ 0x09, 0x00, 0xF8, 0x6E, 0x00, 0x03, 0x08, 0xF8, 0x6E, 0x44 },  // 216 INSTRUMENT_KALIMBA
+		{ 0x01, 0x00, 0xF4, 0x16, 0x01, 0x86, 0x09, 0xF7, 0xEA, 0x00 },  // 217 INSTRUMENT_KALIMBA
+		{ 0x11, 0x0C, 0xD0, 0xF3, 0x00, 0x32, 0x08, 0x80, 0x05, 0x00 },  // 218 INSTRUMENT_BAGPIPE
+		{ 0x31, 0xC9, 0x40, 0x09, 0x01, 0x24, 0x0C, 0x50, 0x09, 0x40 },  // 219 INSTRUMENT_BAGPIPE
+		{ 0x24, 0xC9, 0xAA, 0x58, 0x00, 0x20, 0x0C, 0x95, 0x08, 0x34 },  // 220 INSTRUMENT_FIDDLE
+		{ 0x24, 0xC9, 0xC7, 0x88, 0x01, 0x20, 0x08, 0x72, 0x28, 0x35 },  // 221 INSTRUMENT_FIDDLE
+		{ 0x11, 0x0C, 0xD0, 0xF3, 0x00, 0x32, 0x08, 0x80, 0x05, 0x00 },  // 222 INSTRUMENT_SHANNAI
+		{ 0x31, 0xCC, 0x60, 0x06, 0x01, 0x24, 0x0C, 0x60, 0x06, 0x40 },  // 223 INSTRUMENT_SHANNAI
+		{ 0x16, 0x4F, 0xF6, 0x53, 0x00, 0x19, 0x08, 0xF3, 0x53, 0x00 },  // 224 INSTRUMENT_TINKLBEL
+		{ 0x15, 0x41, 0xF1, 0x52, 0x01, 0x14, 0x08, 0xF3, 0x52, 0x66 },  // 225 INSTRUMENT_TINKLBEL
+		{ 0x17, 0x00, 0xFA, 0x57, 0x00, 0x12, 0x08, 0xF5, 0x58, 0x00 },  // 226 INSTRUMENT_AGOGO
+		{ 0x14, 0x40, 0xF7, 0x52, 0x01, 0x12, 0x08, 0xF5, 0x59, 0x66 },  // 227 INSTRUMENT_AGOGO
+		{ 0x08, 0x1F, 0xC6, 0x37, 0x06, 0x01, 0x08, 0x82, 0x95, 0x00 },  // 228 INSTRUMENT_STEELDRM
+		{ 0x05, 0x0F, 0x65, 0x55, 0x01, 0x11, 0x0F, 0x52, 0x75, 0x00 },  // 229 INSTRUMENT_STEELDRM
+		{ 0x02, 0x09, 0xFC, 0xD6, 0x00, 0x01, 0x08, 0xF7, 0xF7, 0x02 },  // 230 INSTRUMENT_WOODBLOK
+		{ 0x07, 0x3F, 0xFA, 0x4E, 0x01, 0x03, 0xFF, 0xF5, 0xFE, 0x00 },  // 231 INSTRUMENT_WOODBLOK
+		{ 0x1A, 0x00, 0xFB, 0x57, 0x01, 0x30, 0x00, 0xF3, 0x54, 0x10 },  // 232 INSTRUMENT_TAIKO
+		{ 0x11, 0x48, 0xC5, 0x52, 0x01, 0x10, 0x08, 0xC5, 0x57, 0x01 },  // 233 INSTRUMENT_TAIKO
+		{ 0x12, 0x01, 0xFB, 0xA7, 0x00, 0x30, 0x08, 0xF3, 0x53, 0x00 },  // 234 INSTRUMENT_MELOTOM
+		{ 0x10, 0xFF, 0xF4, 0x52, 0x01, 0x10, 0x08, 0xC4, 0x57, 0x00 },  // 235 INSTRUMENT_MELOTOM
+		{ 0x2B, 0x00, 0xFF, 0x0E, 0x0E, 0x0B, 0x08, 0xF7, 0xFE, 0x00 },  // 236 INSTRUMENT_SYNDRUM
+		{ 0x00, 0xC0, 0xF6, 0xFE, 0x01, 0x20, 0x09, 0xFF, 0x0C, 0x02 },  // 237 INSTRUMENT_SYNDRUM
+		{ 0x2A, 0x00, 0xFF, 0x0E, 0x0E, 0x0B, 0x08, 0x2F, 0x0E, 0x44 },  // 238 INSTRUMENT_REVRSCYM
+		{ 0x28, 0x00, 0xF9, 0x0E, 0x01, 0x09, 0x08, 0x29, 0x0E, 0x44 },  // 239 INSTRUMENT_REVRSCYM
+		{ 0x0B, 0x00, 0x64, 0xF8, 0x0E, 0x0B, 0x25, 0x77, 0xF8, 0x44 },  // 240 INSTRUMENT_FRETNOIS
+		{ 0x0B, 0x10, 0x56, 0xF8, 0x01, 0x09, 0x08, 0x59, 0xE8, 0x44 },  // 241 INSTRUMENT_FRETNOIS
+		{ 0x2B, 0x05, 0x79, 0x05, 0x0E, 0x25, 0x08, 0x77, 0xA5, 0x00 },  // 242 INSTRUMENT_BRTHNOIS
+		{ 0x26, 0x10, 0x66, 0xB9, 0x01, 0x01, 0x0A, 0x76, 0xDE, 0x04 },  // 243 INSTRUMENT_BRTHNOIS
+		{ 0x30, 0x00, 0x11, 0x00, 0x0E, 0x10, 0x08, 0x11, 0x32, 0x30 },  // 244 INSTRUMENT_SEASHORE
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },  // 245 INSTRUMENT_SEASHORE
+		{ 0x0A, 0x00, 0x59, 0xFE, 0x01, 0x09, 0x00, 0x69, 0xFE, 0x00 },  // 246 INSTRUMENT_BIRDS
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },  // 247 INSTRUMENT_BIRDS
+		{ 0x0A, 0x0B, 0xE5, 0xF5, 0x00, 0x02, 0x08, 0xE4, 0xF5, 0x05 },  // 248 INSTRUMENT_TELEPHON
+		{ 0x08, 0x43, 0xF5, 0xF5, 0x01, 0x02, 0x08, 0xF4, 0xF5, 0x03 },  // 249 INSTRUMENT_TELEPHON
+		{ 0x0B, 0x00, 0x82, 0xFA, 0x0E, 0x04, 0x88, 0x77, 0xFA, 0x50 },  // 250 INSTRUMENT_HELICOPT
+		{ 0x20, 0x11, 0xF7, 0xFA, 0x01, 0x20, 0x1D, 0xFA, 0xFB, 0x00 },  // 251 INSTRUMENT_HELICOPT
+		{ 0x2B, 0x00, 0xF0, 0x01, 0x0E, 0x27, 0x08, 0x23, 0x13, 0x50 },  // 252 INSTRUMENT_APPLAUSE
+		{ 0x20, 0x7F, 0xFB, 0xE5, 0x01, 0x20, 0x3F, 0xF4, 0xF5, 0x00 },  // 253 INSTRUMENT_APPLAUSE
+		{ 0x0B, 0x40, 0xF5, 0x67, 0x0E, 0x01, 0xC8, 0xF7, 0x64, 0x00 },  // 254 INSTRUMENT_GUNSHOT
+		{ 0x07, 0x3F, 0xF7, 0x34, 0x01, 0x01, 0x00, 0xFA, 0x9E, 0x44 },  // 255 INSTRUMENT_GUNSHOT
+	};
+
+	const InstrumentTable midiInstrumentTable2_4OP = {
+		midiInstrumentTable2_4OPVoices[0], NULL, 128, 2, 0x00
+	};
+
+
+	// Instruments of midi_drums.h.
+	const unsigned char midiDrumTableVoices[47][10] PROGMEM = {
+		{ 0x3E, 0x00, 0x9F, 0x0F, 0x00, 0x30, 0x00, 0x87, 0xFA, 0x0F },  //   0 DRUMINS_CLAP2
+		{ 0x01, 0x00, 0x78, 0x97, 0x00, 0x02, 0x00, 0x88, 0x98, 0x39 },  //   1 DRUMINS_SCRATCH1
+		{ 0x16, 0x08, 0xF1, 0xFB, 0x00, 0x11, 0x00, 0xF9, 0x69, 0x01 },  //   2 DRUMINS_RIMSHOT2
+		{ 0x00, 0x00, 0xF8, 0x6C, 0x00, 0x0E, 0x80, 0xE8, 0x4A, 0x01 },  //   3 DRUMINS_HIQ
+		{ 0x25, 0x1B, 0xFA, 0xF2, 0x00, 0x12, 0x00, 0xF6, 0x9A, 0x01 },  //   4 DRUMINS_WOODBLOK
+		{ 0x06, 0x03, 0xF4, 0x44, 0x01, 0x01, 0x1B, 0xF2, 0x34, 0x00 },  //   5 DRUMINS_GLOCK
+		{ 0x10, 0x44, 0xF8, 0x77, 0x08, 0x11, 0x00, 0xF3, 0x06, 0x02 },  //   6 DRUMINS_BASS_DR2
+		{ 0x02, 0x07, 0xF9, 0xFF, 0x08, 0x11, 0x00, 0xF8, 0xFF, 0x00 },  //   7 DRUMINS_RIMSHOT
+		{ 0x00, 0x00, 0xFC, 0x05, 0x0E, 0x00, 0x00, 0xFA, 0x17, 0x02 },  //   8 DRUMINS_SNARE_AC
+		{ 0x00, 0x02, 0xFF, 0x07, 0x00, 0x01, 0x00, 0xFF, 0x08, 0x00 },  //   9 DRUMINS_CLAP
+		{ 0x00, 0x00, 0xF6, 0x0C, 0x04, 0x00, 0x00, 0xF6, 0x06, 0x00 },  //  10 DRUMINS_LO_TOMS
+		{ 0x0C, 0x00, 0xF6, 0x08, 0x0A, 0x12, 0x00, 0xFB, 0x47, 0x20 },  //  11 DRUMINS_HIHAT_CL
+		{ 0x0C, 0x00, 0xF6, 0x08, 0x0A, 0x12, 0x05, 0x7B, 0x47, 0x20 },  //  12 DRUMINS_HIHAT_PL
+		{ 0x0C, 0x00, 0xF6, 0x02, 0x0A, 0x12, 0x00, 0xCB, 0x43, 0x20 },  //  13 DRUMINS_HIHAT_OP
+		{ 0x0E, 0x00, 0xF6, 0x00, 0x0E, 0xD0, 0x00, 0x9F, 0x02, 0x30 },  //  14 DRUMINS_CRASH
+		{ 0x0E, 0x08, 0xF8, 0x42, 0x0E, 0x07, 0x4A, 0xF4, 0xE4, 0x30 },  //  15 DRUMINS_RIDE_CY
+		{ 0x0E, 0x00, 0xF5, 0x30, 0x0E, 0xD0, 0x0A, 0x9F, 0x02, 0x00 },  //  16 DRUMINS_TAMBOUR
+		{ 0x0E, 0x0A, 0xE4, 0xE4, 0x06, 0x07, 0x5D, 0xF5, 0xE5, 0x13 },  //  17 DRUMINS_CYMBAL
+		{ 0x02, 0x03, 0xB4, 0x04, 0x0E, 0x05, 0x0A, 0x97, 0xF7, 0x00 },  //  18 DRUMINS_TAMBOU2
+		{ 0x4E, 0x00, 0xF6, 0x00, 0x0E, 0x9E, 0x00, 0x9F, 0x02, 0x30 },  //  19 DRUMINS_SPLASH
+		{ 0x11, 0x45, 0xF8, 0x37, 0x08, 0x10, 0x08, 0xF3, 0x05, 0x02 },  //  20 DRUMINS_COWBELL
+		{ 0x80, 0x00, 0xFF, 0x03, 0x0C, 0x10, 0x0D, 0xFF, 0x14, 0x03 },  //  21 DRUMINS_VIBRASLA
+		{ 0x06, 0x0B, 0xF5, 0x0C, 0x06, 0x02, 0x00, 0xF5, 0x08, 0x00 },  //  22 DRUMINS_HI_BONGO
+		{ 0x01, 0x00, 0xFA, 0xBF, 0x07, 0x02, 0x00, 0xC8, 0x97, 0x00 },  //  23 DRUMINS_LO_BONGO
+		{ 0x01, 0x51, 0xFA, 0x87, 0x06, 0x01, 0x00, 0xFA, 0xB7, 0x00 },  //  24 DRUMINS_MUTECONG
+		{ 0x01, 0x54, 0xFA, 0x8D, 0x06, 0x02, 0x00, 0xF8, 0xB8, 0x00 },  //  25 DRUMINS_OPENCONG
+		{ 0x01, 0x59, 0xFA, 0x88, 0x06, 0x02, 0x00, 0xF8, 0xB6, 0x00 },  //  26 DRUMINS_LOWCONGA
+		{ 0x01, 0x00, 0xF9, 0x0A, 0x0E, 0x00, 0x00, 0xFA, 0x06, 0x03 },  //  27 DRUMINS_HI_TIMBA
+		{ 0x00, 0x80, 0xF9, 0x89, 0x0E, 0x00, 0x00, 0xF6, 0x6C, 0x03 },  //  28 DRUMINS_LO_TIMBA
+		{ 0x03, 0x80, 0xF8, 0x88, 0x0F, 0x0C, 0x08, 0xF6, 0xB6, 0x03 },  //  29 DRUMINS_HI_AGOGO
+		{ 0x03, 0x85, 0xF8, 0x88, 0x0F, 0x0C, 0x00, 0xF6, 0xB6, 0x03 },  //  30 DRUMINS_LO_AGOGO
+		{ 0x0E, 0x40, 0x76, 0x4F, 0x0E, 0x00, 0x08, 0x77, 0x18, 0x20 },  //  31 DRUMINS_CABASA
+		{ 0x0E, 0x40, 0xC8, 0x49, 0x0E, 0x03, 0x00, 0x9B, 0x69, 0x20 },  //  32 DRUMINS_MARACAS
+		{ 0xD7, 0xDC, 0xAD, 0x05, 0x0E, 0xC7, 0x00, 0x8D, 0x05, 0x03 },  //  33 DRUMINS_S_WHISTL
+		{ 0xD7, 0xDC, 0xA8, 0x04, 0x0E, 0xC7, 0x00, 0x88, 0x04, 0x03 },  //  34 DRUMINS_L_WHISTL
+		{ 0x80, 0x00, 0xF6, 0x06, 0x0E, 0x11, 0x00, 0x67, 0x17, 0x33 },  //  35 DRUMINS_S_GUIRO
+		{ 0x80, 0x00, 0xF5, 0x05, 0x0E, 0x11, 0x09, 0x46, 0x16, 0x32 },  //  36 DRUMINS_L_GUIRO
+		{ 0x06, 0x3F, 0x00, 0xF4, 0x01, 0x15, 0x00, 0xF7, 0xF5, 0x00 },  //  37 DRUMINS_CLAVES
+		{ 0x06, 0x3F, 0x00, 0xF4, 0x00, 0x12, 0x00, 0xF7, 0xF5, 0x03 },  //  38 DRUMINS_HI_WDBLK
+		{ 0x06, 0x3F, 0x00, 0xF4, 0x01, 0x12, 0x00, 0xF7, 0xF5, 0x00 },  //  39 DRUMINS_LO_WDBLK
+		{ 0x20, 0x01, 0x5F, 0x07, 0x00, 0x08, 0x00, 0x87, 0x4B, 0x11 },  //  40 DRUMINS_MU_CUICA
+		{ 0x41, 0x45, 0xF8, 0x48, 0x00, 0x42, 0x08, 0x75, 0x05, 0x00 },  //  41 DRUMINS_OP_CUICA
+		{ 0x0A, 0x40, 0xE0, 0xF0, 0x08, 0x1E, 0x4E, 0xFF, 0x05, 0x03 },  //  42 DRUMINS_MU_TRNGL
+		{ 0x0A, 0x7C, 0xE0, 0xF0, 0x08, 0x1E, 0x52, 0xFF, 0x02, 0x03 },  //  43 DRUMINS_OP_TRNGL
+		{ 0x0E, 0x00, 0xFF, 0x01, 0x00, 0x0E, 0x02, 0x79, 0x77, 0x3F },  //  44 DRUMINS_SHAKER
+		{ 0x26, 0x44, 0xF1, 0xFF, 0x00, 0x27, 0x40, 0xF5, 0xF5, 0x07 },  //  45 DRUMINS_TRIANGL1
+		{ 0x02, 0x1D, 0xF5, 0x93, 0x00, 0x00, 0x00, 0xC6, 0x45, 0x01 },  //  46 DRUMINS_TAIKO
+	};
+
+	const unsigned char midiDrumTablePrograms[60][2] PROGMEM = {
+		{ 0x30, 0x00 }, { 0x30, 0x01 }, { 0x30, 0x01 }, { 0x30, 0x02 }, { 0x30, 0x03 }, { 0x30, 0x04 },
+		{ 0x30, 0x05 }, { 0x17, 0x06 }, { 0x17, 0x06 }, { 0x28, 0x07 }, { 0x24, 0x08 }, { 0x2E, 0x09 },
+		{ 0x30, 0x08 }, { 0x23, 0x0A }, { 0x1F, 0x0B }, { 0x25, 0x0A }, { 0x1F, 0x0C }, { 0x27, 0x0A },
+		{ 0x1F, 0x0D }, { 0x2A, 0x0A }, { 0x2D, 0x0A }, { 0x3C, 0x0E }, { 0x30, 0x0A }, { 0x40, 0x0F },
+		{ 0x48, 0x10 }, { 0x18, 0x11 }, { 0x35, 0x12 }, { 0x48, 0x13 }, { 0x47, 0x14 }, { 0x48, 0x0E },
+		{ 0x0C, 0x15 }, { 0x41, 0x0F }, { 0x30, 0x16 }, { 0x35, 0x17 }, { 0x2F, 0x18 }, { 0x27, 0x19 },
+		{ 0x21, 0x1A }, { 0x3B, 0x1B }, { 0x30, 0x1C }, { 0x2E, 0x1D }, { 0x29, 0x1E }, { 0x34, 0x1F },
+		{ 0x3B, 0x20 }, { 0x31, 0x21 }, { 0x31, 0x22 }, { 0x20, 0x23 }, { 0x1C, 0x24 }, { 0x39, 0x25 },
+		{ 0x38, 0x26 }, { 0x33, 0x27 }, { 0x24, 0x28 }, { 0x30, 0x29 }, { 0x44, 0x2A }, { 0x34, 0x2B },
+		{ 0x30, 0x2C }, { 0x30, 0x2D }, { 0x30, 0x2D }, { 0x30, 0x02 }, { 0x30, 0x02 }, { 0x30, 0x2E },
+	};
+
+	const InstrumentTable midiDrumTable = {
+		midiDrumTableVoices[0], midiDrumTablePrograms[0], 60, 1, 0x00
+	};
+
+
+	// Instruments of midi_drums_4op.h.
+	const unsigned char midiDrumTable4OPVoices[92][10] PROGMEM = {
+		{ 0x82, 0x00, 0xFF, 0x04, 0x0E, 0x10, 0x06, 0xFF, 0x15, 0x02 },  //   0 DRUMINS_CLAP2
+		{ 0x00, 0x02, 0xFF, 0x07, 0x01, 0x01, 0x00, 0xFF, 0x08, 0x00 },  //   1 DRUMINS_CLAP2
+		{ 0x00, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x3F, 0x00, 0xF0, 0x00 },  //   2 DRUMINS_SCRATCH1
+		{ 0x12, 0x11, 0xF5, 0xFE, 0x06, 0x12, 0xA2, 0xF6, 0xFF, 0x00 },  //   3 DRUMINS_RIMSHOT2
+		{ 0x01, 0x0F, 0xF9, 0xFF, 0x00, 0x11, 0x00, 0xF8, 0xFF, 0x00 },  //   4 DRUMINS_RIMSHOT2
+		{ 0x06, 0x3F, 0x00, 0xF4, 0x00, 0x15, 0x00, 0xF7, 0xF5, 0x03 },  //   5 DRUMINS_HIQ
+		{ 0x06, 0x3F, 0x00, 0xF4, 0x01, 0x15, 0x08, 0xF7, 0xF5, 0x03 },  //   6 DRUMINS_HIQ
+		{ 0x06, 0x3F, 0x00, 0xF4, 0x00, 0x12, 0x00, 0xF7, 0xF5, 0x03 },  //   7 DRUMINS_WOODBLOK
+		{ 0x06, 0x3F, 0x00, 0xF4, 0x01, 0x12, 0x08, 0xF7, 0xF5, 0x03 },  //   8 DRUMINS_WOODBLOK
+		{ 0x05, 0x05, 0xF9, 0x32, 0x0E, 0x04, 0x40, 0xD6, 0xA6, 0x03 },  //   9 DRUMINS_GLOCK
+		{ 0x05, 0x05, 0xF8, 0x32, 0x01, 0x04, 0x40, 0x74, 0xA6, 0x03 },  //  10 DRUMINS_GLOCK
+		{ 0x10, 0x44, 0xF8, 0x77, 0x08, 0x11, 0x00, 0xF3, 0x06, 0x02 },  //  11 DRUMINS_BASS_DR2
+		{ 0x00, 0x3F, 0x00, 0xF0, 0x01, 0x00, 0x3F, 0x00, 0xF0, 0x00 },  //  12 DRUMINS_BASS_DR2
+		{ 0x01, 0x07, 0xFD, 0x0C, 0x00, 0x00, 0x00, 0xD6, 0x3C, 0x00 },  //  13 DRUMINS_BASS_DR1
+		{ 0x00, 0x00, 0xF6, 0x0C, 0x01, 0x00, 0x00, 0xF6, 0x0C, 0x00 },  //  14 DRUMINS_BASS_DR1
+		{ 0x00, 0x00, 0xFC, 0x05, 0x0E, 0x00, 0x00, 0xFA, 0x17, 0x02 },  //  15 DRUMINS_SNARE_AC
+		{ 0x01, 0x03, 0xFC, 0x07, 0x01, 0x02, 0x03, 0xF8, 0x38, 0x60 },  //  16 DRUMINS_SNARE_AC
+		{ 0x00, 0x03, 0xFC, 0x07, 0x01, 0x01, 0x03, 0xF8, 0x38, 0x60 },  //  17 DRUMINS_SNARE_EL
+		{ 0x00, 0x00, 0xF6, 0x0C, 0x01, 0x00, 0x00, 0xF6, 0x06, 0x00 },  //  18 DRUMINS_LO_TOMS
+		{ 0x0C, 0x00, 0xF6, 0x08, 0x0A, 0x12, 0x00, 0xFB, 0x47, 0x20 },  //  19 DRUMINS_HIHAT_CL
+		{ 0x0C, 0x00, 0xF6, 0x08, 0x01, 0x12, 0x00, 0xFB, 0x47, 0x20 },  //  20 DRUMINS_HIHAT_CL
+		{ 0x0C, 0x00, 0xF6, 0x08, 0x0A, 0x12, 0x00, 0x7B, 0x47, 0x20 },  //  21 DRUMINS_HIHAT_PL
+		{ 0x0C, 0x00, 0xF6, 0x08, 0x01, 0x12, 0x00, 0x7B, 0x47, 0x20 },  //  22 DRUMINS_HIHAT_PL
+		{ 0x0C, 0x00, 0xF6, 0x02, 0x0A, 0x12, 0x00, 0xCB, 0x43, 0x20 },  //  23 DRUMINS_HIHAT_OP
+		{ 0x0C, 0x00, 0xF6, 0x02, 0x01, 0x12, 0x15, 0xCB, 0x43, 0x20 },  //  24 DRUMINS_HIHAT_OP
+		{ 0x01, 0x00, 0xF2, 0x55, 0x0E, 0x41, 0x00, 0xF4, 0x00, 0x00 },  //  25 DRUMINS_CRASH
+		{ 0x01, 0x00, 0xF3, 0x00, 0x00, 0x8F, 0x00, 0xF4, 0xA4, 0x00 },  //  26 DRUMINS_CRASH
+		{ 0x0F, 0x00, 0xE4, 0xE4, 0x06, 0x08, 0x0A, 0xF5, 0xE5, 0x13 },  //  27 DRUMINS_RIDE_CY
+		{ 0x0F, 0x00, 0xF5, 0x66, 0x01, 0x08, 0x19, 0xF5, 0xA5, 0x13 },  //  28 DRUMINS_RIDE_CY
+		{ 0x81, 0x00, 0xF9, 0x65, 0x0E, 0x41, 0x00, 0xF2, 0x30, 0x00 },  //  29 DRUMINS_TAMBOUR
+		{ 0x46, 0x00, 0xFE, 0x00, 0x00, 0x85, 0x00, 0xF5, 0x55, 0x00 },  //  30 DRUMINS_TAMBOUR
+		{ 0x0F, 0x00, 0xE4, 0xE4, 0x06, 0x07, 0x11, 0xF5, 0xE5, 0x13 },  //  31 DRUMINS_CYMBAL
+		{ 0x0F, 0x00, 0xF5, 0x65, 0x01, 0x06, 0x1E, 0xF5, 0xA5, 0x13 },  //  32 DRUMINS_CYMBAL
+		{ 0x06, 0x00, 0x94, 0xC4, 0x00, 0x04, 0x00, 0xF6, 0xF5, 0x20 },  //  33 DRUMINS_TAMBOU2
+		{ 0x02, 0x00, 0xF9, 0x04, 0x00, 0x05, 0x03, 0x97, 0xF7, 0x00 },  //  34 DRUMINS_TAMBOU2
+		{ 0x8F, 0x03, 0xF2, 0x56, 0x0E, 0x46, 0x00, 0xF4, 0x00, 0x11 },  //  35 DRUMINS_SPLASH
+		{ 0x8F, 0x00, 0xF3, 0x00, 0x00, 0x42, 0x06, 0xF4, 0xA5, 0x00 },  //  36 DRUMINS_SPLASH
+		{ 0x11, 0x45, 0xF8, 0x37, 0x08, 0x10, 0x00, 0xF3, 0x05, 0x02 },  //  37 DRUMINS_COWBELL
+		{ 0x11, 0x05, 0xF8, 0x37, 0x01, 0x10, 0x08, 0xF3, 0x05, 0x00 },  //  38 DRUMINS_COWBELL
+		{ 0x81, 0x00, 0xF3, 0x55, 0x0E, 0x41, 0x00, 0xF4, 0x00, 0x01 },  //  39 DRUMINS_CRASH2
+		{ 0x41, 0x00, 0xF3, 0x00, 0x00, 0x8F, 0x00, 0xF4, 0xA4, 0x00 },  //  40 DRUMINS_CRASH2
+		{ 0x80, 0x00, 0xFF, 0x03, 0x0C, 0x10, 0x00, 0xFF, 0x14, 0x05 },  //  41 DRUMINS_VIBRASLA
+		{ 0x80, 0x00, 0xFF, 0x03, 0x01, 0x10, 0x0D, 0xFF, 0x14, 0x05 },  //  42 DRUMINS_VIBRASLA
+		{ 0x0F, 0x00, 0xE4, 0xE5, 0x06, 0x08, 0x0A, 0xF5, 0xE7, 0x13 },  //  43 DRUMINS_RIDE2
+		{ 0x0F, 0x00, 0xF5, 0x66, 0x01, 0x08, 0x19, 0xF6, 0xA8, 0x13 },  //  44 DRUMINS_RIDE2
+		{ 0x06, 0xC8, 0xF5, 0x0C, 0x06, 0x02, 0x0B, 0xF5, 0x08, 0x00 },  //  45 DRUMINS_HI_BONGO
+		{ 0x06, 0xC5, 0xF5, 0x0C, 0x01, 0x01, 0x03, 0xF5, 0x07, 0x00 },  //  46 DRUMINS_HI_BONGO
+		{ 0x01, 0x8F, 0xFA, 0xBF, 0x06, 0x02, 0x80, 0xC8, 0x96, 0x00 },  //  47 DRUMINS_LO_BONGO
+		{ 0x01, 0xCF, 0xFA, 0xBF, 0x01, 0x02, 0x0B, 0xC8, 0x96, 0x00 },  //  48 DRUMINS_LO_BONGO
+		{ 0x01, 0x51, 0xFA, 0x87, 0x06, 0x01, 0x00, 0xFA, 0xB7, 0x00 },  //  49 DRUMINS_MUTECONG
+		{ 0x01, 0x4F, 0xFA, 0x87, 0x01, 0x01, 0x08, 0xFA, 0xB7, 0x00 },  //  50 DRUMINS_MUTECONG
+		{ 0x01, 0x55, 0xFA, 0x8D, 0x06, 0x02, 0x00, 0xF8, 0xB5, 0x00 },  //  51 DRUMINS_OPENCONG
+		{ 0x01, 0x55, 0xFA, 0x8D, 0x01, 0x02, 0x12, 0xF8, 0xB5, 0x00 },  //  52 DRUMINS_OPENCONG
+		{ 0x01, 0x59, 0xFA, 0x8D, 0x06, 0x02, 0x00, 0xF8, 0xB6, 0x00 },  //  53 DRUMINS_LOWCONGA
+		{ 0x01, 0x59, 0xFA, 0x8D, 0x01, 0x02, 0x12, 0xF8, 0xB6, 0x00 },  //  54 DRUMINS_LOWCONGA
+		{ 0x01, 0x00, 0xFA, 0x0A, 0x0E, 0x00, 0x00, 0xF9, 0x06, 0x00 },  //  55 DRUMINS_HI_TIMBA
+		{ 0x01, 0x00, 0xFA, 0x0A, 0x01, 0x00, 0x0D, 0xF9, 0x06, 0x00 },  //  56 DRUMINS_HI_TIMBA
+		{ 0x00, 0x80, 0xF9, 0x89, 0x0E, 0x00, 0x00, 0xF6, 0x6C, 0x03 },  //  57 DRUMINS_LO_TIMBA
+		{ 0x00, 0x80, 0xF9, 0x89, 0x01, 0x00, 0x08, 0xF6, 0x6C, 0x00 },  //  58 DRUMINS_LO_TIMBA
+		{ 0x03, 0x8D, 0xF8, 0x88, 0x0E, 0x0C, 0x00, 0xF6, 0xB6, 0x03 },  //  59 DRUMINS_HI_AGOGO
+		{ 0x03, 0x88, 0xF8, 0x88, 0x01, 0x0C, 0x12, 0xF8, 0xB8, 0x00 },  //  60 DRUMINS_HI_AGOGO
+		{ 0x03, 0x88, 0xF8, 0x88, 0x0E, 0x0C, 0x03, 0xF6, 0xB6, 0x03 },  //  61 DRUMINS_LO_AGOGO
+		{ 0x03, 0x88, 0xF8, 0x88, 0x01, 0x0C, 0x0F, 0xF8, 0xB8, 0x03 },  //  62 DRUMINS_LO_AGOGO
+		{ 0x0F, 0x40, 0x76, 0x4F, 0x0E, 0x00, 0x08, 0x77, 0x18, 0x20 },  //  63 DRUMINS_CABASA
+		{ 0x0F, 0x00, 0x76, 0x4F, 0x01, 0x00, 0x12, 0x77, 0x18, 0x20 },  //  64 DRUMINS_CABASA
+		{ 0x0F, 0x40, 0xC8, 0x49, 0x0E, 0x02, 0x80, 0x9B, 0x69, 0x22 },  //  65 DRUMINS_MARACAS
+		{ 0x0F, 0xC0, 0xC8, 0x49, 0x01, 0x0F, 0x19, 0x9B, 0x69, 0x22 },  //  66 DRUMINS_MARACAS
+		{ 0x57, 0xDC, 0xAD, 0x05, 0x0E, 0x87, 0x00, 0x8D, 0x05, 0x03 },  //  67 DRUMINS_S_WHISTL
+		{ 0x47, 0xDC, 0xAD, 0x05, 0x01, 0x87, 0x12, 0x8D, 0x05, 0x03 },  //  68 DRUMINS_S_WHISTL
+		{ 0x57, 0xDC, 0xA8, 0x04, 0x0E, 0x87, 0x00, 0x88, 0x04, 0x03 },  //  69 DRUMINS_L_WHISTL
+		{ 0x57, 0xDC, 0xA8, 0x04, 0x01, 0x87, 0x08, 0x88, 0x05, 0x03 },  //  70 DRUMINS_L_WHISTL
+		{ 0x80, 0x00, 0xF6, 0x06, 0x0C, 0x10, 0x00, 0xF6, 0x16, 0x05 },  //  71 DRUMINS_S_GUIRO
+		{ 0x00, 0x00, 0x6F, 0x0F, 0x01, 0x00, 0x00, 0x6F, 0x0F, 0x55 },  //  72 DRUMINS_S_GUIRO
+		{ 0x00, 0x00, 0x4F, 0x0F, 0x01, 0x00, 0x00, 0x4F, 0x0F, 0x55 },  //  73 DRUMINS_L_GUIRO
+		{ 0x01, 0xCD, 0x67, 0x47, 0x08, 0x03, 0x40, 0x67, 0x47, 0x07 },  //  74 DRUMINS_MU_CUICA
+		{ 0x01, 0xC0, 0x67, 0x47, 0x01, 0x01, 0x00, 0x65, 0x55, 0x00 },  //  75 DRUMINS_MU_CUICA
+		{ 0x01, 0x17, 0x67, 0xA7, 0x0A, 0x03, 0x1E, 0x65, 0x35, 0x00 },  //  76 DRUMINS_OP_CUICA
+		{ 0x01, 0x9D, 0x77, 0x77, 0x01, 0x01, 0x00, 0x75, 0x05, 0x00 },  //  77 DRUMINS_OP_CUICA
+		{ 0x0A, 0x40, 0xE0, 0xF0, 0x08, 0x1F, 0x40, 0xFF, 0x05, 0x03 },  //  78 DRUMINS_MU_TRNGL
+		{ 0x0A, 0x40, 0xE0, 0xF0, 0x01, 0x1F, 0x48, 0xFF, 0x05, 0x03 },  //  79 DRUMINS_MU_TRNGL
+		{ 0x0A, 0x7C, 0xE0, 0xF0, 0x08, 0x1F, 0x40, 0xFF, 0x02, 0x03 },  //  80 DRUMINS_OP_TRNGL
+		{ 0x0A, 0x7C, 0xF5, 0xE0, 0x01, 0x1F, 0x40, 0xFF, 0x03, 0x03 },  //  81 DRUMINS_OP_TRNGL
+		{ 0x0F, 0x40, 0x7F, 0x4F, 0x0E, 0x00, 0x88, 0x7E, 0x1E, 0x20 },  //  82 DRUMINS_SHAKER
+		{ 0x0F, 0x40, 0x7F, 0x4F, 0x01, 0x00, 0x14, 0x7E, 0x1E, 0x20 },  //  83 DRUMINS_SHAKER
+		{ 0x03, 0x0D, 0xE4, 0xE5, 0x0B, 0x07, 0x11, 0xF5, 0xE7, 0x76 },  //  84 DRUMINS_TRIANGL2
+		{ 0x00, 0x1B, 0xF5, 0x66, 0x00, 0x04, 0x15, 0xF6, 0xA8, 0x43 },  //  85 DRUMINS_TRIANGL2
+		{ 0x03, 0x3F, 0x00, 0xF4, 0x08, 0x15, 0x00, 0xF7, 0xF5, 0x03 },  //  86 DRUMINS_RIMSHOT3
+		{ 0x03, 0x3F, 0x00, 0xF4, 0x01, 0x15, 0x08, 0xF7, 0xF5, 0x03 },  //  87 DRUMINS_RIMSHOT3
+		{ 0x01, 0x4F, 0xFA, 0x8D, 0x06, 0x02, 0x00, 0xF8, 0xB5, 0x00 },  //  88 DRUMINS_RIMSHOT4
+		{ 0x01, 0x4F, 0xFA, 0x8D, 0x01, 0x02, 0x12, 0xF8, 0xB5, 0x00 },  //  89 DRUMINS_RIMSHOT4
+		{ 0x01, 0x4F, 0xFA, 0x84, 0x06, 0x00, 0x00, 0xF8, 0xB4, 0x00 },  //  90 DRUMINS_TAIKO
+		{ 0x01, 0x4F, 0xFA, 0x84, 0x01, 0x00, 0x00, 0xF8, 0xB4, 0x00 },  //  91 DRUMINS_TAIKO
+	};
+
+	const unsigned char midiDrumTable4OPPrograms[60][3] PROGMEM = {
+		{ 0x40, 0x00, 0x01 }, { 0x00, 0x02, 0x02 }, { 0x00, 0x02, 0x02 }, { 0x31, 0x03, 0x04 }, { 0x49, 0x05, 0x06 }, { 0x41, 0x07, 0x08 },
+		{ 0x3C, 0x09, 0x0A }, { 0x23, 0x0B, 0x0C }, { 0x23, 0x0D, 0x0E }, { 0x2C, 0x03, 0x04 }, { 0x30, 0x0F, 0x10 }, { 0x3A, 0x00, 0x01 },
+		{ 0x3C, 0x0F, 0x11 }, { 0x30, 0x0D, 0x12 }, { 0x2B, 0x13, 0x14 }, { 0x31, 0x0D, 0x0E }, { 0x2B, 0x15, 0x16 }, { 0x33, 0x0D, 0x0E },
+		{ 0x2B, 0x17, 0x18 }, { 0x36, 0x0D, 0x0E }, { 0x39, 0x0D, 0x0E }, { 0x48, 0x19, 0x1A }, { 0x3C, 0x0D, 0x0E }, { 0x46, 0x1B, 0x1C },
+		{ 0x3C, 0x1D, 0x1E }, { 0x24, 0x1F, 0x20 }, { 0x41, 0x21, 0x22 }, { 0x54, 0x23, 0x24 }, { 0x3B, 0x25, 0x26 }, { 0x54, 0x27, 0x28 },
+		{ 0x23, 0x29, 0x2A }, { 0x2C, 0x2B, 0x2C }, { 0x43, 0x2D, 0x2E }, { 0x42, 0x2F, 0x30 }, { 0x3B, 0x31, 0x32 }, { 0x33, 0x33, 0x34 },
+		{ 0x2D, 0x35, 0x36 }, { 0x47, 0x37, 0x38 }, { 0x3C, 0x39, 0x3A }, { 0x3A, 0x3B, 0x3C }, { 0x35, 0x3D, 0x3E }, { 0x40, 0x3F, 0x40 },
+		{ 0x47, 0x41, 0x42 }, { 0x3D, 0x43, 0x44 }, { 0x3D, 0x45, 0x46 }, { 0x30, 0x47, 0x48 }, { 0x30, 0x47, 0x49 }, { 0x45, 0x05, 0x06 },
+		{ 0x44, 0x07, 0x08 }, { 0x3F, 0x07, 0x08 }, { 0x4A, 0x4A, 0x4B }, { 0x3C, 0x4C, 0x4D }, { 0x50, 0x4E, 0x4F }, { 0x40, 0x50, 0x51 },
+		{ 0x45, 0x52, 0x53 }, { 0x37, 0x09, 0x0A }, { 0x4B, 0x54, 0x55 }, { 0x44, 0x56, 0x57 }, { 0x30, 0x58, 0x59 }, { 0x35, 0x5A, 0x5B },
+	};
+
+	const InstrumentTable midiDrumTable4OP = {
+		midiDrumTable4OPVoices[0], midiDrumTable4OPPrograms[0], 60, 2, 0x00
+	};
+#endif